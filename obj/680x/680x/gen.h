@@ -0,0 +1,347 @@
+/* This file is automatically generated */
+static unsigned m6800_patterns[][_OPD_TYPE_COUNT] =
+{
+	[MNEM_ABA] = { 0x1b, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ABX] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ADCA] = { UNDEF, 0x89, UNDEF, 0x99, 0xa9, 0xb9, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ADCB] = { UNDEF, 0xc9, UNDEF, 0xd9, 0xe9, 0xf9, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ADDA] = { UNDEF, 0x8b, UNDEF, 0x9b, 0xab, 0xbb, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ADDB] = { UNDEF, 0xcb, UNDEF, 0xdb, 0xeb, 0xfb, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ADDD] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ANDA] = { UNDEF, 0x84, UNDEF, 0x94, 0xa4, 0xb4, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ANDB] = { UNDEF, 0xc4, UNDEF, 0xd4, 0xe4, 0xf4, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ANDCC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASL] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x68, 0x78, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASLA] = { 0x48, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASLB] = { 0x58, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASR] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x67, 0x77, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASRA] = { 0x47, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASRB] = { 0x57, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_BCC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x24, UNDEF, UNDEF, UNDEF },
+	[MNEM_BCS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x25, UNDEF, UNDEF, UNDEF },
+	[MNEM_BEQ] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x27, UNDEF, UNDEF, UNDEF },
+	[MNEM_BGE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2c, UNDEF, UNDEF, UNDEF },
+	[MNEM_BGT] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2e, UNDEF, UNDEF, UNDEF },
+	[MNEM_BHI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x22, UNDEF, UNDEF, UNDEF },
+	[MNEM_BHS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_BITA] = { UNDEF, 0x85, UNDEF, 0x95, 0xa5, 0xb5, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_BITB] = { UNDEF, 0xc5, UNDEF, 0xd5, 0xe5, 0xf5, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_BLE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2f, UNDEF, UNDEF, UNDEF },
+	[MNEM_BLO] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_BLS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x23, UNDEF, UNDEF, UNDEF },
+	[MNEM_BLT] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2d, UNDEF, UNDEF, UNDEF },
+	[MNEM_BMI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2b, UNDEF, UNDEF, UNDEF },
+	[MNEM_BNE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x26, UNDEF, UNDEF, UNDEF },
+	[MNEM_BPL] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2a, UNDEF, UNDEF, UNDEF },
+	[MNEM_BRA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x20, UNDEF, UNDEF, UNDEF },
+	[MNEM_BRN] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_BSR] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x8d, UNDEF, UNDEF, UNDEF },
+	[MNEM_BVC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x28, UNDEF, UNDEF, UNDEF },
+	[MNEM_BVS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x29, UNDEF, UNDEF, UNDEF },
+	[MNEM_CBA] = { 0x11, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLC] = { 0xc, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLI] = { 0xe, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLR] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x6f, 0x7f, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLRA] = { 0x4f, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLRB] = { 0x5f, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLV] = { 0xa, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPA] = { UNDEF, 0x81, UNDEF, 0x91, 0xa1, 0xb1, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPB] = { UNDEF, 0xc1, UNDEF, 0xd1, 0xe1, 0xf1, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPD] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPU] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPX] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPY] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_COM] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x63, 0x73, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_COMA] = { 0x43, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_COMB] = { 0x53, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CPX] = { UNDEF, UNDEF, 0x8c, 0x9c, 0xac, 0xbc, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CWAI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DAA] = { 0x19, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DEC] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x6a, 0x7a, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DECA] = { 0x4a, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DECB] = { 0x5a, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DES] = { 0x34, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DEX] = { 0x9, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_EORA] = { UNDEF, 0x88, UNDEF, 0x98, 0xa8, 0xb8, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_EORB] = { UNDEF, 0xc8, UNDEF, 0xd8, 0xe8, 0xf8, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_EXG] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_INC] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x6c, 0x7c, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_INCA] = { 0x4c, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_INCB] = { 0x5c, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_INS] = { 0x31, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_INX] = { 0x8, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_JMP] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x6e, 0x7e, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_JSR] = { UNDEF, UNDEF, UNDEF, 0x9d, 0xad, 0xbd, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBCC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBCS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBEQ] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBGE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBGT] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBHI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBHS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBLE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBLO] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBLS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBLT] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBMI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBNE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBPL] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBRA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBRN] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBSR] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBVC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBVS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDAA] = { UNDEF, 0x86, UNDEF, 0x96, 0xa6, 0xb6, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDAB] = { UNDEF, 0xc6, UNDEF, 0xd6, 0xe6, 0xf6, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDB] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDD] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDS] = { UNDEF, UNDEF, 0x8e, 0x9e, 0xae, 0xbe, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDU] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDX] = { UNDEF, UNDEF, 0xce, 0xde, 0xee, 0xfe, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDY] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LEAS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LEAU] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LEAX] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LEAY] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSL] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSLA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSLB] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSR] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x64, 0x74, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSRA] = { 0x44, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSRB] = { 0x44, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_MUL] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_NEG] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x60, 0x70, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_NEGA] = { 0x40, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_NEGB] = { 0x50, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_NOP] = { 0x1, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ORA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ORAA] = { UNDEF, 0x8a, UNDEF, 0x9a, 0xaa, 0xba, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ORAB] = { UNDEF, 0xca, UNDEF, 0xda, 0xea, 0xfa, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ORB] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ORCC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PSHA] = { 0x36, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PSHB] = { 0x37, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PSHS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PSHU] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PULA] = { 0x32, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PULB] = { 0x33, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PULS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PULU] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ROL] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x69, 0x79, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ROLA] = { 0x49, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ROLB] = { 0x59, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ROR] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x66, 0x76, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_RORA] = { 0x46, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_RORB] = { 0x56, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_RTI] = { 0x3b, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_RTS] = { 0x39, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SBA] = { 0x10, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SBCA] = { UNDEF, 0x82, UNDEF, 0x92, 0xa2, 0xb2, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SBCB] = { UNDEF, 0xc2, UNDEF, 0xd2, 0xe2, 0xf2, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SEC] = { 0xd, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SEI] = { 0xf, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SEV] = { 0xb, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SEX] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STAA] = { UNDEF, UNDEF, UNDEF, 0x97, 0xa7, 0xb7, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STAB] = { UNDEF, UNDEF, UNDEF, 0xd7, 0xe7, 0xf7, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STB] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STD] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STS] = { UNDEF, UNDEF, UNDEF, 0x9f, 0xaf, 0xbf, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STU] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STX] = { UNDEF, UNDEF, UNDEF, 0xdf, 0xef, 0xff, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STY] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SUBA] = { UNDEF, 0x80, UNDEF, 0x90, 0xa0, 0xb0, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SUBB] = { UNDEF, 0xc0, UNDEF, 0xd0, 0xe0, 0xf0, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SUBD] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SWI] = { 0x3f, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SWI2] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SWI3] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SYNC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TAB] = { 0x16, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TAP] = { 0x6, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TBA] = { 0x17, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TFR] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TPA] = { 0x7, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TST] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x6d, 0x7d, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TSTA] = { 0x4d, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TSTB] = { 0x5d, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TSX] = { 0x30, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TXS] = { 0x35, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_WAI] = { 0x3e, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+};
+static unsigned m6809_patterns[][_OPD_TYPE_COUNT] =
+{
+	[MNEM_ABA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ABX] = { 0x3a, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ADCA] = { UNDEF, 0x89, UNDEF, 0x99, 0xa9, 0xb9, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ADCB] = { UNDEF, 0xc9, UNDEF, 0xd9, 0xe9, 0xf9, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ADDA] = { UNDEF, 0x8b, UNDEF, 0x9b, 0xab, 0xbb, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ADDB] = { UNDEF, 0xcb, UNDEF, 0xdb, 0xeb, 0xfb, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ADDD] = { UNDEF, UNDEF, 0xc3, 0xd3, 0xe3, 0xf3, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ANDA] = { UNDEF, 0x84, UNDEF, 0x94, 0xa4, 0xb4, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ANDB] = { UNDEF, 0xc4, UNDEF, 0xd4, 0xe4, 0xf4, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ANDCC] = { UNDEF, 0x1c, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASL] = { UNDEF, UNDEF, UNDEF, 0x8, 0x68, 0x78, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASLA] = { 0x48, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASLB] = { 0x58, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASR] = { UNDEF, UNDEF, UNDEF, 0x7, 0x67, 0x77, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASRA] = { 0x47, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ASRB] = { 0x57, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_BCC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x24, 0x1024, UNDEF, UNDEF },
+	[MNEM_BCS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x25, 0x1025, UNDEF, UNDEF },
+	[MNEM_BEQ] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x27, 0x1027, UNDEF, UNDEF },
+	[MNEM_BGE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2c, 0x102c, UNDEF, UNDEF },
+	[MNEM_BGT] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2e, 0x102e, UNDEF, UNDEF },
+	[MNEM_BHI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x22, 0x1022, UNDEF, UNDEF },
+	[MNEM_BHS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x24, 0x1024, UNDEF, UNDEF },
+	[MNEM_BITA] = { UNDEF, 0x85, UNDEF, 0x95, 0xa5, 0xb5, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_BITB] = { UNDEF, 0xc5, UNDEF, 0xd5, 0xe5, 0xf5, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_BLE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2f, 0x102f, UNDEF, UNDEF },
+	[MNEM_BLO] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x25, 0x1025, UNDEF, UNDEF },
+	[MNEM_BLS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x23, 0x1023, UNDEF, UNDEF },
+	[MNEM_BLT] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2d, 0x102d, UNDEF, UNDEF },
+	[MNEM_BMI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2b, 0x102b, UNDEF, UNDEF },
+	[MNEM_BNE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x26, 0x1026, UNDEF, UNDEF },
+	[MNEM_BPL] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x2a, 0x102a, UNDEF, UNDEF },
+	[MNEM_BRA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x20, 0x16, UNDEF, UNDEF },
+	[MNEM_BRN] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x21, 0x1021, UNDEF, UNDEF },
+	[MNEM_BSR] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x8d, 0x17, UNDEF, UNDEF },
+	[MNEM_BVC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x28, 0x1028, UNDEF, UNDEF },
+	[MNEM_BVS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x29, 0x1029, UNDEF, UNDEF },
+	[MNEM_CBA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLR] = { UNDEF, UNDEF, UNDEF, 0xf, 0x6f, 0x7f, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLRA] = { 0x4f, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLRB] = { 0x5f, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CLV] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPA] = { UNDEF, 0x81, UNDEF, 0x91, 0xa1, 0xb1, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPB] = { UNDEF, 0xc1, UNDEF, 0xd1, 0xe1, 0xf1, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPD] = { UNDEF, UNDEF, 0x1083, 0x1093, 0x10a3, 0x10b3, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPS] = { UNDEF, UNDEF, 0x118c, 0x119c, 0x11ac, 0x11bc, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPU] = { UNDEF, UNDEF, 0x1183, 0x1193, 0x11a3, 0x11b3, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPX] = { UNDEF, UNDEF, 0x8c, 0x9c, 0xac, 0xbc, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CMPY] = { UNDEF, UNDEF, 0x118c, 0x119c, 0x11ac, 0x11bc, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_COM] = { UNDEF, UNDEF, UNDEF, 0x3, 0x63, 0x73, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_COMA] = { 0x43, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_COMB] = { 0x53, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CPX] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_CWAI] = { UNDEF, 0x3c, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DAA] = { 0x19, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DEC] = { UNDEF, UNDEF, UNDEF, 0xa, 0x6a, 0x7a, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DECA] = { 0x4a, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DECB] = { 0x5a, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DES] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_DEX] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_EORA] = { UNDEF, 0x88, UNDEF, 0x98, 0xa8, 0xb8, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_EORB] = { UNDEF, 0xc8, UNDEF, 0xd8, 0xe8, 0xf8, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_EXG] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1e, UNDEF },
+	[MNEM_INC] = { UNDEF, UNDEF, UNDEF, 0xc, 0x6c, 0x7c, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_INCA] = { 0x4c, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_INCB] = { 0x5c, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_INS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_INX] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_JMP] = { UNDEF, UNDEF, UNDEF, 0xe, 0x6e, 0x7e, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_JSR] = { UNDEF, UNDEF, UNDEF, 0x9d, 0xad, 0xbd, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LBCC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1024, UNDEF, UNDEF },
+	[MNEM_LBCS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1025, UNDEF, UNDEF },
+	[MNEM_LBEQ] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1027, UNDEF, UNDEF },
+	[MNEM_LBGE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x102c, UNDEF, UNDEF },
+	[MNEM_LBGT] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x102e, UNDEF, UNDEF },
+	[MNEM_LBHI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1022, UNDEF, UNDEF },
+	[MNEM_LBHS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1024, UNDEF, UNDEF },
+	[MNEM_LBLE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x102f, UNDEF, UNDEF },
+	[MNEM_LBLO] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1025, UNDEF, UNDEF },
+	[MNEM_LBLS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1023, UNDEF, UNDEF },
+	[MNEM_LBLT] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x102d, UNDEF, UNDEF },
+	[MNEM_LBMI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x102b, UNDEF, UNDEF },
+	[MNEM_LBNE] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1026, UNDEF, UNDEF },
+	[MNEM_LBPL] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x102a, UNDEF, UNDEF },
+	[MNEM_LBRA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x16, UNDEF, UNDEF },
+	[MNEM_LBRN] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1021, UNDEF, UNDEF },
+	[MNEM_LBSR] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x17, UNDEF, UNDEF },
+	[MNEM_LBVC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1028, UNDEF, UNDEF },
+	[MNEM_LBVS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1029, UNDEF, UNDEF },
+	[MNEM_LDA] = { UNDEF, 0x86, UNDEF, 0x96, 0xa6, 0xb6, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDAA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDAB] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDB] = { UNDEF, 0xc6, UNDEF, 0xd6, 0xe6, 0xf6, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDD] = { UNDEF, UNDEF, 0xcc, 0xdc, 0xec, 0xfc, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDS] = { UNDEF, UNDEF, 0x10ce, 0x10de, 0x10ee, 0x10fe, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDU] = { UNDEF, UNDEF, 0xce, 0xde, 0xee, 0xfe, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDX] = { UNDEF, UNDEF, 0x8e, 0x9e, 0xae, 0xbe, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LDY] = { UNDEF, UNDEF, 0x108e, 0x109e, 0x10ae, 0x10be, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LEAS] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x32, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LEAU] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x33, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LEAX] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x30, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LEAY] = { UNDEF, UNDEF, UNDEF, UNDEF, 0x31, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSL] = { UNDEF, UNDEF, UNDEF, 0x8, 0x68, 0x78, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSLA] = { 0x48, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSLB] = { 0x58, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSR] = { UNDEF, UNDEF, UNDEF, 0x4, 0x64, 0x74, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSRA] = { 0x44, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_LSRB] = { 0x44, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_MUL] = { 0x3d, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_NEG] = { UNDEF, UNDEF, UNDEF, 0x0, 0x60, 0x70, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_NEGA] = { 0x40, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_NEGB] = { 0x50, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_NOP] = { 0x12, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ORA] = { UNDEF, 0x8a, UNDEF, 0x9a, 0xaa, 0xba, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ORAA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ORAB] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ORB] = { UNDEF, 0xca, UNDEF, 0xda, 0xea, 0xfa, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ORCC] = { UNDEF, 0x1a, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PSHA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PSHB] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PSHS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x34 },
+	[MNEM_PSHU] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x36 },
+	[MNEM_PULA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PULB] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_PULS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x35 },
+	[MNEM_PULU] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x37 },
+	[MNEM_ROL] = { UNDEF, UNDEF, UNDEF, 0x9, 0x69, 0x79, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ROLA] = { 0x49, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ROLB] = { 0x59, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_ROR] = { UNDEF, UNDEF, UNDEF, 0x6, 0x66, 0x76, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_RORA] = { 0x46, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_RORB] = { 0x56, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_RTI] = { 0x3b, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_RTS] = { 0x39, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SBA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SBCA] = { UNDEF, 0x82, UNDEF, 0x92, 0xa2, 0xb2, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SBCB] = { UNDEF, 0xc2, UNDEF, 0xd2, 0xe2, 0xf2, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SEC] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SEI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SEV] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SEX] = { 0x1d, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STA] = { UNDEF, UNDEF, UNDEF, 0x97, 0xa7, 0xb7, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STAA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STAB] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STB] = { UNDEF, UNDEF, UNDEF, 0xd7, 0xe7, 0xf7, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STD] = { UNDEF, UNDEF, UNDEF, 0xdd, 0xed, 0xfd, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STS] = { UNDEF, UNDEF, UNDEF, 0x10df, 0x10ef, 0x10ff, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STU] = { UNDEF, UNDEF, UNDEF, 0xdf, 0xef, 0xff, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STX] = { UNDEF, UNDEF, UNDEF, 0x9f, 0xaf, 0xbf, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_STY] = { UNDEF, UNDEF, UNDEF, 0x109f, 0x10af, 0x10bf, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SUBA] = { UNDEF, 0x80, UNDEF, 0x90, 0xa0, 0xb0, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SUBB] = { UNDEF, 0xc0, UNDEF, 0xd0, 0xe0, 0xf0, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SUBD] = { UNDEF, UNDEF, 0x83, 0x93, 0xa3, 0xb3, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SWI] = { 0x3f, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SWI2] = { 0x103f, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SWI3] = { 0x113f, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_SYNC] = { 0x13, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TAB] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TAP] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TBA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TFR] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, 0x1f, UNDEF },
+	[MNEM_TPA] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TST] = { UNDEF, UNDEF, UNDEF, 0xd, 0x6d, 0x7d, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TSTA] = { 0x4d, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TSTB] = { 0x5d, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TSX] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_TXS] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+	[MNEM_WAI] = { UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF, UNDEF },
+};
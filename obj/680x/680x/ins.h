@@ -0,0 +1,172 @@
+/* This file is automatically generated */
+/* INCLUDE_MNEMONICS_YACC */
+	MNEM_ABA,
+	MNEM_ABX,
+	MNEM_ADCA,
+	MNEM_ADCB,
+	MNEM_ADDA,
+	MNEM_ADDB,
+	MNEM_ADDD,
+	MNEM_ANDA,
+	MNEM_ANDB,
+	MNEM_ANDCC,
+	MNEM_ASL,
+	MNEM_ASLA,
+	MNEM_ASLB,
+	MNEM_ASR,
+	MNEM_ASRA,
+	MNEM_ASRB,
+	MNEM_BCC,
+	MNEM_BCS,
+	MNEM_BEQ,
+	MNEM_BGE,
+	MNEM_BGT,
+	MNEM_BHI,
+	MNEM_BHS,
+	MNEM_BITA,
+	MNEM_BITB,
+	MNEM_BLE,
+	MNEM_BLO,
+	MNEM_BLS,
+	MNEM_BLT,
+	MNEM_BMI,
+	MNEM_BNE,
+	MNEM_BPL,
+	MNEM_BRA,
+	MNEM_BRN,
+	MNEM_BSR,
+	MNEM_BVC,
+	MNEM_BVS,
+	MNEM_CBA,
+	MNEM_CLC,
+	MNEM_CLI,
+	MNEM_CLR,
+	MNEM_CLRA,
+	MNEM_CLRB,
+	MNEM_CLV,
+	MNEM_CMPA,
+	MNEM_CMPB,
+	MNEM_CMPD,
+	MNEM_CMPS,
+	MNEM_CMPU,
+	MNEM_CMPX,
+	MNEM_CMPY,
+	MNEM_COM,
+	MNEM_COMA,
+	MNEM_COMB,
+	MNEM_CPX,
+	MNEM_CWAI,
+	MNEM_DAA,
+	MNEM_DEC,
+	MNEM_DECA,
+	MNEM_DECB,
+	MNEM_DES,
+	MNEM_DEX,
+	MNEM_EORA,
+	MNEM_EORB,
+	MNEM_EXG,
+	MNEM_INC,
+	MNEM_INCA,
+	MNEM_INCB,
+	MNEM_INS,
+	MNEM_INX,
+	MNEM_JMP,
+	MNEM_JSR,
+	MNEM_LBCC,
+	MNEM_LBCS,
+	MNEM_LBEQ,
+	MNEM_LBGE,
+	MNEM_LBGT,
+	MNEM_LBHI,
+	MNEM_LBHS,
+	MNEM_LBLE,
+	MNEM_LBLO,
+	MNEM_LBLS,
+	MNEM_LBLT,
+	MNEM_LBMI,
+	MNEM_LBNE,
+	MNEM_LBPL,
+	MNEM_LBRA,
+	MNEM_LBRN,
+	MNEM_LBSR,
+	MNEM_LBVC,
+	MNEM_LBVS,
+	MNEM_LDA,
+	MNEM_LDAA,
+	MNEM_LDAB,
+	MNEM_LDB,
+	MNEM_LDD,
+	MNEM_LDS,
+	MNEM_LDU,
+	MNEM_LDX,
+	MNEM_LDY,
+	MNEM_LEAS,
+	MNEM_LEAU,
+	MNEM_LEAX,
+	MNEM_LEAY,
+	MNEM_LSL,
+	MNEM_LSLA,
+	MNEM_LSLB,
+	MNEM_LSR,
+	MNEM_LSRA,
+	MNEM_LSRB,
+	MNEM_MUL,
+	MNEM_NEG,
+	MNEM_NEGA,
+	MNEM_NEGB,
+	MNEM_NOP,
+	MNEM_ORA,
+	MNEM_ORAA,
+	MNEM_ORAB,
+	MNEM_ORB,
+	MNEM_ORCC,
+	MNEM_PSHA,
+	MNEM_PSHB,
+	MNEM_PSHS,
+	MNEM_PSHU,
+	MNEM_PULA,
+	MNEM_PULB,
+	MNEM_PULS,
+	MNEM_PULU,
+	MNEM_ROL,
+	MNEM_ROLA,
+	MNEM_ROLB,
+	MNEM_ROR,
+	MNEM_RORA,
+	MNEM_RORB,
+	MNEM_RTI,
+	MNEM_RTS,
+	MNEM_SBA,
+	MNEM_SBCA,
+	MNEM_SBCB,
+	MNEM_SEC,
+	MNEM_SEI,
+	MNEM_SEV,
+	MNEM_SEX,
+	MNEM_STA,
+	MNEM_STAA,
+	MNEM_STAB,
+	MNEM_STB,
+	MNEM_STD,
+	MNEM_STS,
+	MNEM_STU,
+	MNEM_STX,
+	MNEM_STY,
+	MNEM_SUBA,
+	MNEM_SUBB,
+	MNEM_SUBD,
+	MNEM_SWI,
+	MNEM_SWI2,
+	MNEM_SWI3,
+	MNEM_SYNC,
+	MNEM_TAB,
+	MNEM_TAP,
+	MNEM_TBA,
+	MNEM_TFR,
+	MNEM_TPA,
+	MNEM_TST,
+	MNEM_TSTA,
+	MNEM_TSTB,
+	MNEM_TSX,
+	MNEM_TXS,
+	MNEM_WAI,
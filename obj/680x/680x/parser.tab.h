@@ -0,0 +1,183 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_OBJ_680X_680X_PARSER_TAB_H_INCLUDED
+# define YY_YY_OBJ_680X_680X_PARSER_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 3 "../680x/../parser.y"
+
+#include "../../../src/preprocess.h"
+
+#line 53 "../../obj/680x/680x/parser.tab.h"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    KWD_ALIGN = 258,               /* KWD_ALIGN  */
+    KWD_COMMON = 259,              /* KWD_COMMON  */
+    TOK_DATA = 260,                /* TOK_DATA  */
+    KWD_DEFINED = 261,             /* KWD_DEFINED  */
+    KWD_ELSE_IF = 262,             /* KWD_ELSE_IF  */
+    KWD_ELSE = 263,                /* KWD_ELSE  */
+    KWD_ENDFILL = 264,             /* KWD_ENDFILL  */
+    KWD_ENDIF = 265,               /* KWD_ENDIF  */
+    KWD_ENDMACRO = 266,            /* KWD_ENDMACRO  */
+    KWD_ENDREPEAT = 267,           /* KWD_ENDREPEAT  */
+    KWD_ENDTIMES = 268,            /* KWD_ENDTIMES  */
+    KWD_ENTRY = 269,               /* KWD_ENTRY  */
+    KWD_EQU = 270,                 /* KWD_EQU  */
+    KWD_EXPORT = 271,              /* KWD_EXPORT  */
+    KWD_EXTERN = 272,              /* KWD_EXTERN  */
+    KWD_FILL = 273,                /* KWD_FILL  */
+    KWD_GLOBAL = 274,              /* KWD_GLOBAL  */
+    KWD_IF = 275,                  /* KWD_IF  */
+    KWD_IMPORT = 276,              /* KWD_IMPORT  */
+    KWD_INCLUDE = 277,             /* KWD_INCLUDE  */
+    KWD_MACRO = 278,               /* KWD_MACRO  */
+    KWD_ONCE = 279,                /* KWD_ONCE  */
+    KWD_ORG = 280,                 /* KWD_ORG  */
+    KWD_REPEAT = 281,              /* KWD_REPEAT  */
+    KWD_SECTION = 282,             /* KWD_SECTION  */
+    KWD_SKIP = 283,                /* KWD_SKIP  */
+    KWD_TIMES = 284,               /* KWD_TIMES  */
+    TOK_IDENTIFIER = 285,          /* TOK_IDENTIFIER  */
+    TOK_INTEGER = 286,             /* TOK_INTEGER  */
+    TOK_LABEL_FORWARD = 287,       /* TOK_LABEL_FORWARD  */
+    TOK_LABEL_BACKWARD = 288,      /* TOK_LABEL_BACKWARD  */
+    TOK_STRING = 289,              /* TOK_STRING  */
+    TOK_MACRONAME = 290,           /* TOK_MACRONAME  */
+    TOK_MACRO_PARAM = 291,         /* TOK_MACRO_PARAM  */
+    TOK_REPEAT_COUNTER = 292,      /* TOK_REPEAT_COUNTER  */
+    DEL_AND = 293,                 /* "&&"  */
+    DEL_CMP = 294,                 /* "<=>"  */
+    DEL_EQ = 295,                  /* "=="  */
+    DEL_GE = 296,                  /* ">="  */
+    DEL_GE1 = 297,                 /* "=>"  */
+    DEL_LE = 298,                  /* "<="  */
+    DEL_LE1 = 299,                 /* "=<"  */
+    DEL_NE = 300,                  /* "!="  */
+    DEL_NE1 = 301,                 /* "<>"  */
+    DEL_NE2 = 302,                 /* "><"  */
+    DEL_OR = 303,                  /* "||"  */
+    DEL_SECT = 304,                /* "$$"  */
+    DEL_SHL = 305,                 /* "<<"  */
+    DEL_SHR = 306,                 /* ">>"  */
+    DEL_XOR = 307,                 /* "^^"  */
+    DEL_CMP_U = 308,               /* "#<=>"  */
+    DEL_GE_U = 309,                /* "#>="  */
+    DEL_GE1_U = 310,               /* "#=>"  */
+    DEL_LE_U = 311,                /* "#<="  */
+    DEL_LE1_U = 312,               /* "#=<"  */
+    DEL_LT_U = 313,                /* "#<"  */
+    DEL_GT_U = 314,                /* "#>"  */
+    DEL_SHL_S = 315,               /* "<<<"  */
+    DEL_SHR_S = 316,               /* ">>>"  */
+    DEL_DIV_S = 317,               /* "//"  */
+    DEL_MOD_S = 318,               /* "%%"  */
+    TOK_AREG = 319,                /* TOK_AREG  */
+    TOK_BREG = 320,                /* TOK_BREG  */
+    TOK_DREG = 321,                /* TOK_DREG  */
+    TOK_IXREG = 322,               /* TOK_IXREG  */
+    TOK_ARCH = 323,                /* TOK_ARCH  */
+    TOK_6800_MNEM0 = 324,          /* TOK_6800_MNEM0  */
+    TOK_6800_MNEM1 = 325,          /* TOK_6800_MNEM1  */
+    TOK_6800_MNEM1T = 326,         /* TOK_6800_MNEM1T  */
+    TOK_6800_MNEM1R = 327,         /* TOK_6800_MNEM1R  */
+    TOK_6809_MNEM0 = 328,          /* TOK_6809_MNEM0  */
+    TOK_6809_MNEM1 = 329,          /* TOK_6809_MNEM1  */
+    TOK_6809_MNEM1T = 330,         /* TOK_6809_MNEM1T  */
+    TOK_6809_MNEM1I = 331,         /* TOK_6809_MNEM1I  */
+    TOK_6809_MNEM1R = 332,         /* TOK_6809_MNEM1R  */
+    TOK_6809_MNEM1X = 333,         /* TOK_6809_MNEM1X  */
+    TOK_6809_MNEM2 = 334,          /* TOK_6809_MNEM2  */
+    TOK_6809_MNEML = 335,          /* TOK_6809_MNEML  */
+    TOK_PCREL = 336,               /* TOK_PCREL  */
+    TOK_PCREG = 337,               /* TOK_PCREG  */
+    TOK_REG = 338,                 /* TOK_REG  */
+    KWD_LOW = 339,                 /* KWD_LOW  */
+    KWD_HIGH = 340,                /* KWD_HIGH  */
+    KWD_ADDR = 341,                /* KWD_ADDR  */
+    KWD_PAGE = 342                 /* KWD_PAGE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 24 "../680x/../parser.y"
+
+	long i;
+	char * s;
+	expression_t * x;
+
+	integer_value_t j;
+
+	instruction_t * ins;
+
+	replacement_t * macro;
+
+#line 169 "../../obj/680x/680x/parser.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_OBJ_680X_680X_PARSER_TAB_H_INCLUDED  */
@@ -0,0 +1,3039 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 7 "../i4/../parser.y"
+
+#include <assert.h>
+#include <stdio.h>
+#include "../../../src/syntax.h"
+#include "../../../src/asm.h"
+
+typedef enum operand_type_t operand_type_t;
+typedef struct operand_t operand_t;
+
+extern int yylex(void);
+void yyerror(const char * s);
+
+#line 84 "../../obj/i4/i4/parser.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parser.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_KWD_ALIGN = 3,                  /* KWD_ALIGN  */
+  YYSYMBOL_KWD_COMMON = 4,                 /* KWD_COMMON  */
+  YYSYMBOL_TOK_DATA = 5,                   /* TOK_DATA  */
+  YYSYMBOL_KWD_DEFINED = 6,                /* KWD_DEFINED  */
+  YYSYMBOL_KWD_ELSE_IF = 7,                /* KWD_ELSE_IF  */
+  YYSYMBOL_KWD_ELSE = 8,                   /* KWD_ELSE  */
+  YYSYMBOL_KWD_ENDFILL = 9,                /* KWD_ENDFILL  */
+  YYSYMBOL_KWD_ENDIF = 10,                 /* KWD_ENDIF  */
+  YYSYMBOL_KWD_ENDMACRO = 11,              /* KWD_ENDMACRO  */
+  YYSYMBOL_KWD_ENDREPEAT = 12,             /* KWD_ENDREPEAT  */
+  YYSYMBOL_KWD_ENDTIMES = 13,              /* KWD_ENDTIMES  */
+  YYSYMBOL_KWD_ENTRY = 14,                 /* KWD_ENTRY  */
+  YYSYMBOL_KWD_EQU = 15,                   /* KWD_EQU  */
+  YYSYMBOL_KWD_EXPORT = 16,                /* KWD_EXPORT  */
+  YYSYMBOL_KWD_EXTERN = 17,                /* KWD_EXTERN  */
+  YYSYMBOL_KWD_FILL = 18,                  /* KWD_FILL  */
+  YYSYMBOL_KWD_GLOBAL = 19,                /* KWD_GLOBAL  */
+  YYSYMBOL_KWD_IF = 20,                    /* KWD_IF  */
+  YYSYMBOL_KWD_IMPORT = 21,                /* KWD_IMPORT  */
+  YYSYMBOL_KWD_INCLUDE = 22,               /* KWD_INCLUDE  */
+  YYSYMBOL_KWD_MACRO = 23,                 /* KWD_MACRO  */
+  YYSYMBOL_KWD_ONCE = 24,                  /* KWD_ONCE  */
+  YYSYMBOL_KWD_ORG = 25,                   /* KWD_ORG  */
+  YYSYMBOL_KWD_REPEAT = 26,                /* KWD_REPEAT  */
+  YYSYMBOL_KWD_SECTION = 27,               /* KWD_SECTION  */
+  YYSYMBOL_KWD_SKIP = 28,                  /* KWD_SKIP  */
+  YYSYMBOL_KWD_TIMES = 29,                 /* KWD_TIMES  */
+  YYSYMBOL_TOK_IDENTIFIER = 30,            /* TOK_IDENTIFIER  */
+  YYSYMBOL_TOK_INTEGER = 31,               /* TOK_INTEGER  */
+  YYSYMBOL_TOK_LABEL_FORWARD = 32,         /* TOK_LABEL_FORWARD  */
+  YYSYMBOL_TOK_LABEL_BACKWARD = 33,        /* TOK_LABEL_BACKWARD  */
+  YYSYMBOL_TOK_STRING = 34,                /* TOK_STRING  */
+  YYSYMBOL_TOK_MACRONAME = 35,             /* TOK_MACRONAME  */
+  YYSYMBOL_TOK_MACRO_PARAM = 36,           /* TOK_MACRO_PARAM  */
+  YYSYMBOL_TOK_REPEAT_COUNTER = 37,        /* TOK_REPEAT_COUNTER  */
+  YYSYMBOL_DEL_AND = 38,                   /* "&&"  */
+  YYSYMBOL_DEL_CMP = 39,                   /* "<=>"  */
+  YYSYMBOL_DEL_EQ = 40,                    /* "=="  */
+  YYSYMBOL_DEL_GE = 41,                    /* ">="  */
+  YYSYMBOL_DEL_GE1 = 42,                   /* "=>"  */
+  YYSYMBOL_DEL_LE = 43,                    /* "<="  */
+  YYSYMBOL_DEL_LE1 = 44,                   /* "=<"  */
+  YYSYMBOL_DEL_NE = 45,                    /* "!="  */
+  YYSYMBOL_DEL_NE1 = 46,                   /* "<>"  */
+  YYSYMBOL_DEL_NE2 = 47,                   /* "><"  */
+  YYSYMBOL_DEL_OR = 48,                    /* "||"  */
+  YYSYMBOL_DEL_SECT = 49,                  /* "$$"  */
+  YYSYMBOL_DEL_SHL = 50,                   /* "<<"  */
+  YYSYMBOL_DEL_SHR = 51,                   /* ">>"  */
+  YYSYMBOL_DEL_XOR = 52,                   /* "^^"  */
+  YYSYMBOL_DEL_CMP_U = 53,                 /* "#<=>"  */
+  YYSYMBOL_DEL_GE_U = 54,                  /* "#>="  */
+  YYSYMBOL_DEL_GE1_U = 55,                 /* "#=>"  */
+  YYSYMBOL_DEL_LE_U = 56,                  /* "#<="  */
+  YYSYMBOL_DEL_LE1_U = 57,                 /* "#=<"  */
+  YYSYMBOL_DEL_LT_U = 58,                  /* "#<"  */
+  YYSYMBOL_DEL_GT_U = 59,                  /* "#>"  */
+  YYSYMBOL_DEL_SHL_S = 60,                 /* "<<<"  */
+  YYSYMBOL_DEL_SHR_S = 61,                 /* ">>>"  */
+  YYSYMBOL_DEL_DIV_S = 62,                 /* "//"  */
+  YYSYMBOL_DEL_MOD_S = 63,                 /* "%%"  */
+  YYSYMBOL_64_ = 64,                       /* '?'  */
+  YYSYMBOL_65_ = 65,                       /* ':'  */
+  YYSYMBOL_66_ = 66,                       /* '<'  */
+  YYSYMBOL_67_ = 67,                       /* '>'  */
+  YYSYMBOL_68_ = 68,                       /* '!'  */
+  YYSYMBOL_69_ = 69,                       /* '|'  */
+  YYSYMBOL_70_ = 70,                       /* '^'  */
+  YYSYMBOL_71_ = 71,                       /* '&'  */
+  YYSYMBOL_72_ = 72,                       /* '+'  */
+  YYSYMBOL_73_ = 73,                       /* '-'  */
+  YYSYMBOL_74_n_ = 74,                     /* '\n'  */
+  YYSYMBOL_75_ = 75,                       /* ','  */
+  YYSYMBOL_76_ = 76,                       /* '='  */
+  YYSYMBOL_77_ = 77,                       /* '*'  */
+  YYSYMBOL_78_ = 78,                       /* '.'  */
+  YYSYMBOL_79_ = 79,                       /* '$'  */
+  YYSYMBOL_80_ = 80,                       /* '~'  */
+  YYSYMBOL_81_ = 81,                       /* '('  */
+  YYSYMBOL_82_ = 82,                       /* ')'  */
+  YYSYMBOL_83_ = 83,                       /* '/'  */
+  YYSYMBOL_84_ = 84,                       /* '%'  */
+  YYSYMBOL_TOK_ARCH = 85,                  /* TOK_ARCH  */
+  YYSYMBOL_TOK_MNEM = 86,                  /* TOK_MNEM  */
+  YYSYMBOL_YYACCEPT = 87,                  /* $accept  */
+  YYSYMBOL_file = 88,                      /* file  */
+  YYSYMBOL_line = 89,                      /* line  */
+  YYSYMBOL_directive = 90,                 /* directive  */
+  YYSYMBOL_91_1 = 91,                      /* $@1  */
+  YYSYMBOL_92_2 = 92,                      /* $@2  */
+  YYSYMBOL_93_3 = 93,                      /* $@3  */
+  YYSYMBOL_94_4 = 94,                      /* $@4  */
+  YYSYMBOL_95_5 = 95,                      /* $@5  */
+  YYSYMBOL_96_6 = 96,                      /* $@6  */
+  YYSYMBOL_repeat_directive = 97,          /* repeat_directive  */
+  YYSYMBOL_macro_definition = 98,          /* macro_definition  */
+  YYSYMBOL_macro_definition_head = 99,     /* macro_definition_head  */
+  YYSYMBOL_macro_definition_arguments = 100, /* macro_definition_arguments  */
+  YYSYMBOL_section_directive = 101,        /* section_directive  */
+  YYSYMBOL_comma_opt = 102,                /* comma_opt  */
+  YYSYMBOL_data = 103,                     /* data  */
+  YYSYMBOL_extern = 104,                   /* extern  */
+  YYSYMBOL_global = 105,                   /* global  */
+  YYSYMBOL_common = 106,                   /* common  */
+  YYSYMBOL_import = 107,                   /* import  */
+  YYSYMBOL_export_head = 108,              /* export_head  */
+  YYSYMBOL_export_directive = 109,         /* export_directive  */
+  YYSYMBOL_export = 110,                   /* export  */
+  YYSYMBOL_here = 111,                     /* here  */
+  YYSYMBOL_prefix_expression_noparen = 112, /* prefix_expression_noparen  */
+  YYSYMBOL_prefix_expression = 113,        /* prefix_expression  */
+  YYSYMBOL_multiplication = 114,           /* multiplication  */
+  YYSYMBOL_multiplicative_expression = 115, /* multiplicative_expression  */
+  YYSYMBOL_operation_expression = 116,     /* operation_expression  */
+  YYSYMBOL_expression = 117,               /* expression  */
+  YYSYMBOL_mnemonic = 118,                 /* mnemonic  */
+  YYSYMBOL_instruction = 119,              /* instruction  */
+  YYSYMBOL_mnemonic_operands = 120,        /* mnemonic_operands  */
+  YYSYMBOL_operand = 121                   /* operand  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+/* Second part of user prologue.  */
+#line 4 "../i4/parser.y"
+
+#include "../../../src/i4/isa.h"
+
+void operand_set_immediate(operand_t * opd, expression_t * value);
+
+parser_state_t current_parser_state[1];
+extern instruction_t current_instruction;
+#define current_operand (current_instruction.operand[current_instruction.operand_count])
+#define current_instruction_stream (&current_parser_state->stream)
+
+#line 250 "../../obj/i4/i4/parser.tab.c"
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  2
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1079
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  87
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  35
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  152
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  281
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   320
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+      74,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    68,     2,     2,    79,    84,    71,     2,
+      81,    82,    77,    72,    75,    73,    78,    83,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    65,     2,
+      66,    76,    67,    64,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,    70,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,    69,     2,    80,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    85,
+      86
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   116,   116,   117,   121,   125,   126,   130,   131,   139,
+     143,   150,   157,   164,   170,   176,   182,   197,   196,   216,
+     215,   235,   241,   248,   247,   255,   260,   266,   272,   278,
+     284,   289,   294,   301,   300,   312,   311,   323,   337,   343,
+     350,   354,   358,   362,   366,   371,   370,   381,   386,   394,
+     395,   399,   406,   410,   417,   422,   426,   433,   443,   444,
+     448,   454,   463,   468,   476,   481,   489,   494,   499,   507,
+     518,   523,   528,   536,   541,   546,   553,   563,   568,   573,
+     581,   589,   597,   608,   609,   613,   614,   615,   619,   623,
+     627,   633,   639,   645,   649,   653,   657,   661,   665,   669,
+     673,   677,   681,   688,   689,   696,   700,   704,   708,   712,
+     716,   720,   724,   728,   735,   736,   764,   768,   772,   776,
+     780,   784,   788,   792,   796,   800,   804,   808,   812,   816,
+     820,   824,   828,   832,   836,   840,   844,   848,   852,   856,
+     860,   864,   868,   872,   879,   880,    23,    31,    39,    44,
+      52,    56,    63
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "KWD_ALIGN",
+  "KWD_COMMON", "TOK_DATA", "KWD_DEFINED", "KWD_ELSE_IF", "KWD_ELSE",
+  "KWD_ENDFILL", "KWD_ENDIF", "KWD_ENDMACRO", "KWD_ENDREPEAT",
+  "KWD_ENDTIMES", "KWD_ENTRY", "KWD_EQU", "KWD_EXPORT", "KWD_EXTERN",
+  "KWD_FILL", "KWD_GLOBAL", "KWD_IF", "KWD_IMPORT", "KWD_INCLUDE",
+  "KWD_MACRO", "KWD_ONCE", "KWD_ORG", "KWD_REPEAT", "KWD_SECTION",
+  "KWD_SKIP", "KWD_TIMES", "TOK_IDENTIFIER", "TOK_INTEGER",
+  "TOK_LABEL_FORWARD", "TOK_LABEL_BACKWARD", "TOK_STRING", "TOK_MACRONAME",
+  "TOK_MACRO_PARAM", "TOK_REPEAT_COUNTER", "\"&&\"", "\"<=>\"", "\"==\"",
+  "\">=\"", "\"=>\"", "\"<=\"", "\"=<\"", "\"!=\"", "\"<>\"", "\"><\"",
+  "\"||\"", "\"$$\"", "\"<<\"", "\">>\"", "\"^^\"", "\"#<=>\"", "\"#>=\"",
+  "\"#=>\"", "\"#<=\"", "\"#=<\"", "\"#<\"", "\"#>\"", "\"<<<\"",
+  "\">>>\"", "\"//\"", "\"%%\"", "'?'", "':'", "'<'", "'>'", "'!'", "'|'",
+  "'^'", "'&'", "'+'", "'-'", "'\\n'", "','", "'='", "'*'", "'.'", "'$'",
+  "'~'", "'('", "')'", "'/'", "'%'", "TOK_ARCH", "TOK_MNEM", "$accept",
+  "file", "line", "directive", "$@1", "$@2", "$@3", "$@4", "$@5", "$@6",
+  "repeat_directive", "macro_definition", "macro_definition_head",
+  "macro_definition_arguments", "section_directive", "comma_opt", "data",
+  "extern", "global", "common", "import", "export_head",
+  "export_directive", "export", "here", "prefix_expression_noparen",
+  "prefix_expression", "multiplication", "multiplicative_expression",
+  "operation_expression", "expression", "mnemonic", "instruction",
+  "mnemonic_operands", "operand", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-227)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-85)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -227,    23,  -227,   200,   -22,   200,   200,   -60,   -58,   -54,
+     -49,   -45,     4,    17,    27,    37,   200,    41,   200,    65,
+      87,   200,   200,    94,   200,   200,    -6,    70,  -227,  -227,
+    -227,  -227,  -227,   -29,  -227,  -227,  -227,  -227,  -227,   144,
+     -20,   -63,    -9,    24,    31,    46,    -5,   105,    48,   107,
+     -14,   167,  -227,    52,   101,   153,   154,  -227,  -227,  -227,
+    -227,  -227,  -227,   200,   200,   200,   200,   200,  -227,  -227,
+    -227,  -227,    53,  -227,   379,   200,   899,   493,  -227,  -227,
+    -227,  -227,  -227,   111,   112,    62,  -227,   530,  -227,   567,
+     156,  -227,   604,   455,  -227,   641,   417,   200,  -227,   200,
+    -227,  -227,   114,   115,  -227,  -227,   160,  -227,   161,  -227,
+     200,  -227,   162,  -227,   163,  -227,   165,  -227,   166,   172,
+    -227,   200,   200,  -227,   899,  -227,  -227,   200,   200,  -227,
+    -227,  -227,  -227,  -227,  -227,   289,   200,   200,   200,   200,
+     200,   200,   200,   200,   200,   200,   200,   200,   200,   200,
+     200,   200,   200,   200,   200,   200,   200,   200,   200,   200,
+     200,   200,   200,   200,   200,   200,   200,   200,   200,   200,
+     200,   200,   200,  -227,   118,   899,  -227,  -227,   200,   174,
+    -227,  -227,  -227,    98,  -227,   177,  -227,  -227,   122,   678,
+     715,  -227,  -227,  -227,   133,   899,  -227,  -227,   134,   135,
+     136,   752,   789,  -227,   244,  -227,  -227,  -227,  -227,  -227,
+    -227,  -227,  -227,  -227,  -227,  1006,    18,    18,    18,    18,
+      18,    18,    18,    18,    18,   935,   971,    18,    18,    18,
+      18,    18,    18,    18,   863,    18,    18,     3,     3,    39,
+      59,  -227,  -227,   208,   128,   826,  -227,  -227,  -227,  -227,
+     208,   128,  -227,  -227,   103,   108,   110,   141,  -227,  -227,
+     200,  -227,   200,   102,  -227,  -227,   104,  -227,  -227,  -227,
+    -227,  -227,  -227,  -227,  -227,  -227,   334,   899,  -227,  -227,
+    -227
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       2,     0,     1,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     8,     4,
+      85,    86,    87,     0,   147,     3,     5,    23,    45,    49,
+      50,    58,     0,     0,     0,    58,     0,    83,    58,     0,
+       0,     0,     7,     0,     0,     0,     0,    88,    92,    90,
+      91,    93,    96,     0,     0,     0,     0,     0,    95,   103,
+     114,   115,   144,   145,     0,     0,    60,     0,    30,    27,
+      31,    25,    22,     0,     0,    73,    62,     0,    64,     0,
+       0,    51,     0,    47,    54,     0,     0,     0,    38,     0,
+      39,   146,     0,     0,    52,    59,     0,     9,     0,     6,
+       0,    40,     0,    41,     0,    42,     0,    43,     0,     0,
+      44,     0,     0,   148,   152,   150,   149,     0,     0,    94,
+      89,   100,    97,    98,    99,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    16,    17,    66,    29,    37,     0,    74,
+      75,    26,    28,    70,    15,     0,    32,    21,    33,     0,
+       0,    24,    46,    53,    55,    61,    63,    65,    67,    77,
+      78,     0,     0,   151,     0,   104,   110,   112,   111,   113,
+     107,   109,   105,   106,   108,   140,   132,   122,   130,   131,
+     128,   129,   123,   124,   125,   142,   141,   139,   137,   138,
+     135,   136,   133,   134,     0,   126,   127,   121,   119,   120,
+     118,   116,   117,     0,     0,     0,    76,    71,    72,    48,
+       0,     0,    11,    12,     0,     0,     0,     0,    13,    14,
+       0,   101,     0,     0,    20,    10,     0,    36,    56,    57,
+      68,    69,    79,    81,    80,    82,     0,   143,    18,    34,
+     102
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -227,  -227,  -227,  -227,  -227,  -227,  -227,  -227,  -227,  -227,
+    -227,  -227,  -227,  -227,  -227,    15,  -226,  -227,  -227,  -227,
+    -227,  -227,  -227,  -227,   214,  -227,   -59,  -227,  -227,  -227,
+      -3,  -227,  -183,  -227,    90
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,     1,    35,    36,   243,   244,   102,   250,   251,   103,
+      37,    38,    39,    40,    41,   106,    42,    43,    44,    45,
+      46,    47,    48,    49,    68,    69,    70,    71,    72,    73,
+     124,    51,    52,    53,   125
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      74,   121,    76,    77,   131,   132,   133,   134,    75,    97,
+     -58,   107,   105,    87,    78,    89,    79,   263,    92,    93,
+      80,    95,    96,     2,   266,    81,     3,     4,     5,    82,
+       6,     7,     8,     9,    83,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,   101,    20,    84,    21,    22,
+      23,    24,    25,    26,    27,   105,   108,    85,    28,    98,
+     116,   264,   122,   119,   135,   109,   110,    86,   267,   117,
+      99,    88,   175,   169,   170,   171,   172,   206,   207,   208,
+     209,   210,   211,   212,   213,   214,   167,   168,   169,   170,
+     171,   172,   179,   180,   189,    90,   190,    29,   111,   112,
+      30,    31,    32,   136,   137,   113,   114,   195,    33,    34,
+     170,   171,   172,   138,   139,   140,   141,    91,   201,   202,
+     115,   105,   -84,   105,    94,   204,   126,   127,   247,   248,
+     142,   171,   172,   268,   269,   100,   143,   144,   270,   271,
+     272,   273,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+      54,   274,   275,    55,   104,   245,   278,   110,   279,   110,
+     118,   120,   128,   129,   130,   177,   183,   178,   191,   192,
+     193,   194,   196,   197,    56,   198,   199,    57,    58,    59,
+      60,    61,   200,    54,   -19,   246,    55,   249,   -35,   254,
+     255,   256,   257,     5,    34,    50,    62,   203,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    56,     0,     0,
+      57,    58,    59,    60,    61,    63,     0,     0,     0,    64,
+      65,   123,     0,     0,    30,    31,    32,    66,    67,    62,
+       0,     0,     0,     0,     0,     0,     0,   276,     0,   277,
+       0,     0,     0,     0,     0,     0,     0,     0,    63,     0,
+       0,     0,    64,    65,     0,     0,     0,    30,    31,    32,
+      66,    67,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,   161,   162,   163,     0,     0,     0,     0,   164,     0,
+     165,   166,   167,   168,   169,   170,   171,   172,     0,   260,
+       0,     0,     0,     0,     0,     0,   261,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,   161,   162,   163,     0,
+       0,     0,     0,   164,     0,   165,   166,   167,   168,   169,
+     170,   171,   172,     0,     0,     0,     0,     0,     0,     0,
+       0,   205,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,   161,   162,   163,     0,     0,     0,     0,   164,     0,
+     165,   166,   167,   168,   169,   170,   171,   172,     0,     0,
+       0,     0,     0,     0,     0,     0,   280,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,   161,   162,   163,     0,
+       0,     0,     0,   164,     0,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,   174,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,     0,   156,
+     157,   158,   159,   160,   161,   162,   163,     0,     0,     0,
+       0,   164,     0,   165,   166,   167,   168,   169,   170,   171,
+     172,   187,   188,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,     0,     0,     0,   156,   157,   158,
+     159,   160,   161,   162,   163,     0,     0,     0,     0,   164,
+       0,   165,   166,   167,   168,   169,   170,   171,   172,     0,
+     185,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,     0,     0,     0,   156,   157,   158,   159,   160,
+     161,   162,   163,     0,     0,     0,     0,   164,     0,   165,
+     166,   167,   168,   169,   170,   171,   172,   176,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,     0,
+       0,     0,   156,   157,   158,   159,   160,   161,   162,   163,
+       0,     0,     0,     0,   164,     0,   165,   166,   167,   168,
+     169,   170,   171,   172,   181,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,     0,   156,
+     157,   158,   159,   160,   161,   162,   163,     0,     0,     0,
+       0,   164,     0,   165,   166,   167,   168,   169,   170,   171,
+     172,   182,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,   161,   162,   163,     0,     0,     0,     0,   164,     0,
+     165,   166,   167,   168,   169,   170,   171,   172,   184,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+       0,     0,     0,   156,   157,   158,   159,   160,   161,   162,
+     163,     0,     0,     0,     0,   164,     0,   165,   166,   167,
+     168,   169,   170,   171,   172,   186,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,     0,     0,     0,
+     156,   157,   158,   159,   160,   161,   162,   163,     0,     0,
+       0,     0,   164,     0,   165,   166,   167,   168,   169,   170,
+     171,   172,   252,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,     0,     0,     0,   156,   157,   158,
+     159,   160,   161,   162,   163,     0,     0,     0,     0,   164,
+       0,   165,   166,   167,   168,   169,   170,   171,   172,   253,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,     0,     0,     0,   156,   157,   158,   159,   160,   161,
+     162,   163,     0,     0,     0,     0,   164,     0,   165,   166,
+     167,   168,   169,   170,   171,   172,   258,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,   161,   162,   163,     0,
+       0,     0,     0,   164,     0,   165,   166,   167,   168,   169,
+     170,   171,   172,   259,   145,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,     0,     0,     0,   156,   157,
+     158,   159,   160,   161,   162,   163,     0,     0,     0,     0,
+     164,     0,   165,   166,   167,   168,   169,   170,   171,   172,
+     265,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,     0,     0,     0,   156,   157,   158,   159,   160,
+     161,   162,   163,     0,     0,     0,     0,   164,   262,   165,
+     166,   167,   168,   169,   170,   171,   172,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,   161,   162,   163,     0,
+       0,     0,     0,   164,     0,   165,   166,   167,   168,   169,
+     170,   171,   172,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,     0,     0,     0,     0,   156,   157,   158,
+     159,   160,   161,   162,   163,     0,     0,     0,     0,     0,
+       0,   165,   166,   167,   168,   169,   170,   171,   172,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,     0,
+       0,     0,     0,     0,   157,   158,   159,   160,   161,   162,
+     163,     0,     0,     0,     0,     0,     0,   165,   166,   167,
+     168,   169,   170,   171,   172,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,     0,     0,     0,     0,     0,   157,
+     158,   159,   160,   161,   162,   163,     0,     0,     0,     0,
+       0,     0,   165,   166,   167,   168,   169,   170,   171,   172
+};
+
+static const yytype_int16 yycheck[] =
+{
+       3,    15,     5,     6,    63,    64,    65,    66,    30,    15,
+      30,    74,    75,    16,    74,    18,    74,   243,    21,    22,
+      74,    24,    25,     0,   250,    74,     3,     4,     5,    74,
+       7,     8,     9,    10,    30,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    74,    23,    30,    25,    26,
+      27,    28,    29,    30,    31,    75,    41,    30,    35,    65,
+      45,   244,    76,    48,    67,    74,    75,    30,   251,    74,
+      76,    30,    75,    70,    71,    72,    73,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,    68,    69,    70,    71,
+      72,    73,    30,    31,    97,    30,    99,    74,    74,    75,
+      77,    78,    79,    50,    51,    74,    75,   110,    85,    86,
+      71,    72,    73,    60,    61,    62,    63,    30,   121,   122,
+      74,    75,    74,    75,    30,   128,    74,    75,    30,    31,
+      77,    72,    73,    30,    31,    65,    83,    84,    30,    31,
+      30,    31,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+       3,    30,    31,     6,    30,   178,    74,    75,    74,    75,
+      75,    74,    81,    30,    30,    74,    30,    75,    74,    74,
+      30,    30,    30,    30,    27,    30,    30,    30,    31,    32,
+      33,    34,    30,     3,    86,    31,     6,    30,    86,    76,
+      76,    76,    76,     5,    86,     1,    49,   127,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    27,    -1,    -1,
+      30,    31,    32,    33,    34,    68,    -1,    -1,    -1,    72,
+      73,    74,    -1,    -1,    77,    78,    79,    80,    81,    49,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   260,    -1,   262,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,    -1,
+      -1,    -1,    72,    73,    -1,    -1,    -1,    77,    78,    79,
+      80,    81,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    73,    -1,    75,
+      -1,    -1,    -1,    -1,    -1,    -1,    82,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    -1,
+      -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,    70,
+      71,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    82,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    73,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    82,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    -1,
+      -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    -1,    -1,    -1,
+      -1,    64,    -1,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,
+      -1,    66,    67,    68,    69,    70,    71,    72,    73,    -1,
+      75,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      -1,    -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    -1,    -1,    -1,
+      -1,    64,    -1,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,
+      -1,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    -1,
+      -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,
+      64,    -1,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    -1,    -1,    -1,    -1,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    -1,
+      -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,    70,
+      71,    72,    73,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    -1,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,    -1,
+      -1,    66,    67,    68,    69,    70,    71,    72,    73,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
+      -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    -1,    -1,    -1,    -1,    -1,    -1,    66,    67,    68,
+      69,    70,    71,    72,    73,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    -1,    -1,    -1,    -1,    -1,    53,
+      54,    55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,
+      -1,    -1,    66,    67,    68,    69,    70,    71,    72,    73
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,    88,     0,     3,     4,     5,     7,     8,     9,    10,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      23,    25,    26,    27,    28,    29,    30,    31,    35,    74,
+      77,    78,    79,    85,    86,    89,    90,    97,    98,    99,
+     100,   101,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   118,   119,   120,     3,     6,    27,    30,    31,    32,
+      33,    34,    49,    68,    72,    73,    80,    81,   111,   112,
+     113,   114,   115,   116,   117,    30,   117,   117,    74,    74,
+      74,    74,    74,    30,    30,    30,    30,   117,    30,   117,
+      30,    30,   117,   117,    30,   117,   117,    15,    65,    76,
+      65,    74,    93,    96,    30,    75,   102,    74,   102,    74,
+      75,    74,    75,    74,    75,    74,   102,    74,    75,   102,
+      74,    15,    76,    74,   117,   121,    74,    75,    81,    30,
+      30,   113,   113,   113,   113,   117,    50,    51,    60,    61,
+      62,    63,    77,    83,    84,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    52,    53,    54,    55,
+      56,    57,    58,    59,    64,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,   117,    74,    74,    75,    30,
+      31,    74,    74,    30,    74,    75,    74,    74,    75,   117,
+     117,    74,    74,    30,    30,   117,    30,    30,    30,    30,
+      30,   117,   117,   121,   117,    82,   113,   113,   113,   113,
+     113,   113,   113,   113,   113,   117,   117,   117,   117,   117,
+     117,   117,   117,   117,   117,   117,   117,   117,   117,   117,
+     117,   117,   117,   117,   117,   117,   117,   117,   117,   117,
+     117,   117,   117,    91,    92,   117,    31,    30,    31,    30,
+      94,    95,    74,    74,    76,    76,    76,    76,    74,    74,
+      75,    82,    65,   103,   119,    74,   103,   119,    30,    31,
+      30,    31,    30,    31,    30,    31,   117,   117,    74,    74,
+      82
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    87,    88,    88,    89,    89,    89,    89,    89,    90,
+      90,    90,    90,    90,    90,    90,    90,    91,    90,    92,
+      90,    90,    90,    93,    90,    90,    90,    90,    90,    90,
+      90,    90,    90,    94,    90,    95,    90,    90,    90,    90,
+      90,    90,    90,    90,    90,    96,    90,    97,    97,    98,
+      98,    99,   100,   100,   101,   101,   101,   101,   102,   102,
+     103,   103,   104,   104,   105,   105,   106,   106,   106,   106,
+     107,   107,   107,   108,   108,   108,   108,   109,   109,   109,
+     109,   109,   109,   110,   110,   111,   111,   111,   112,   112,
+     112,   112,   112,   112,   112,   112,   112,   112,   112,   112,
+     112,   112,   112,   113,   113,   114,   114,   114,   114,   114,
+     114,   114,   114,   114,   115,   115,   116,   116,   116,   116,
+     116,   116,   116,   116,   116,   116,   116,   116,   116,   116,
+     116,   116,   116,   116,   116,   116,   116,   116,   116,   116,
+     116,   116,   116,   116,   117,   117,    90,   118,   119,   119,
+     120,   120,   121
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     1,     1,     2,     1,     1,     2,
+       5,     4,     4,     4,     4,     3,     3,     0,     6,     0,
+       5,     3,     2,     0,     3,     2,     3,     2,     3,     3,
+       2,     2,     3,     0,     6,     0,     5,     3,     2,     2,
+       2,     2,     2,     2,     2,     0,     3,     2,     4,     1,
+       1,     2,     2,     3,     2,     3,     5,     5,     0,     1,
+       2,     3,     2,     3,     2,     3,     3,     3,     5,     5,
+       3,     4,     4,     2,     3,     3,     4,     3,     3,     5,
+       5,     5,     5,     1,     1,     1,     1,     1,     1,     2,
+       1,     1,     1,     1,     2,     1,     1,     2,     2,     2,
+       2,     4,     6,     1,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     1,     1,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     5,     1,     1,     2,     1,     2,     2,
+       2,     3,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 4: /* line: '\n'  */
+#line 122 "../i4/../parser.y"
+                {
+			advance_line();
+		}
+#line 1570 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 6: /* line: data '\n'  */
+#line 127 "../i4/../parser.y"
+                {
+			advance_line();
+		}
+#line 1578 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 8: /* line: TOK_MACRONAME  */
+#line 132 "../i4/../parser.y"
+                {
+			invoke_macro((yyvsp[0].macro));
+			advance_line();
+		}
+#line 1587 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 9: /* directive: section_directive '\n'  */
+#line 140 "../i4/../parser.y"
+                {
+			advance_line();
+		}
+#line 1595 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 10: /* directive: KWD_EQU TOK_IDENTIFIER ',' expression '\n'  */
+#line 144 "../i4/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-3].s), (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-3].s), (yyvsp[-1].x));
+			advance_line();
+		}
+#line 1606 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 11: /* directive: TOK_IDENTIFIER KWD_EQU expression '\n'  */
+#line 151 "../i4/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-3].s), (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-3].s), (yyvsp[-1].x));
+			advance_line();
+		}
+#line 1617 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 12: /* directive: TOK_IDENTIFIER '=' expression '\n'  */
+#line 158 "../i4/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-3].s), (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-3].s), (yyvsp[-1].x));
+			advance_line();
+		}
+#line 1628 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 13: /* directive: here KWD_EQU expression '\n'  */
+#line 165 "../i4/../parser.y"
+                {
+			instruction_make_set_location(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1638 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 14: /* directive: here '=' expression '\n'  */
+#line 171 "../i4/../parser.y"
+                {
+			instruction_make_set_location(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1648 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 15: /* directive: KWD_ORG expression '\n'  */
+#line 177 "../i4/../parser.y"
+                {
+			instruction_make_set_location(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1658 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 16: /* directive: KWD_ALIGN expression '\n'  */
+#line 183 "../i4/../parser.y"
+                {
+			instruction_make_skip(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, (yyvsp[-1].x),
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1676 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 17: /* $@1: %empty  */
+#line 197 "../i4/../parser.y"
+                {
+			instruction_make_fill(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, (yyvsp[-1].x),
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1693 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 18: /* directive: KWD_ALIGN expression ',' $@1 data '\n'  */
+#line 210 "../i4/../parser.y"
+                {
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1703 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 19: /* $@2: %empty  */
+#line 216 "../i4/../parser.y"
+                {
+			instruction_make_fill(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, (yyvsp[-1].x),
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1720 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 20: /* directive: KWD_ALIGN expression ',' $@2 instruction  */
+#line 229 "../i4/../parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1731 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 21: /* directive: KWD_TIMES expression '\n'  */
+#line 236 "../i4/../parser.y"
+                {
+			instruction_make_times(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1741 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 22: /* directive: KWD_ENDTIMES '\n'  */
+#line 242 "../i4/../parser.y"
+                {
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1751 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 23: /* $@3: %empty  */
+#line 248 "../i4/../parser.y"
+                {
+			parse_repeat_definition();
+		}
+#line 1759 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 24: /* directive: repeat_directive $@3 '\n'  */
+#line 252 "../i4/../parser.y"
+                {
+			advance_line();
+		}
+#line 1767 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 25: /* directive: KWD_ENDREPEAT '\n'  */
+#line 256 "../i4/../parser.y"
+                {
+			yyerror("no matching .repeat found for .endrepeat");
+			YYABORT;
+		}
+#line 1776 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 26: /* directive: KWD_FILL expression '\n'  */
+#line 261 "../i4/../parser.y"
+                {
+			instruction_make_fill(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1786 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 27: /* directive: KWD_ENDFILL '\n'  */
+#line 267 "../i4/../parser.y"
+                {
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1796 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 28: /* directive: KWD_IF expression '\n'  */
+#line 273 "../i4/../parser.y"
+                {
+			handle_if_directive((yyvsp[-1].x));
+			// TODO: optionally delete $2
+			advance_line();
+		}
+#line 1806 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 29: /* directive: KWD_ELSE_IF expression '\n'  */
+#line 279 "../i4/../parser.y"
+                {
+			handle_else_if_directive((yyvsp[-1].x));
+			// TODO: optionally delete $2
+			advance_line();
+		}
+#line 1816 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 30: /* directive: KWD_ELSE '\n'  */
+#line 285 "../i4/../parser.y"
+                {
+			handle_else_directive();
+			advance_line();
+		}
+#line 1825 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 31: /* directive: KWD_ENDIF '\n'  */
+#line 290 "../i4/../parser.y"
+                {
+			handle_end_if_directive();
+			advance_line();
+		}
+#line 1834 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 32: /* directive: KWD_SKIP expression '\n'  */
+#line 295 "../i4/../parser.y"
+                {
+			instruction_make_skip(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1844 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 33: /* $@4: %empty  */
+#line 301 "../i4/../parser.y"
+                {
+			instruction_make_times(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1853 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 34: /* directive: KWD_TIMES expression ',' $@4 data '\n'  */
+#line 306 "../i4/../parser.y"
+                {
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1863 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 35: /* $@5: %empty  */
+#line 312 "../i4/../parser.y"
+                {
+			instruction_make_times(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1872 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 36: /* directive: KWD_TIMES expression ',' $@5 instruction  */
+#line 317 "../i4/../parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1883 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 37: /* directive: KWD_ENTRY TOK_IDENTIFIER '\n'  */
+#line 324 "../i4/../parser.y"
+                {
+			if(entry_point_name == NULL)
+			{
+				entry_point_name = (yyvsp[-1].s);
+			}
+			else
+			{
+				yyerror("Error: repeated .entry directive\n");
+				if(!is_replacement)
+					free((yyvsp[-1].s));
+			}
+			advance_line();
+		}
+#line 1901 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 38: /* directive: TOK_IDENTIFIER ':'  */
+#line 338 "../i4/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-1].s), expression_current_location());
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-1].s), expression_current_location());
+		}
+#line 1911 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 39: /* directive: TOK_INTEGER ':'  */
+#line 344 "../i4/../parser.y"
+                {
+			instruction_make_local_label(&current_instruction, current_parser_state, (yyvsp[-1].j));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete((yyvsp[-1].j));
+		}
+#line 1922 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 40: /* directive: extern '\n'  */
+#line 351 "../i4/../parser.y"
+                {
+			advance_line();
+		}
+#line 1930 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 41: /* directive: global '\n'  */
+#line 355 "../i4/../parser.y"
+                {
+			advance_line();
+		}
+#line 1938 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 42: /* directive: common '\n'  */
+#line 359 "../i4/../parser.y"
+                {
+			advance_line();
+		}
+#line 1946 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 43: /* directive: import '\n'  */
+#line 363 "../i4/../parser.y"
+                {
+			advance_line();
+		}
+#line 1954 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 44: /* directive: export '\n'  */
+#line 367 "../i4/../parser.y"
+                {
+			advance_line();
+		}
+#line 1962 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 45: /* $@6: %empty  */
+#line 371 "../i4/../parser.y"
+                {
+			parse_macro_definition();
+		}
+#line 1970 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 46: /* directive: macro_definition $@6 '\n'  */
+#line 375 "../i4/../parser.y"
+                {
+			advance_line();
+		}
+#line 1978 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 47: /* repeat_directive: KWD_REPEAT expression  */
+#line 382 "../i4/../parser.y"
+                {
+			if(!begin_repeat_definition((yyvsp[0].x), NULL))
+				YYABORT;
+		}
+#line 1987 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 48: /* repeat_directive: KWD_REPEAT expression ',' TOK_IDENTIFIER  */
+#line 387 "../i4/../parser.y"
+                {
+			if(!begin_repeat_definition((yyvsp[-2].x), (yyvsp[0].s)))
+				YYABORT;
+		}
+#line 1996 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 51: /* macro_definition_head: KWD_MACRO TOK_IDENTIFIER  */
+#line 400 "../i4/../parser.y"
+                {
+			begin_macro_definition((yyvsp[0].s));
+		}
+#line 2004 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 52: /* macro_definition_arguments: macro_definition_head TOK_IDENTIFIER  */
+#line 407 "../i4/../parser.y"
+                {
+			append_macro_definition_parameter((yyvsp[0].s));
+		}
+#line 2012 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 53: /* macro_definition_arguments: macro_definition_arguments comma_opt TOK_IDENTIFIER  */
+#line 411 "../i4/../parser.y"
+                {
+			append_macro_definition_parameter((yyvsp[0].s));
+		}
+#line 2020 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 54: /* section_directive: KWD_SECTION TOK_IDENTIFIER  */
+#line 418 "../i4/../parser.y"
+                {
+			instruction_make_section(&current_instruction, current_parser_state, (yyvsp[0].s));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2029 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 55: /* section_directive: section_directive comma_opt TOK_IDENTIFIER  */
+#line 423 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[1].parameter, expression_identifier((yyvsp[0].s)));
+		}
+#line 2037 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 56: /* section_directive: section_directive comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 427 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[1].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+		}
+#line 2048 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 57: /* section_directive: section_directive comma_opt TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 434 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[1].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+		}
+#line 2059 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 60: /* data: TOK_DATA expression  */
+#line 449 "../i4/../parser.y"
+                {
+			instruction_make_data(&current_instruction, current_parser_state, (yyvsp[-1].i), (yyvsp[0].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			(yyval.i) = (yyvsp[-1].i);
+		}
+#line 2069 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 61: /* data: data ',' expression  */
+#line 455 "../i4/../parser.y"
+                {
+			instruction_make_data(&current_instruction, current_parser_state, (yyvsp[-2].i), (yyvsp[0].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			(yyval.i) = (yyvsp[-2].i);
+		}
+#line 2079 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 62: /* extern: KWD_EXTERN TOK_IDENTIFIER  */
+#line 464 "../i4/../parser.y"
+                {
+			instruction_make_external(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2088 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 63: /* extern: extern ',' TOK_IDENTIFIER  */
+#line 469 "../i4/../parser.y"
+                {
+			instruction_make_external(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2097 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 64: /* global: KWD_GLOBAL TOK_IDENTIFIER  */
+#line 477 "../i4/../parser.y"
+                {
+			instruction_make_global(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2106 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 65: /* global: global ',' TOK_IDENTIFIER  */
+#line 482 "../i4/../parser.y"
+                {
+			instruction_make_global(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2115 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 66: /* common: KWD_COMMON TOK_IDENTIFIER expression  */
+#line 490 "../i4/../parser.y"
+                {
+			instruction_make_common(&current_instruction, current_parser_state, (yyvsp[-1].s), (yyvsp[0].x));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2124 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 67: /* common: common comma_opt TOK_IDENTIFIER  */
+#line 495 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[2].parameter, expression_identifier((yyvsp[0].s)));
+			(yyval.ins) = (yyvsp[-2].ins);
+		}
+#line 2133 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 68: /* common: common comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 500 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[2].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2145 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 69: /* common: common comma_opt TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 508 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[2].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2157 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 70: /* import: KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER  */
+#line 519 "../i4/../parser.y"
+                {
+			instruction_make_import(&current_instruction, current_parser_state, (yyvsp[-1].s), (yyvsp[0].s), NULL);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2166 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 71: /* import: KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_IDENTIFIER  */
+#line 524 "../i4/../parser.y"
+                {
+			instruction_make_import(&current_instruction, current_parser_state, (yyvsp[-2].s), (yyvsp[-1].s), expression_identifier((yyvsp[0].s)));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2175 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 72: /* import: KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_INTEGER  */
+#line 529 "../i4/../parser.y"
+                {
+			instruction_make_import(&current_instruction, current_parser_state, (yyvsp[-2].s), (yyvsp[-1].s), expression_integer((yyvsp[0].j)));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2184 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 73: /* export_head: KWD_EXPORT TOK_IDENTIFIER  */
+#line 537 "../i4/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[0].s), NULL, NO_ORDINAL);
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2193 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 74: /* export_head: KWD_EXPORT TOK_IDENTIFIER TOK_IDENTIFIER  */
+#line 542 "../i4/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[-1].s), (yyvsp[0].s), NO_ORDINAL);
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2202 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 75: /* export_head: KWD_EXPORT TOK_IDENTIFIER TOK_INTEGER  */
+#line 547 "../i4/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[-1].s), NULL, (yyvsp[0].j));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2213 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 76: /* export_head: KWD_EXPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_INTEGER  */
+#line 554 "../i4/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[-2].s), (yyvsp[-1].s), (yyvsp[0].j));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2224 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 77: /* export_directive: export_head ',' TOK_IDENTIFIER  */
+#line 564 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[3].parameter, expression_identifier((yyvsp[0].s)));
+			(yyval.ins) = (yyvsp[-2].ins);
+		}
+#line 2233 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 78: /* export_directive: export_directive comma_opt TOK_IDENTIFIER  */
+#line 569 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[3].parameter, expression_identifier((yyvsp[0].s)));
+			(yyval.ins) = (yyvsp[-2].ins);
+		}
+#line 2242 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 79: /* export_directive: export_head ',' TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 574 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2254 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 80: /* export_directive: export_directive comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 582 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2266 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 81: /* export_directive: export_head ',' TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 590 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2278 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 82: /* export_directive: export_directive comma_opt TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 598 "../i4/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2290 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 88: /* prefix_expression_noparen: TOK_IDENTIFIER  */
+#line 620 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_identifier((yyvsp[0].s));
+		}
+#line 2298 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 89: /* prefix_expression_noparen: KWD_SECTION TOK_IDENTIFIER  */
+#line 624 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_section((yyvsp[0].s));
+		}
+#line 2306 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 90: /* prefix_expression_noparen: TOK_LABEL_FORWARD  */
+#line 628 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_label_forward((yyvsp[0].j));
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2316 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 91: /* prefix_expression_noparen: TOK_LABEL_BACKWARD  */
+#line 634 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_label_backward((yyvsp[0].j));
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2326 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 92: /* prefix_expression_noparen: TOK_INTEGER  */
+#line 640 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_integer((yyvsp[0].j));
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2336 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 93: /* prefix_expression_noparen: TOK_STRING  */
+#line 646 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_string((yyvsp[0].s));
+		}
+#line 2344 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 94: /* prefix_expression_noparen: KWD_DEFINED TOK_IDENTIFIER  */
+#line 650 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_is_defined((yyvsp[0].s));
+		}
+#line 2352 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 95: /* prefix_expression_noparen: here  */
+#line 654 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_current_location();
+		}
+#line 2360 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 96: /* prefix_expression_noparen: "$$"  */
+#line 658 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_current_section();
+		}
+#line 2368 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 97: /* prefix_expression_noparen: '+' prefix_expression  */
+#line 662 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_PLUS, (yyvsp[0].x));
+		}
+#line 2376 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 98: /* prefix_expression_noparen: '-' prefix_expression  */
+#line 666 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_MINUS, (yyvsp[0].x));
+		}
+#line 2384 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 99: /* prefix_expression_noparen: '~' prefix_expression  */
+#line 670 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_BITNOT, (yyvsp[0].x));
+		}
+#line 2392 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 100: /* prefix_expression_noparen: '!' prefix_expression  */
+#line 674 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_NOT, (yyvsp[0].x));
+		}
+#line 2400 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 101: /* prefix_expression_noparen: KWD_ALIGN '(' expression ')'  */
+#line 678 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_ALIGN, (yyvsp[-1].x), expression_current_location());
+		}
+#line 2408 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 102: /* prefix_expression_noparen: KWD_ALIGN '(' expression ',' expression ')'  */
+#line 682 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_ALIGN, (yyvsp[-3].x), (yyvsp[-1].x));
+		}
+#line 2416 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 104: /* prefix_expression: '(' expression ')'  */
+#line 690 "../i4/../parser.y"
+                {
+			(yyval.x) = (yyvsp[-1].x);
+		}
+#line 2424 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 105: /* multiplication: multiplicative_expression '*' prefix_expression  */
+#line 697 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_MUL, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2432 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 106: /* multiplication: multiplicative_expression '/' prefix_expression  */
+#line 701 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_DIVU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2440 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 107: /* multiplication: multiplicative_expression "//" prefix_expression  */
+#line 705 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_DIV, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2448 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 108: /* multiplication: multiplicative_expression '%' prefix_expression  */
+#line 709 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_MODU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2456 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 109: /* multiplication: multiplicative_expression "%%" prefix_expression  */
+#line 713 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_MOD, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2464 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 110: /* multiplication: multiplicative_expression "<<" prefix_expression  */
+#line 717 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHLU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2472 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 111: /* multiplication: multiplicative_expression "<<<" prefix_expression  */
+#line 721 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHL, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2480 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 112: /* multiplication: multiplicative_expression ">>" prefix_expression  */
+#line 725 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHRU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2488 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 113: /* multiplication: multiplicative_expression ">>>" prefix_expression  */
+#line 729 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2496 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 116: /* operation_expression: expression '+' expression  */
+#line 765 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_ADD, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2504 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 117: /* operation_expression: expression '-' expression  */
+#line 769 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SUB, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2512 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 118: /* operation_expression: expression '&' expression  */
+#line 773 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITAND, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2520 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 119: /* operation_expression: expression '|' expression  */
+#line 777 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITOR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2528 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 120: /* operation_expression: expression '^' expression  */
+#line 781 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITXOR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2536 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 121: /* operation_expression: expression '!' expression  */
+#line 785 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITORNOT, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2544 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 122: /* operation_expression: expression "==" expression  */
+#line 789 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_EQ, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2552 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 123: /* operation_expression: expression "!=" expression  */
+#line 793 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_NE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2560 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 124: /* operation_expression: expression "<>" expression  */
+#line 797 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_NE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2568 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 125: /* operation_expression: expression "><" expression  */
+#line 801 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_NE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2576 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 126: /* operation_expression: expression '<' expression  */
+#line 805 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LT, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2584 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 127: /* operation_expression: expression '>' expression  */
+#line 809 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GT, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2592 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 128: /* operation_expression: expression "<=" expression  */
+#line 813 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2600 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 129: /* operation_expression: expression "=<" expression  */
+#line 817 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2608 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 130: /* operation_expression: expression ">=" expression  */
+#line 821 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2616 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 131: /* operation_expression: expression "=>" expression  */
+#line 825 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2624 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 132: /* operation_expression: expression "<=>" expression  */
+#line 829 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_CMP, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2632 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 133: /* operation_expression: expression "#<" expression  */
+#line 833 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LTU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2640 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 134: /* operation_expression: expression "#>" expression  */
+#line 837 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GTU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2648 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 135: /* operation_expression: expression "#<=" expression  */
+#line 841 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2656 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 136: /* operation_expression: expression "#=<" expression  */
+#line 845 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2664 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 137: /* operation_expression: expression "#>=" expression  */
+#line 849 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2672 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 138: /* operation_expression: expression "#=>" expression  */
+#line 853 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2680 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 139: /* operation_expression: expression "#<=>" expression  */
+#line 857 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_CMPU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2688 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 140: /* operation_expression: expression "&&" expression  */
+#line 861 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_AND, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2696 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 141: /* operation_expression: expression "^^" expression  */
+#line 865 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_XOR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2704 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 142: /* operation_expression: expression "||" expression  */
+#line 869 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_OR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2712 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 143: /* operation_expression: expression '?' expression ':' expression  */
+#line 873 "../i4/../parser.y"
+                {
+			(yyval.x) = expression_conditional((yyvsp[-4].x), (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2720 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 146: /* directive: TOK_ARCH '\n'  */
+#line 24 "../i4/parser.y"
+                {
+			current_parser_state->cpu_type = (yyvsp[-1].i);
+			advance_line();
+		}
+#line 2729 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 147: /* mnemonic: TOK_MNEM  */
+#line 32 "../i4/parser.y"
+                {
+			instruction_clear(&current_instruction, current_parser_state);
+			current_instruction.mnemonic = (yyvsp[0].i);
+		}
+#line 2738 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 148: /* instruction: mnemonic '\n'  */
+#line 40 "../i4/parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2747 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 149: /* instruction: mnemonic_operands '\n'  */
+#line 45 "../i4/parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2756 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 150: /* mnemonic_operands: mnemonic operand  */
+#line 53 "../i4/parser.y"
+                {
+			current_instruction.operand_count ++;
+		}
+#line 2764 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 151: /* mnemonic_operands: mnemonic_operands ',' operand  */
+#line 57 "../i4/parser.y"
+                {
+			current_instruction.operand_count ++;
+		}
+#line 2772 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+  case 152: /* operand: expression  */
+#line 64 "../i4/parser.y"
+                {
+			operand_set_immediate(&current_operand, (yyvsp[0].x));
+		}
+#line 2780 "../../obj/i4/i4/parser.tab.c"
+    break;
+
+
+#line 2784 "../../obj/i4/i4/parser.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 69 "../i4/parser.y"
+
+#line 70 "../i4/parser.y"
+
+parser_state_t current_parser_state[1] =
+{
+	{
+		.line_number = 1,
+		.cpu_type = CPU_4040,
+		.stream =
+		{
+			.first_instruction = NULL,
+			.last_instruction = &current_parser_state->stream.first_instruction,
+		},
+	}
+};
+
+void instruction_clear(instruction_t * ins, parser_state_t * state)
+{
+	memset(ins, 0, sizeof(instruction_t));
+	ins->line_number = state->line_number;
+	ins->cpu = state->cpu_type;
+}
+
+void operand_set_immediate(operand_t * opd, expression_t * value)
+{
+	memset(opd, 0, sizeof(operand_t));
+	opd->parameter = value;
+}
+
+#line 889 "../i4/../parser.y"
+
+// changes whenever tokens are added, removed or reordered in the grammar of the target
+uint64_t parser_get_token_fingerprint(void)
+{
+	// FNV-1a over the terminal names and the mapping of token numbers to them
+	uint64_t hash = 0xCBF29CE484222325;
+	for(int symbol = 0; symbol < YYNTOKENS; symbol++)
+	{
+		for(const char * name = yytname[symbol]; ; name++)
+		{
+			hash ^= (uint8_t)*name;
+			hash *= 0x100000001B3;
+			if(*name == '\0')
+				break;
+		}
+	}
+	for(size_t token = 0; token < sizeof yytranslate / sizeof yytranslate[0]; token++)
+	{
+		hash ^= yytranslate[token];
+		hash *= 0x100000001B3;
+	}
+	return hash;
+}
+
+void yyerror(const char * s)
+{
+	const char * filename = preprocessor_get_current_filename();
+	if(filename != NULL)
+		fprintf(stderr, "Error in %s, line %ld: %s\n", filename, current_parser_state->line_number, s);
+	else
+		fprintf(stderr, "Error in line %ld: %s\n", current_parser_state->line_number, s);
+}
+
@@ -0,0 +1,3585 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 7 "../x65/../parser.y"
+
+#include <assert.h>
+#include <stdio.h>
+#include "../../../src/syntax.h"
+#include "../../../src/asm.h"
+
+typedef enum operand_type_t operand_type_t;
+typedef struct operand_t operand_t;
+
+extern int yylex(void);
+void yyerror(const char * s);
+
+#line 84 "../../obj/x65/x65/parser.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parser.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_KWD_ALIGN = 3,                  /* KWD_ALIGN  */
+  YYSYMBOL_KWD_COMMON = 4,                 /* KWD_COMMON  */
+  YYSYMBOL_TOK_DATA = 5,                   /* TOK_DATA  */
+  YYSYMBOL_KWD_DEFINED = 6,                /* KWD_DEFINED  */
+  YYSYMBOL_KWD_ELSE_IF = 7,                /* KWD_ELSE_IF  */
+  YYSYMBOL_KWD_ELSE = 8,                   /* KWD_ELSE  */
+  YYSYMBOL_KWD_ENDFILL = 9,                /* KWD_ENDFILL  */
+  YYSYMBOL_KWD_ENDIF = 10,                 /* KWD_ENDIF  */
+  YYSYMBOL_KWD_ENDMACRO = 11,              /* KWD_ENDMACRO  */
+  YYSYMBOL_KWD_ENDREPEAT = 12,             /* KWD_ENDREPEAT  */
+  YYSYMBOL_KWD_ENDTIMES = 13,              /* KWD_ENDTIMES  */
+  YYSYMBOL_KWD_ENTRY = 14,                 /* KWD_ENTRY  */
+  YYSYMBOL_KWD_EQU = 15,                   /* KWD_EQU  */
+  YYSYMBOL_KWD_EXPORT = 16,                /* KWD_EXPORT  */
+  YYSYMBOL_KWD_EXTERN = 17,                /* KWD_EXTERN  */
+  YYSYMBOL_KWD_FILL = 18,                  /* KWD_FILL  */
+  YYSYMBOL_KWD_GLOBAL = 19,                /* KWD_GLOBAL  */
+  YYSYMBOL_KWD_IF = 20,                    /* KWD_IF  */
+  YYSYMBOL_KWD_IMPORT = 21,                /* KWD_IMPORT  */
+  YYSYMBOL_KWD_INCLUDE = 22,               /* KWD_INCLUDE  */
+  YYSYMBOL_KWD_MACRO = 23,                 /* KWD_MACRO  */
+  YYSYMBOL_KWD_ONCE = 24,                  /* KWD_ONCE  */
+  YYSYMBOL_KWD_ORG = 25,                   /* KWD_ORG  */
+  YYSYMBOL_KWD_REPEAT = 26,                /* KWD_REPEAT  */
+  YYSYMBOL_KWD_SECTION = 27,               /* KWD_SECTION  */
+  YYSYMBOL_KWD_SKIP = 28,                  /* KWD_SKIP  */
+  YYSYMBOL_KWD_TIMES = 29,                 /* KWD_TIMES  */
+  YYSYMBOL_TOK_IDENTIFIER = 30,            /* TOK_IDENTIFIER  */
+  YYSYMBOL_TOK_INTEGER = 31,               /* TOK_INTEGER  */
+  YYSYMBOL_TOK_LABEL_FORWARD = 32,         /* TOK_LABEL_FORWARD  */
+  YYSYMBOL_TOK_LABEL_BACKWARD = 33,        /* TOK_LABEL_BACKWARD  */
+  YYSYMBOL_TOK_STRING = 34,                /* TOK_STRING  */
+  YYSYMBOL_TOK_MACRONAME = 35,             /* TOK_MACRONAME  */
+  YYSYMBOL_TOK_MACRO_PARAM = 36,           /* TOK_MACRO_PARAM  */
+  YYSYMBOL_TOK_REPEAT_COUNTER = 37,        /* TOK_REPEAT_COUNTER  */
+  YYSYMBOL_DEL_AND = 38,                   /* "&&"  */
+  YYSYMBOL_DEL_CMP = 39,                   /* "<=>"  */
+  YYSYMBOL_DEL_EQ = 40,                    /* "=="  */
+  YYSYMBOL_DEL_GE = 41,                    /* ">="  */
+  YYSYMBOL_DEL_GE1 = 42,                   /* "=>"  */
+  YYSYMBOL_DEL_LE = 43,                    /* "<="  */
+  YYSYMBOL_DEL_LE1 = 44,                   /* "=<"  */
+  YYSYMBOL_DEL_NE = 45,                    /* "!="  */
+  YYSYMBOL_DEL_NE1 = 46,                   /* "<>"  */
+  YYSYMBOL_DEL_NE2 = 47,                   /* "><"  */
+  YYSYMBOL_DEL_OR = 48,                    /* "||"  */
+  YYSYMBOL_DEL_SECT = 49,                  /* "$$"  */
+  YYSYMBOL_DEL_SHL = 50,                   /* "<<"  */
+  YYSYMBOL_DEL_SHR = 51,                   /* ">>"  */
+  YYSYMBOL_DEL_XOR = 52,                   /* "^^"  */
+  YYSYMBOL_DEL_CMP_U = 53,                 /* "#<=>"  */
+  YYSYMBOL_DEL_GE_U = 54,                  /* "#>="  */
+  YYSYMBOL_DEL_GE1_U = 55,                 /* "#=>"  */
+  YYSYMBOL_DEL_LE_U = 56,                  /* "#<="  */
+  YYSYMBOL_DEL_LE1_U = 57,                 /* "#=<"  */
+  YYSYMBOL_DEL_LT_U = 58,                  /* "#<"  */
+  YYSYMBOL_DEL_GT_U = 59,                  /* "#>"  */
+  YYSYMBOL_DEL_SHL_S = 60,                 /* "<<<"  */
+  YYSYMBOL_DEL_SHR_S = 61,                 /* ">>>"  */
+  YYSYMBOL_DEL_DIV_S = 62,                 /* "//"  */
+  YYSYMBOL_DEL_MOD_S = 63,                 /* "%%"  */
+  YYSYMBOL_64_ = 64,                       /* '?'  */
+  YYSYMBOL_65_ = 65,                       /* ':'  */
+  YYSYMBOL_66_ = 66,                       /* '<'  */
+  YYSYMBOL_67_ = 67,                       /* '>'  */
+  YYSYMBOL_68_ = 68,                       /* '!'  */
+  YYSYMBOL_69_ = 69,                       /* '|'  */
+  YYSYMBOL_70_ = 70,                       /* '^'  */
+  YYSYMBOL_71_ = 71,                       /* '&'  */
+  YYSYMBOL_72_ = 72,                       /* '+'  */
+  YYSYMBOL_73_ = 73,                       /* '-'  */
+  YYSYMBOL_74_n_ = 74,                     /* '\n'  */
+  YYSYMBOL_75_ = 75,                       /* ','  */
+  YYSYMBOL_76_ = 76,                       /* '='  */
+  YYSYMBOL_77_ = 77,                       /* '*'  */
+  YYSYMBOL_78_ = 78,                       /* '.'  */
+  YYSYMBOL_79_ = 79,                       /* '$'  */
+  YYSYMBOL_80_ = 80,                       /* '~'  */
+  YYSYMBOL_81_ = 81,                       /* '('  */
+  YYSYMBOL_82_ = 82,                       /* ')'  */
+  YYSYMBOL_83_ = 83,                       /* '/'  */
+  YYSYMBOL_84_ = 84,                       /* '%'  */
+  YYSYMBOL_TOK_ARCH = 85,                  /* TOK_ARCH  */
+  YYSYMBOL_KWD_WIDTH = 86,                 /* KWD_WIDTH  */
+  YYSYMBOL_KWD_LOW = 87,                   /* KWD_LOW  */
+  YYSYMBOL_KWD_HIGH = 88,                  /* KWD_HIGH  */
+  YYSYMBOL_KWD_ADDR = 89,                  /* KWD_ADDR  */
+  YYSYMBOL_KWD_BANK = 90,                  /* KWD_BANK  */
+  YYSYMBOL_TOK_AREG = 91,                  /* TOK_AREG  */
+  YYSYMBOL_TOK_SREG = 92,                  /* TOK_SREG  */
+  YYSYMBOL_TOK_XREG = 93,                  /* TOK_XREG  */
+  YYSYMBOL_TOK_YREG = 94,                  /* TOK_YREG  */
+  YYSYMBOL_TOK_ZREG = 95,                  /* TOK_ZREG  */
+  YYSYMBOL_TOK_MNEM = 96,                  /* TOK_MNEM  */
+  YYSYMBOL_97_ = 97,                       /* '#'  */
+  YYSYMBOL_98_ = 98,                       /* '['  */
+  YYSYMBOL_99_ = 99,                       /* ']'  */
+  YYSYMBOL_100_ = 100,                     /* '@'  */
+  YYSYMBOL_YYACCEPT = 101,                 /* $accept  */
+  YYSYMBOL_file = 102,                     /* file  */
+  YYSYMBOL_line = 103,                     /* line  */
+  YYSYMBOL_directive = 104,                /* directive  */
+  YYSYMBOL_105_1 = 105,                    /* $@1  */
+  YYSYMBOL_106_2 = 106,                    /* $@2  */
+  YYSYMBOL_107_3 = 107,                    /* $@3  */
+  YYSYMBOL_108_4 = 108,                    /* $@4  */
+  YYSYMBOL_109_5 = 109,                    /* $@5  */
+  YYSYMBOL_110_6 = 110,                    /* $@6  */
+  YYSYMBOL_repeat_directive = 111,         /* repeat_directive  */
+  YYSYMBOL_macro_definition = 112,         /* macro_definition  */
+  YYSYMBOL_macro_definition_head = 113,    /* macro_definition_head  */
+  YYSYMBOL_macro_definition_arguments = 114, /* macro_definition_arguments  */
+  YYSYMBOL_section_directive = 115,        /* section_directive  */
+  YYSYMBOL_comma_opt = 116,                /* comma_opt  */
+  YYSYMBOL_data = 117,                     /* data  */
+  YYSYMBOL_extern = 118,                   /* extern  */
+  YYSYMBOL_global = 119,                   /* global  */
+  YYSYMBOL_common = 120,                   /* common  */
+  YYSYMBOL_import = 121,                   /* import  */
+  YYSYMBOL_export_head = 122,              /* export_head  */
+  YYSYMBOL_export_directive = 123,         /* export_directive  */
+  YYSYMBOL_export = 124,                   /* export  */
+  YYSYMBOL_here = 125,                     /* here  */
+  YYSYMBOL_prefix_expression_noparen = 126, /* prefix_expression_noparen  */
+  YYSYMBOL_prefix_expression = 127,        /* prefix_expression  */
+  YYSYMBOL_multiplication = 128,           /* multiplication  */
+  YYSYMBOL_multiplicative_expression = 129, /* multiplicative_expression  */
+  YYSYMBOL_multiplicative_expression_noparen = 130, /* multiplicative_expression_noparen  */
+  YYSYMBOL_operation_expression = 131,     /* operation_expression  */
+  YYSYMBOL_expression = 132,               /* expression  */
+  YYSYMBOL_expression_noparen = 133,       /* expression_noparen  */
+  YYSYMBOL_134_7 = 134,                    /* $@7  */
+  YYSYMBOL_135_8 = 135,                    /* $@8  */
+  YYSYMBOL_width_declaration = 136,        /* width_declaration  */
+  YYSYMBOL_a_width = 137,                  /* a_width  */
+  YYSYMBOL_x_width = 138,                  /* x_width  */
+  YYSYMBOL_mnemonic = 139,                 /* mnemonic  */
+  YYSYMBOL_instruction = 140,              /* instruction  */
+  YYSYMBOL_operand = 141,                  /* operand  */
+  YYSYMBOL_address = 142,                  /* address  */
+  YYSYMBOL_sized_expression = 143          /* sized_expression  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+/* Second part of user prologue.  */
+#line 4 "../x65/parser.y"
+
+#include "../../../src/x65/isa.h"
+
+void operand_set(operand_t * opd, operand_type_t type);
+void operand_set_immediate(operand_t * opd, expression_t * value);
+void operand_set_memory(operand_t * opd);
+
+parser_state_t current_parser_state[1];
+extern instruction_t current_instruction;
+#define current_operand (current_instruction.operand[current_instruction.operand_count])
+#define current_instruction_stream (&current_parser_state->stream)
+
+#line 274 "../../obj/x65/x65/parser.tab.c"
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  2
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1337
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  101
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  43
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  195
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  357
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   330
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+      74,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    68,     2,    97,    79,    84,    71,     2,
+      81,    82,    77,    72,    75,    73,    78,    83,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    65,     2,
+      66,    76,    67,    64,   100,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    98,     2,    99,    70,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,    69,     2,    80,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   116,   116,   117,   121,   125,   126,   130,   131,   139,
+     143,   150,   157,   164,   170,   176,   182,   197,   196,   216,
+     215,   235,   241,   248,   247,   255,   260,   266,   272,   278,
+     284,   289,   294,   301,   300,   312,   311,   323,   337,   343,
+     350,   354,   358,   362,   366,   371,   370,   381,   386,   394,
+     395,   399,   406,   410,   417,   422,   426,   433,   443,   444,
+     448,   454,   463,   468,   476,   481,   489,   494,   499,   507,
+     518,   523,   528,   536,   541,   546,   553,   563,   568,   573,
+     581,   589,   597,   608,   609,   613,   614,   615,   619,   623,
+     627,   633,   639,   645,   649,   653,   657,   661,   665,   669,
+     673,   677,   681,   688,   689,   696,   700,   704,   708,   712,
+     716,   720,   724,   728,   735,   736,   740,   741,   764,   768,
+     772,   776,   780,   784,   788,   792,   796,   800,   804,   808,
+     812,   816,   820,   824,   828,   832,   836,   840,   844,   848,
+     852,   856,   860,   864,   868,   872,   879,   880,   884,   885,
+      36,    47,    55,    54,    65,    64,    77,    78,    79,    80,
+      84,   110,   136,   160,   166,   174,   179,   183,   187,   192,
+     195,   200,   204,   209,   213,   223,   228,   232,   236,   241,
+     245,   255,   264,   273,   282,   291,   305,   310,   314,   320,
+     326,   332,   338,   344,   350,   356
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "KWD_ALIGN",
+  "KWD_COMMON", "TOK_DATA", "KWD_DEFINED", "KWD_ELSE_IF", "KWD_ELSE",
+  "KWD_ENDFILL", "KWD_ENDIF", "KWD_ENDMACRO", "KWD_ENDREPEAT",
+  "KWD_ENDTIMES", "KWD_ENTRY", "KWD_EQU", "KWD_EXPORT", "KWD_EXTERN",
+  "KWD_FILL", "KWD_GLOBAL", "KWD_IF", "KWD_IMPORT", "KWD_INCLUDE",
+  "KWD_MACRO", "KWD_ONCE", "KWD_ORG", "KWD_REPEAT", "KWD_SECTION",
+  "KWD_SKIP", "KWD_TIMES", "TOK_IDENTIFIER", "TOK_INTEGER",
+  "TOK_LABEL_FORWARD", "TOK_LABEL_BACKWARD", "TOK_STRING", "TOK_MACRONAME",
+  "TOK_MACRO_PARAM", "TOK_REPEAT_COUNTER", "\"&&\"", "\"<=>\"", "\"==\"",
+  "\">=\"", "\"=>\"", "\"<=\"", "\"=<\"", "\"!=\"", "\"<>\"", "\"><\"",
+  "\"||\"", "\"$$\"", "\"<<\"", "\">>\"", "\"^^\"", "\"#<=>\"", "\"#>=\"",
+  "\"#=>\"", "\"#<=\"", "\"#=<\"", "\"#<\"", "\"#>\"", "\"<<<\"",
+  "\">>>\"", "\"//\"", "\"%%\"", "'?'", "':'", "'<'", "'>'", "'!'", "'|'",
+  "'^'", "'&'", "'+'", "'-'", "'\\n'", "','", "'='", "'*'", "'.'", "'$'",
+  "'~'", "'('", "')'", "'/'", "'%'", "TOK_ARCH", "KWD_WIDTH", "KWD_LOW",
+  "KWD_HIGH", "KWD_ADDR", "KWD_BANK", "TOK_AREG", "TOK_SREG", "TOK_XREG",
+  "TOK_YREG", "TOK_ZREG", "TOK_MNEM", "'#'", "'['", "']'", "'@'",
+  "$accept", "file", "line", "directive", "$@1", "$@2", "$@3", "$@4",
+  "$@5", "$@6", "repeat_directive", "macro_definition",
+  "macro_definition_head", "macro_definition_arguments",
+  "section_directive", "comma_opt", "data", "extern", "global", "common",
+  "import", "export_head", "export_directive", "export", "here",
+  "prefix_expression_noparen", "prefix_expression", "multiplication",
+  "multiplicative_expression", "multiplicative_expression_noparen",
+  "operation_expression", "expression", "expression_noparen", "$@7", "$@8",
+  "width_declaration", "a_width", "x_width", "mnemonic", "instruction",
+  "operand", "address", "sized_expression", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-223)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-176)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -223,   362,  -223,   448,   -16,   448,   448,   -57,   -54,    -9,
+      35,    55,     7,   116,   120,   130,   448,   133,   448,   163,
+     175,   448,   448,   176,   448,   448,    -6,    74,  -223,  -223,
+    -223,  -223,  -223,   134,   -11,  -223,  -223,  -223,  -223,  -223,
+     177,   -14,    13,    15,    17,    19,    37,   139,   140,    40,
+     143,    -5,   189,  -223,   137,   184,   194,  -223,  -223,  -223,
+    -223,  -223,  -223,   448,   448,   448,   448,   448,  -223,  -223,
+    -223,  -223,   149,  -223,   672,   448,  1192,    -4,   786,  -223,
+    -223,  -223,  -223,  -223,   151,   152,    86,  -223,   823,  -223,
+     860,   198,  -223,   897,   748,  -223,   934,   710,   448,  -223,
+     448,  -223,  -223,   153,   154,   157,   159,   160,   162,   165,
+    -223,  -223,   207,  -223,   210,  -223,   448,  -223,   211,  -223,
+     212,  -223,   213,  -223,   214,   216,  -223,   448,   448,   448,
+     448,   448,  -223,   268,   448,   448,   448,   448,  -223,   268,
+     268,   448,    44,    46,  -223,    48,  1192,   172,   174,   178,
+     448,  -223,  -223,  -223,  -223,  -223,  -223,   537,   448,   448,
+     448,   448,   448,   448,   448,   448,   448,   448,   448,   448,
+     448,   448,   448,   448,   448,   448,   448,   448,   448,   448,
+     448,   448,   448,   448,   448,   448,   448,   448,   448,   448,
+     448,   448,   448,   448,   448,  -223,   155,  1192,  -223,  -223,
+    -223,   448,   218,  -223,  -223,  -223,   105,  -223,   220,  -223,
+    -223,   156,   971,  1008,   223,   227,  -223,   166,   169,  -223,
+    -223,  -223,   188,  1192,    -4,  -223,  -223,   196,   199,   205,
+    1045,  1082,  1192,  1192,  1192,   582,   190,   200,  1192,  1192,
+    1192,  1192,  -223,  -223,  1192,   185,  -223,  1192,   393,  -223,
+      47,   492,  -223,  -223,  -223,  -223,  -223,  -223,  -223,  -223,
+    -223,  -223,   -15,   -23,   -23,   -23,   -23,   -23,   -23,   -23,
+     -23,   -23,  1228,  1264,   -23,   -23,   -23,   -23,   -23,   -23,
+     -23,  1156,   -23,   -23,   -37,   -37,     6,    70,  -223,  -223,
+     278,   192,  1119,  -223,  -223,  -223,  -223,   278,   192,  -223,
+    -223,  -223,  -223,  -223,  -223,   114,  -223,   118,   122,   124,
+    -223,  -223,    82,    66,   215,   217,  -223,  -223,  -223,  1192,
+    -223,  -223,   448,  -223,   448,    87,  -223,  -223,   127,  -223,
+    -223,  -223,  -223,  -223,  -223,  -223,  -223,  -223,   102,   203,
+     209,   109,   202,   627,  1192,  -223,  -223,  -223,  -223,   219,
+    -223,  -223,  -223,  -223,  -223,   221,  -223
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       2,     0,     1,     0,     0,   152,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     8,     4,
+      85,    86,    87,     0,     0,   162,     3,     5,    23,    45,
+      49,    50,    58,     0,     0,     0,    58,     0,    83,    58,
+       0,     0,     0,     7,     0,     0,     0,    88,    92,    90,
+      91,    93,    96,     0,     0,     0,     0,     0,    95,   103,
+     114,   115,   146,   147,     0,     0,    60,     0,     0,    30,
+      27,    31,    25,    22,     0,     0,    73,    62,     0,    64,
+       0,     0,    51,     0,    47,    54,     0,     0,     0,    38,
+       0,    39,   150,     0,     0,     0,   156,   157,     0,     0,
+      52,    59,     0,     9,     0,     6,   154,    40,     0,    41,
+       0,    42,     0,    43,     0,     0,    44,     0,     0,     0,
+       0,     0,   163,     0,     0,     0,     0,     0,   167,     0,
+       0,     0,   103,   115,   148,   147,     0,   168,     0,   169,
+       0,    94,    89,   100,    97,    98,    99,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    16,    17,    66,   153,    29,
+      37,     0,    74,    75,    26,    28,    70,    15,     0,    32,
+      21,    33,     0,     0,     0,     0,   151,     0,     0,    24,
+      46,    53,    55,    61,     0,    63,    65,    67,    77,    78,
+       0,     0,   195,   188,   190,   186,     0,   187,   189,   191,
+     192,   194,   165,   166,   186,     0,   187,   193,     0,   164,
+       0,     0,   104,   110,   112,   111,   113,   107,   109,   105,
+     106,   108,   142,   134,   124,   132,   133,   130,   131,   125,
+     126,   127,   144,   143,   141,   139,   140,   137,   138,   135,
+     136,     0,   128,   129,   123,   121,   122,   120,   118,   119,
+       0,     0,     0,    76,    71,    72,    48,     0,     0,    11,
+      12,   160,   161,   158,   159,     0,   155,     0,     0,     0,
+      13,    14,   104,     0,   176,   182,   174,   170,   172,   185,
+     171,   173,     0,   101,     0,     0,    20,    10,     0,    36,
+      56,    57,    68,    69,    79,    81,    80,    82,     0,     0,
+       0,     0,     0,     0,   145,    18,    34,   178,   180,     0,
+     177,   179,   181,   183,   102,     0,   184
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -223,  -223,  -223,  -223,  -223,  -223,  -223,  -223,  -223,  -223,
+    -223,  -223,  -223,  -223,  -223,    27,  -222,  -223,  -223,  -223,
+    -223,  -223,  -223,  -223,   292,   -41,   -58,   -40,  -223,  -223,
+     -29,    -3,   158,  -223,  -223,  -223,    85,    88,  -223,  -217,
+    -223,   164,   -73
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,    36,    37,   290,   291,   108,   297,   298,   109,
+      38,    39,    40,    41,    42,   112,    43,    44,    45,    46,
+      47,    48,    49,    50,    68,    69,    70,    71,    72,   144,
+      73,   146,   147,    77,   224,   105,   106,   107,    52,    53,
+     148,   236,   149
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      74,   129,    76,    78,   198,   153,   154,   155,   156,    98,
+     127,   142,   143,    88,    75,    90,   -58,    79,    93,    94,
+      80,    96,    97,   145,   168,   169,   170,   171,   172,   173,
+     174,   175,   176,   191,   192,   193,   194,    84,   179,   180,
+     181,   182,   183,   184,   185,   189,   190,   191,   192,   193,
+     194,   187,   188,   189,   190,   191,   192,   193,   194,    99,
+     237,   111,   130,   131,   157,    81,   243,   246,   325,   114,
+     100,   128,   197,   122,   326,   328,   125,   192,   193,   194,
+     103,   329,   104,   134,   135,   136,   137,   113,   111,   115,
+     116,   117,   118,   119,   120,   212,   141,   213,   142,   143,
+     253,   254,   255,   256,   257,   258,   259,   260,   261,    82,
+     145,   121,   111,   223,   -84,   111,   202,   203,  -116,  -116,
+    -117,  -117,  -149,  -149,   230,   231,   232,   233,   234,    83,
+     235,   238,   239,   240,   241,   294,   295,   244,   247,   101,
+     320,   321,   193,   194,   330,   331,    85,   251,   332,   333,
+      86,   306,   334,   335,   336,   337,  -175,   338,   339,   340,
+      87,   345,   116,    89,   262,   263,   264,   265,   266,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+     288,   289,    54,    91,   129,    55,   347,   348,   292,   158,
+     159,   346,   116,   351,   352,    92,    95,   110,   102,   160,
+     161,   162,   163,   123,   151,   124,    56,   126,   150,    57,
+      58,    59,    60,    61,   152,   200,   164,   201,   206,   214,
+     215,   216,   165,   166,   217,   218,   219,   221,    62,   220,
+     222,   225,   226,   227,   228,   319,   229,   248,   249,   293,
+     296,   -19,   -35,   250,   301,   130,   131,    63,   302,   104,
+     103,    64,    65,   132,   305,   313,    30,    31,    32,    66,
+     133,    54,   307,   129,    55,   308,   134,   135,   136,   137,
+     138,   309,   314,     5,   315,   349,   139,   140,    35,   141,
+     341,   350,   342,    51,   355,    56,   353,   242,    57,    58,
+      59,    60,    61,   304,   245,   303,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   356,     0,    62,     0,   343,
+       0,   344,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   130,   131,    63,     0,     0,     0,
+      64,    65,     0,     0,     0,    30,    31,    32,    66,    67,
+       0,     0,     0,     0,     0,   134,   135,   136,   137,     0,
+       0,     0,     2,     0,     0,     3,     4,     5,   141,     6,
+       7,     8,     9,     0,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,     0,    20,     0,    21,    22,    23,
+      24,    25,    26,    27,     0,     0,    54,    28,     0,    55,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      56,     0,     0,    57,    58,    59,    60,    61,     0,     0,
+       0,     0,     0,     0,     0,     0,    29,     0,     0,    30,
+      31,    32,    62,     0,     0,     0,     0,    33,    34,     0,
+       0,    54,     0,     0,    55,     0,     0,     0,    35,     0,
+       0,    63,     0,     0,     0,    64,    65,     0,     0,     0,
+      30,    31,    32,    66,    67,    56,     0,     0,    57,    58,
+      59,    60,    61,     0,     0,   316,   317,   318,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    62,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    63,     0,     0,     0,
+      64,    65,     0,     0,     0,    30,    31,    32,    66,    67,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,     0,     0,     0,   178,   179,   180,   181,   182,   183,
+     184,   185,     0,     0,     0,     0,   186,     0,   187,   188,
+     189,   190,   191,   192,   193,   194,     0,   322,     0,     0,
+       0,     0,     0,     0,   323,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,     0,     0,     0,   178,
+     179,   180,   181,   182,   183,   184,   185,     0,     0,     0,
+       0,   186,     0,   187,   188,   189,   190,   191,   192,   193,
+     194,     0,     0,     0,     0,     0,     0,     0,     0,   252,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,     0,     0,     0,   178,   179,   180,   181,   182,   183,
+     184,   185,     0,     0,     0,     0,   186,     0,   187,   188,
+     189,   190,   191,   192,   193,   194,     0,     0,     0,     0,
+       0,     0,     0,     0,   312,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,     0,     0,     0,   178,
+     179,   180,   181,   182,   183,   184,   185,     0,     0,     0,
+       0,   186,     0,   187,   188,   189,   190,   191,   192,   193,
+     194,     0,     0,     0,     0,     0,     0,     0,     0,   354,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,     0,     0,     0,   178,   179,   180,   181,   182,   183,
+     184,   185,     0,     0,     0,     0,   186,     0,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   196,   167,   168,
+     169,   170,   171,   172,   173,   174,   175,   176,   177,     0,
+       0,     0,   178,   179,   180,   181,   182,   183,   184,   185,
+       0,     0,     0,     0,   186,     0,   187,   188,   189,   190,
+     191,   192,   193,   194,   210,   211,   167,   168,   169,   170,
+     171,   172,   173,   174,   175,   176,   177,     0,     0,     0,
+     178,   179,   180,   181,   182,   183,   184,   185,     0,     0,
+       0,     0,   186,     0,   187,   188,   189,   190,   191,   192,
+     193,   194,     0,   208,   167,   168,   169,   170,   171,   172,
+     173,   174,   175,   176,   177,     0,     0,     0,   178,   179,
+     180,   181,   182,   183,   184,   185,     0,     0,     0,     0,
+     186,     0,   187,   188,   189,   190,   191,   192,   193,   194,
+     199,   167,   168,   169,   170,   171,   172,   173,   174,   175,
+     176,   177,     0,     0,     0,   178,   179,   180,   181,   182,
+     183,   184,   185,     0,     0,     0,     0,   186,     0,   187,
+     188,   189,   190,   191,   192,   193,   194,   204,   167,   168,
+     169,   170,   171,   172,   173,   174,   175,   176,   177,     0,
+       0,     0,   178,   179,   180,   181,   182,   183,   184,   185,
+       0,     0,     0,     0,   186,     0,   187,   188,   189,   190,
+     191,   192,   193,   194,   205,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,     0,     0,     0,   178,
+     179,   180,   181,   182,   183,   184,   185,     0,     0,     0,
+       0,   186,     0,   187,   188,   189,   190,   191,   192,   193,
+     194,   207,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,     0,     0,     0,   178,   179,   180,   181,
+     182,   183,   184,   185,     0,     0,     0,     0,   186,     0,
+     187,   188,   189,   190,   191,   192,   193,   194,   209,   167,
+     168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
+       0,     0,     0,   178,   179,   180,   181,   182,   183,   184,
+     185,     0,     0,     0,     0,   186,     0,   187,   188,   189,
+     190,   191,   192,   193,   194,   299,   167,   168,   169,   170,
+     171,   172,   173,   174,   175,   176,   177,     0,     0,     0,
+     178,   179,   180,   181,   182,   183,   184,   185,     0,     0,
+       0,     0,   186,     0,   187,   188,   189,   190,   191,   192,
+     193,   194,   300,   167,   168,   169,   170,   171,   172,   173,
+     174,   175,   176,   177,     0,     0,     0,   178,   179,   180,
+     181,   182,   183,   184,   185,     0,     0,     0,     0,   186,
+       0,   187,   188,   189,   190,   191,   192,   193,   194,   310,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,     0,     0,     0,   178,   179,   180,   181,   182,   183,
+     184,   185,     0,     0,     0,     0,   186,     0,   187,   188,
+     189,   190,   191,   192,   193,   194,   311,   167,   168,   169,
+     170,   171,   172,   173,   174,   175,   176,   177,     0,     0,
+       0,   178,   179,   180,   181,   182,   183,   184,   185,     0,
+       0,     0,     0,   186,     0,   187,   188,   189,   190,   191,
+     192,   193,   194,   327,   167,   168,   169,   170,   171,   172,
+     173,   174,   175,   176,   177,     0,     0,     0,   178,   179,
+     180,   181,   182,   183,   184,   185,     0,     0,     0,     0,
+     186,   324,   187,   188,   189,   190,   191,   192,   193,   194,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,     0,     0,     0,   178,   179,   180,   181,   182,   183,
+     184,   185,     0,     0,     0,     0,   186,     0,   187,   188,
+     189,   190,   191,   192,   193,   194,   167,   168,   169,   170,
+     171,   172,   173,   174,   175,   176,     0,     0,     0,     0,
+     178,   179,   180,   181,   182,   183,   184,   185,     0,     0,
+       0,     0,     0,     0,   187,   188,   189,   190,   191,   192,
+     193,   194,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,     0,     0,     0,     0,     0,   179,   180,   181,
+     182,   183,   184,   185,     0,     0,     0,     0,     0,     0,
+     187,   188,   189,   190,   191,   192,   193,   194
+};
+
+static const yytype_int16 yycheck[] =
+{
+       3,     5,     5,     6,    77,    63,    64,    65,    66,    15,
+      15,    52,    52,    16,    30,    18,    30,    74,    21,    22,
+      74,    24,    25,    52,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    70,    71,    72,    73,    30,    53,    54,
+      55,    56,    57,    58,    59,    68,    69,    70,    71,    72,
+      73,    66,    67,    68,    69,    70,    71,    72,    73,    65,
+     133,    75,    66,    67,    67,    74,   139,   140,   290,    42,
+      76,    76,    75,    46,   291,   297,    49,    71,    72,    73,
+      91,   298,    93,    87,    88,    89,    90,    74,    75,    74,
+      75,    74,    75,    74,    75,    98,   100,   100,   139,   139,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,    74,
+     139,    74,    75,   116,    74,    75,    30,    31,    74,    75,
+      74,    75,    74,    75,   127,   128,   129,   130,   131,    74,
+     133,   134,   135,   136,   137,    30,    31,   140,   141,    65,
+      93,    94,    72,    73,    30,    31,    30,   150,    30,    31,
+      30,   224,    30,    31,    30,    31,    74,    75,    92,    93,
+      30,    74,    75,    30,   167,   168,   169,   170,   171,   172,
+     173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,     3,    30,     5,     6,    94,    95,   201,    50,
+      51,    74,    75,    94,    95,    30,    30,    30,    74,    60,
+      61,    62,    63,    74,    30,    75,    27,    74,    81,    30,
+      31,    32,    33,    34,    30,    74,    77,    75,    30,    76,
+      76,    74,    83,    84,    75,    75,    74,    30,    49,    74,
+      30,    30,    30,    30,    30,   248,    30,    75,    74,    31,
+      30,    96,    96,    75,    31,    66,    67,    68,    31,    93,
+      91,    72,    73,    74,    76,    75,    77,    78,    79,    80,
+      81,     3,    76,     5,     6,    76,    87,    88,    89,    90,
+      91,    76,    82,     5,    99,    82,    97,    98,    96,   100,
+      75,    82,    75,     1,    75,    27,    94,   139,    30,    31,
+      32,    33,    34,   218,   140,   217,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    94,    -1,    49,    -1,   322,
+      -1,   324,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    66,    67,    68,    -1,    -1,    -1,
+      72,    73,    -1,    -1,    -1,    77,    78,    79,    80,    81,
+      -1,    -1,    -1,    -1,    -1,    87,    88,    89,    90,    -1,
+      -1,    -1,     0,    -1,    -1,     3,     4,     5,   100,     7,
+       8,     9,    10,    -1,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    -1,    23,    -1,    25,    26,    27,
+      28,    29,    30,    31,    -1,    -1,     3,    35,    -1,     6,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      27,    -1,    -1,    30,    31,    32,    33,    34,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    74,    -1,    -1,    77,
+      78,    79,    49,    -1,    -1,    -1,    -1,    85,    86,    -1,
+      -1,     3,    -1,    -1,     6,    -1,    -1,    -1,    96,    -1,
+      -1,    68,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,
+      77,    78,    79,    80,    81,    27,    -1,    -1,    30,    31,
+      32,    33,    34,    -1,    -1,    92,    93,    94,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    68,    -1,    -1,    -1,
+      72,    73,    -1,    -1,    -1,    77,    78,    79,    80,    81,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    73,    -1,    75,    -1,    -1,
+      -1,    -1,    -1,    -1,    82,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    -1,    -1,    -1,
+      -1,    64,    -1,    66,    67,    68,    69,    70,    71,    72,
+      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    73,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    82,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    -1,    -1,    -1,
+      -1,    64,    -1,    66,    67,    68,    69,    70,    71,    72,
+      73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    82,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      -1,    -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    73,    -1,    75,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,
+      64,    -1,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      -1,    -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    -1,    -1,    -1,
+      -1,    64,    -1,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,
+      -1,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    -1,
+      -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    73,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    -1,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,    -1,    -1,    66,    67,    68,    69,    70,    71,
+      72,    73,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,
+      56,    57,    58,    59,    -1,    -1,    -1,    -1,    -1,    -1,
+      66,    67,    68,    69,    70,    71,    72,    73
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,   102,     0,     3,     4,     5,     7,     8,     9,    10,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      23,    25,    26,    27,    28,    29,    30,    31,    35,    74,
+      77,    78,    79,    85,    86,    96,   103,   104,   111,   112,
+     113,   114,   115,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   139,   140,     3,     6,    27,    30,    31,    32,
+      33,    34,    49,    68,    72,    73,    80,    81,   125,   126,
+     127,   128,   129,   131,   132,    30,   132,   134,   132,    74,
+      74,    74,    74,    74,    30,    30,    30,    30,   132,    30,
+     132,    30,    30,   132,   132,    30,   132,   132,    15,    65,
+      76,    65,    74,    91,    93,   136,   137,   138,   107,   110,
+      30,    75,   116,    74,   116,    74,    75,    74,    75,    74,
+      75,    74,   116,    74,    75,   116,    74,    15,    76,     5,
+      66,    67,    74,    81,    87,    88,    89,    90,    91,    97,
+      98,   100,   126,   128,   130,   131,   132,   133,   141,   143,
+      81,    30,    30,   127,   127,   127,   127,   132,    50,    51,
+      60,    61,    62,    63,    77,    83,    84,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    52,    53,
+      54,    55,    56,    57,    58,    59,    64,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,   132,   143,    74,
+      74,    75,    30,    31,    74,    74,    30,    74,    75,    74,
+      74,    75,   132,   132,    76,    76,    74,    75,    75,    74,
+      74,    30,    30,   132,   135,    30,    30,    30,    30,    30,
+     132,   132,   132,   132,   132,   132,   142,   143,   132,   132,
+     132,   132,   133,   143,   132,   142,   143,   132,    75,    74,
+      75,   132,    82,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   132,   132,   132,   132,   132,   132,   132,   132,
+     132,   132,   132,   132,   132,   132,   132,   132,   132,   132,
+     132,   132,   132,   132,   132,   132,   132,   132,   132,   132,
+     105,   106,   132,    31,    30,    31,    30,   108,   109,    74,
+      74,    31,    31,   138,   137,    76,   143,    76,    76,    76,
+      74,    74,    82,    75,    82,    99,    92,    93,    94,   132,
+      93,    94,    75,    82,    65,   117,   140,    74,   117,   140,
+      30,    31,    30,    31,    30,    31,    30,    31,    75,    92,
+      93,    75,    75,   132,   132,    74,    74,    94,    95,    82,
+      82,    94,    95,    94,    82,    75,    94
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,   101,   102,   102,   103,   103,   103,   103,   103,   104,
+     104,   104,   104,   104,   104,   104,   104,   105,   104,   106,
+     104,   104,   104,   107,   104,   104,   104,   104,   104,   104,
+     104,   104,   104,   108,   104,   109,   104,   104,   104,   104,
+     104,   104,   104,   104,   104,   110,   104,   111,   111,   112,
+     112,   113,   114,   114,   115,   115,   115,   115,   116,   116,
+     117,   117,   118,   118,   119,   119,   120,   120,   120,   120,
+     121,   121,   121,   122,   122,   122,   122,   123,   123,   123,
+     123,   123,   123,   124,   124,   125,   125,   125,   126,   126,
+     126,   126,   126,   126,   126,   126,   126,   126,   126,   126,
+     126,   126,   126,   127,   127,   128,   128,   128,   128,   128,
+     128,   128,   128,   128,   129,   129,   130,   130,   131,   131,
+     131,   131,   131,   131,   131,   131,   131,   131,   131,   131,
+     131,   131,   131,   131,   131,   131,   131,   131,   131,   131,
+     131,   131,   131,   131,   131,   131,   132,   132,   133,   133,
+     104,   104,   134,   117,   135,   117,   136,   136,   136,   136,
+     137,   138,   139,   140,   140,   141,   141,   141,   141,   141,
+     141,   141,   141,   141,   141,   141,   141,   141,   141,   141,
+     141,   141,   141,   141,   141,   141,   142,   142,   143,   143,
+     143,   143,   143,   143,   143,   143
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     1,     1,     2,     1,     1,     2,
+       5,     4,     4,     4,     4,     3,     3,     0,     6,     0,
+       5,     3,     2,     0,     3,     2,     3,     2,     3,     3,
+       2,     2,     3,     0,     6,     0,     5,     3,     2,     2,
+       2,     2,     2,     2,     2,     0,     3,     2,     4,     1,
+       1,     2,     2,     3,     2,     3,     5,     5,     0,     1,
+       2,     3,     2,     3,     2,     3,     3,     3,     5,     5,
+       3,     4,     4,     2,     3,     3,     4,     3,     3,     5,
+       5,     5,     5,     1,     1,     1,     1,     1,     1,     2,
+       1,     1,     1,     1,     2,     1,     1,     2,     2,     2,
+       2,     4,     6,     1,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     1,     1,     1,     1,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     5,     1,     1,     1,     1,
+       2,     3,     0,     3,     0,     4,     1,     1,     3,     3,
+       3,     3,     1,     2,     3,     2,     2,     1,     1,     1,
+       3,     3,     3,     3,     3,     3,     3,     5,     5,     5,
+       5,     5,     3,     5,     7,     3,     1,     1,     2,     2,
+       2,     2,     2,     2,     2,     2
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 4: /* line: '\n'  */
+#line 122 "../x65/../parser.y"
+                {
+			advance_line();
+		}
+#line 1686 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 6: /* line: data '\n'  */
+#line 127 "../x65/../parser.y"
+                {
+			advance_line();
+		}
+#line 1694 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 8: /* line: TOK_MACRONAME  */
+#line 132 "../x65/../parser.y"
+                {
+			invoke_macro((yyvsp[0].macro));
+			advance_line();
+		}
+#line 1703 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 9: /* directive: section_directive '\n'  */
+#line 140 "../x65/../parser.y"
+                {
+			advance_line();
+		}
+#line 1711 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 10: /* directive: KWD_EQU TOK_IDENTIFIER ',' expression '\n'  */
+#line 144 "../x65/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-3].s), (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-3].s), (yyvsp[-1].x));
+			advance_line();
+		}
+#line 1722 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 11: /* directive: TOK_IDENTIFIER KWD_EQU expression '\n'  */
+#line 151 "../x65/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-3].s), (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-3].s), (yyvsp[-1].x));
+			advance_line();
+		}
+#line 1733 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 12: /* directive: TOK_IDENTIFIER '=' expression '\n'  */
+#line 158 "../x65/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-3].s), (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-3].s), (yyvsp[-1].x));
+			advance_line();
+		}
+#line 1744 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 13: /* directive: here KWD_EQU expression '\n'  */
+#line 165 "../x65/../parser.y"
+                {
+			instruction_make_set_location(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1754 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 14: /* directive: here '=' expression '\n'  */
+#line 171 "../x65/../parser.y"
+                {
+			instruction_make_set_location(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1764 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 15: /* directive: KWD_ORG expression '\n'  */
+#line 177 "../x65/../parser.y"
+                {
+			instruction_make_set_location(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1774 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 16: /* directive: KWD_ALIGN expression '\n'  */
+#line 183 "../x65/../parser.y"
+                {
+			instruction_make_skip(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, (yyvsp[-1].x),
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1792 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 17: /* $@1: %empty  */
+#line 197 "../x65/../parser.y"
+                {
+			instruction_make_fill(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, (yyvsp[-1].x),
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1809 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 18: /* directive: KWD_ALIGN expression ',' $@1 data '\n'  */
+#line 210 "../x65/../parser.y"
+                {
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1819 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 19: /* $@2: %empty  */
+#line 216 "../x65/../parser.y"
+                {
+			instruction_make_fill(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, (yyvsp[-1].x),
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1836 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 20: /* directive: KWD_ALIGN expression ',' $@2 instruction  */
+#line 229 "../x65/../parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1847 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 21: /* directive: KWD_TIMES expression '\n'  */
+#line 236 "../x65/../parser.y"
+                {
+			instruction_make_times(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1857 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 22: /* directive: KWD_ENDTIMES '\n'  */
+#line 242 "../x65/../parser.y"
+                {
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1867 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 23: /* $@3: %empty  */
+#line 248 "../x65/../parser.y"
+                {
+			parse_repeat_definition();
+		}
+#line 1875 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 24: /* directive: repeat_directive $@3 '\n'  */
+#line 252 "../x65/../parser.y"
+                {
+			advance_line();
+		}
+#line 1883 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 25: /* directive: KWD_ENDREPEAT '\n'  */
+#line 256 "../x65/../parser.y"
+                {
+			yyerror("no matching .repeat found for .endrepeat");
+			YYABORT;
+		}
+#line 1892 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 26: /* directive: KWD_FILL expression '\n'  */
+#line 261 "../x65/../parser.y"
+                {
+			instruction_make_fill(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1902 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 27: /* directive: KWD_ENDFILL '\n'  */
+#line 267 "../x65/../parser.y"
+                {
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1912 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 28: /* directive: KWD_IF expression '\n'  */
+#line 273 "../x65/../parser.y"
+                {
+			handle_if_directive((yyvsp[-1].x));
+			// TODO: optionally delete $2
+			advance_line();
+		}
+#line 1922 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 29: /* directive: KWD_ELSE_IF expression '\n'  */
+#line 279 "../x65/../parser.y"
+                {
+			handle_else_if_directive((yyvsp[-1].x));
+			// TODO: optionally delete $2
+			advance_line();
+		}
+#line 1932 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 30: /* directive: KWD_ELSE '\n'  */
+#line 285 "../x65/../parser.y"
+                {
+			handle_else_directive();
+			advance_line();
+		}
+#line 1941 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 31: /* directive: KWD_ENDIF '\n'  */
+#line 290 "../x65/../parser.y"
+                {
+			handle_end_if_directive();
+			advance_line();
+		}
+#line 1950 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 32: /* directive: KWD_SKIP expression '\n'  */
+#line 295 "../x65/../parser.y"
+                {
+			instruction_make_skip(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1960 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 33: /* $@4: %empty  */
+#line 301 "../x65/../parser.y"
+                {
+			instruction_make_times(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1969 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 34: /* directive: KWD_TIMES expression ',' $@4 data '\n'  */
+#line 306 "../x65/../parser.y"
+                {
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 1979 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 35: /* $@5: %empty  */
+#line 312 "../x65/../parser.y"
+                {
+			instruction_make_times(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1988 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 36: /* directive: KWD_TIMES expression ',' $@5 instruction  */
+#line 317 "../x65/../parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 1999 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 37: /* directive: KWD_ENTRY TOK_IDENTIFIER '\n'  */
+#line 324 "../x65/../parser.y"
+                {
+			if(entry_point_name == NULL)
+			{
+				entry_point_name = (yyvsp[-1].s);
+			}
+			else
+			{
+				yyerror("Error: repeated .entry directive\n");
+				if(!is_replacement)
+					free((yyvsp[-1].s));
+			}
+			advance_line();
+		}
+#line 2017 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 38: /* directive: TOK_IDENTIFIER ':'  */
+#line 338 "../x65/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-1].s), expression_current_location());
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-1].s), expression_current_location());
+		}
+#line 2027 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 39: /* directive: TOK_INTEGER ':'  */
+#line 344 "../x65/../parser.y"
+                {
+			instruction_make_local_label(&current_instruction, current_parser_state, (yyvsp[-1].j));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete((yyvsp[-1].j));
+		}
+#line 2038 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 40: /* directive: extern '\n'  */
+#line 351 "../x65/../parser.y"
+                {
+			advance_line();
+		}
+#line 2046 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 41: /* directive: global '\n'  */
+#line 355 "../x65/../parser.y"
+                {
+			advance_line();
+		}
+#line 2054 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 42: /* directive: common '\n'  */
+#line 359 "../x65/../parser.y"
+                {
+			advance_line();
+		}
+#line 2062 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 43: /* directive: import '\n'  */
+#line 363 "../x65/../parser.y"
+                {
+			advance_line();
+		}
+#line 2070 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 44: /* directive: export '\n'  */
+#line 367 "../x65/../parser.y"
+                {
+			advance_line();
+		}
+#line 2078 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 45: /* $@6: %empty  */
+#line 371 "../x65/../parser.y"
+                {
+			parse_macro_definition();
+		}
+#line 2086 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 46: /* directive: macro_definition $@6 '\n'  */
+#line 375 "../x65/../parser.y"
+                {
+			advance_line();
+		}
+#line 2094 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 47: /* repeat_directive: KWD_REPEAT expression  */
+#line 382 "../x65/../parser.y"
+                {
+			if(!begin_repeat_definition((yyvsp[0].x), NULL))
+				YYABORT;
+		}
+#line 2103 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 48: /* repeat_directive: KWD_REPEAT expression ',' TOK_IDENTIFIER  */
+#line 387 "../x65/../parser.y"
+                {
+			if(!begin_repeat_definition((yyvsp[-2].x), (yyvsp[0].s)))
+				YYABORT;
+		}
+#line 2112 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 51: /* macro_definition_head: KWD_MACRO TOK_IDENTIFIER  */
+#line 400 "../x65/../parser.y"
+                {
+			begin_macro_definition((yyvsp[0].s));
+		}
+#line 2120 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 52: /* macro_definition_arguments: macro_definition_head TOK_IDENTIFIER  */
+#line 407 "../x65/../parser.y"
+                {
+			append_macro_definition_parameter((yyvsp[0].s));
+		}
+#line 2128 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 53: /* macro_definition_arguments: macro_definition_arguments comma_opt TOK_IDENTIFIER  */
+#line 411 "../x65/../parser.y"
+                {
+			append_macro_definition_parameter((yyvsp[0].s));
+		}
+#line 2136 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 54: /* section_directive: KWD_SECTION TOK_IDENTIFIER  */
+#line 418 "../x65/../parser.y"
+                {
+			instruction_make_section(&current_instruction, current_parser_state, (yyvsp[0].s));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2145 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 55: /* section_directive: section_directive comma_opt TOK_IDENTIFIER  */
+#line 423 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[1].parameter, expression_identifier((yyvsp[0].s)));
+		}
+#line 2153 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 56: /* section_directive: section_directive comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 427 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[1].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+		}
+#line 2164 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 57: /* section_directive: section_directive comma_opt TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 434 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[1].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+		}
+#line 2175 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 60: /* data: TOK_DATA expression  */
+#line 449 "../x65/../parser.y"
+                {
+			instruction_make_data(&current_instruction, current_parser_state, (yyvsp[-1].i), (yyvsp[0].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			(yyval.i) = (yyvsp[-1].i);
+		}
+#line 2185 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 61: /* data: data ',' expression  */
+#line 455 "../x65/../parser.y"
+                {
+			instruction_make_data(&current_instruction, current_parser_state, (yyvsp[-2].i), (yyvsp[0].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			(yyval.i) = (yyvsp[-2].i);
+		}
+#line 2195 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 62: /* extern: KWD_EXTERN TOK_IDENTIFIER  */
+#line 464 "../x65/../parser.y"
+                {
+			instruction_make_external(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2204 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 63: /* extern: extern ',' TOK_IDENTIFIER  */
+#line 469 "../x65/../parser.y"
+                {
+			instruction_make_external(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2213 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 64: /* global: KWD_GLOBAL TOK_IDENTIFIER  */
+#line 477 "../x65/../parser.y"
+                {
+			instruction_make_global(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2222 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 65: /* global: global ',' TOK_IDENTIFIER  */
+#line 482 "../x65/../parser.y"
+                {
+			instruction_make_global(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2231 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 66: /* common: KWD_COMMON TOK_IDENTIFIER expression  */
+#line 490 "../x65/../parser.y"
+                {
+			instruction_make_common(&current_instruction, current_parser_state, (yyvsp[-1].s), (yyvsp[0].x));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2240 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 67: /* common: common comma_opt TOK_IDENTIFIER  */
+#line 495 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[2].parameter, expression_identifier((yyvsp[0].s)));
+			(yyval.ins) = (yyvsp[-2].ins);
+		}
+#line 2249 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 68: /* common: common comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 500 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[2].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2261 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 69: /* common: common comma_opt TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 508 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[2].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2273 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 70: /* import: KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER  */
+#line 519 "../x65/../parser.y"
+                {
+			instruction_make_import(&current_instruction, current_parser_state, (yyvsp[-1].s), (yyvsp[0].s), NULL);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2282 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 71: /* import: KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_IDENTIFIER  */
+#line 524 "../x65/../parser.y"
+                {
+			instruction_make_import(&current_instruction, current_parser_state, (yyvsp[-2].s), (yyvsp[-1].s), expression_identifier((yyvsp[0].s)));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2291 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 72: /* import: KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_INTEGER  */
+#line 529 "../x65/../parser.y"
+                {
+			instruction_make_import(&current_instruction, current_parser_state, (yyvsp[-2].s), (yyvsp[-1].s), expression_integer((yyvsp[0].j)));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2300 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 73: /* export_head: KWD_EXPORT TOK_IDENTIFIER  */
+#line 537 "../x65/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[0].s), NULL, NO_ORDINAL);
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2309 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 74: /* export_head: KWD_EXPORT TOK_IDENTIFIER TOK_IDENTIFIER  */
+#line 542 "../x65/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[-1].s), (yyvsp[0].s), NO_ORDINAL);
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2318 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 75: /* export_head: KWD_EXPORT TOK_IDENTIFIER TOK_INTEGER  */
+#line 547 "../x65/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[-1].s), NULL, (yyvsp[0].j));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2329 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 76: /* export_head: KWD_EXPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_INTEGER  */
+#line 554 "../x65/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[-2].s), (yyvsp[-1].s), (yyvsp[0].j));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2340 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 77: /* export_directive: export_head ',' TOK_IDENTIFIER  */
+#line 564 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[3].parameter, expression_identifier((yyvsp[0].s)));
+			(yyval.ins) = (yyvsp[-2].ins);
+		}
+#line 2349 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 78: /* export_directive: export_directive comma_opt TOK_IDENTIFIER  */
+#line 569 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[3].parameter, expression_identifier((yyvsp[0].s)));
+			(yyval.ins) = (yyvsp[-2].ins);
+		}
+#line 2358 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 79: /* export_directive: export_head ',' TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 574 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2370 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 80: /* export_directive: export_directive comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 582 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2382 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 81: /* export_directive: export_head ',' TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 590 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2394 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 82: /* export_directive: export_directive comma_opt TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 598 "../x65/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2406 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 88: /* prefix_expression_noparen: TOK_IDENTIFIER  */
+#line 620 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_identifier((yyvsp[0].s));
+		}
+#line 2414 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 89: /* prefix_expression_noparen: KWD_SECTION TOK_IDENTIFIER  */
+#line 624 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_section((yyvsp[0].s));
+		}
+#line 2422 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 90: /* prefix_expression_noparen: TOK_LABEL_FORWARD  */
+#line 628 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_label_forward((yyvsp[0].j));
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2432 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 91: /* prefix_expression_noparen: TOK_LABEL_BACKWARD  */
+#line 634 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_label_backward((yyvsp[0].j));
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2442 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 92: /* prefix_expression_noparen: TOK_INTEGER  */
+#line 640 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_integer((yyvsp[0].j));
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2452 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 93: /* prefix_expression_noparen: TOK_STRING  */
+#line 646 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_string((yyvsp[0].s));
+		}
+#line 2460 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 94: /* prefix_expression_noparen: KWD_DEFINED TOK_IDENTIFIER  */
+#line 650 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_is_defined((yyvsp[0].s));
+		}
+#line 2468 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 95: /* prefix_expression_noparen: here  */
+#line 654 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_current_location();
+		}
+#line 2476 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 96: /* prefix_expression_noparen: "$$"  */
+#line 658 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_current_section();
+		}
+#line 2484 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 97: /* prefix_expression_noparen: '+' prefix_expression  */
+#line 662 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_PLUS, (yyvsp[0].x));
+		}
+#line 2492 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 98: /* prefix_expression_noparen: '-' prefix_expression  */
+#line 666 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_MINUS, (yyvsp[0].x));
+		}
+#line 2500 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 99: /* prefix_expression_noparen: '~' prefix_expression  */
+#line 670 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_BITNOT, (yyvsp[0].x));
+		}
+#line 2508 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 100: /* prefix_expression_noparen: '!' prefix_expression  */
+#line 674 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_NOT, (yyvsp[0].x));
+		}
+#line 2516 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 101: /* prefix_expression_noparen: KWD_ALIGN '(' expression ')'  */
+#line 678 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_ALIGN, (yyvsp[-1].x), expression_current_location());
+		}
+#line 2524 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 102: /* prefix_expression_noparen: KWD_ALIGN '(' expression ',' expression ')'  */
+#line 682 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_ALIGN, (yyvsp[-3].x), (yyvsp[-1].x));
+		}
+#line 2532 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 104: /* prefix_expression: '(' expression ')'  */
+#line 690 "../x65/../parser.y"
+                {
+			(yyval.x) = (yyvsp[-1].x);
+		}
+#line 2540 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 105: /* multiplication: multiplicative_expression '*' prefix_expression  */
+#line 697 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_MUL, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2548 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 106: /* multiplication: multiplicative_expression '/' prefix_expression  */
+#line 701 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_DIVU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2556 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 107: /* multiplication: multiplicative_expression "//" prefix_expression  */
+#line 705 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_DIV, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2564 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 108: /* multiplication: multiplicative_expression '%' prefix_expression  */
+#line 709 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_MODU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2572 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 109: /* multiplication: multiplicative_expression "%%" prefix_expression  */
+#line 713 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_MOD, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2580 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 110: /* multiplication: multiplicative_expression "<<" prefix_expression  */
+#line 717 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHLU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2588 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 111: /* multiplication: multiplicative_expression "<<<" prefix_expression  */
+#line 721 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHL, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2596 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 112: /* multiplication: multiplicative_expression ">>" prefix_expression  */
+#line 725 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHRU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2604 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 113: /* multiplication: multiplicative_expression ">>>" prefix_expression  */
+#line 729 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2612 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 118: /* operation_expression: expression '+' expression  */
+#line 765 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_ADD, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2620 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 119: /* operation_expression: expression '-' expression  */
+#line 769 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SUB, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2628 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 120: /* operation_expression: expression '&' expression  */
+#line 773 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITAND, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2636 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 121: /* operation_expression: expression '|' expression  */
+#line 777 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITOR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2644 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 122: /* operation_expression: expression '^' expression  */
+#line 781 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITXOR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2652 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 123: /* operation_expression: expression '!' expression  */
+#line 785 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITORNOT, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2660 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 124: /* operation_expression: expression "==" expression  */
+#line 789 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_EQ, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2668 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 125: /* operation_expression: expression "!=" expression  */
+#line 793 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_NE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2676 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 126: /* operation_expression: expression "<>" expression  */
+#line 797 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_NE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2684 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 127: /* operation_expression: expression "><" expression  */
+#line 801 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_NE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2692 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 128: /* operation_expression: expression '<' expression  */
+#line 805 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LT, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2700 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 129: /* operation_expression: expression '>' expression  */
+#line 809 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GT, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2708 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 130: /* operation_expression: expression "<=" expression  */
+#line 813 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2716 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 131: /* operation_expression: expression "=<" expression  */
+#line 817 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2724 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 132: /* operation_expression: expression ">=" expression  */
+#line 821 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2732 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 133: /* operation_expression: expression "=>" expression  */
+#line 825 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2740 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 134: /* operation_expression: expression "<=>" expression  */
+#line 829 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_CMP, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2748 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 135: /* operation_expression: expression "#<" expression  */
+#line 833 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LTU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2756 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 136: /* operation_expression: expression "#>" expression  */
+#line 837 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GTU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2764 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 137: /* operation_expression: expression "#<=" expression  */
+#line 841 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2772 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 138: /* operation_expression: expression "#=<" expression  */
+#line 845 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2780 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 139: /* operation_expression: expression "#>=" expression  */
+#line 849 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2788 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 140: /* operation_expression: expression "#=>" expression  */
+#line 853 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2796 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 141: /* operation_expression: expression "#<=>" expression  */
+#line 857 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_CMPU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2804 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 142: /* operation_expression: expression "&&" expression  */
+#line 861 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_AND, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2812 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 143: /* operation_expression: expression "^^" expression  */
+#line 865 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_XOR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2820 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 144: /* operation_expression: expression "||" expression  */
+#line 869 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_OR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2828 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 145: /* operation_expression: expression '?' expression ':' expression  */
+#line 873 "../x65/../parser.y"
+                {
+			(yyval.x) = expression_conditional((yyvsp[-4].x), (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2836 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 150: /* directive: TOK_ARCH '\n'  */
+#line 37 "../x65/parser.y"
+                {
+			current_parser_state->cpu_type = (yyvsp[-1].i);
+			if(current_parser_state->cpu_type != CPU_65C816)
+			{
+				current_parser_state->abits = BITSIZE8;
+				current_parser_state->xbits = BITSIZE8;
+			}
+			lexer_switch_mode(current_parser_state);
+			advance_line();
+		}
+#line 2851 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 151: /* directive: KWD_WIDTH width_declaration '\n'  */
+#line 48 "../x65/parser.y"
+                {
+			advance_line();
+		}
+#line 2859 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 152: /* $@7: %empty  */
+#line 55 "../x65/parser.y"
+                {
+			instruction_make_data(&current_instruction, current_parser_state, (yyvsp[0].i), NULL);
+			current_instruction.operand_count = 0;
+		}
+#line 2868 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 153: /* data: TOK_DATA $@7 sized_expression  */
+#line 60 "../x65/parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			(yyval.i) = (yyvsp[-2].i);
+		}
+#line 2877 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 154: /* $@8: %empty  */
+#line 65 "../x65/parser.y"
+                {
+			instruction_make_data(&current_instruction, current_parser_state, (yyvsp[-1].i), NULL);
+			current_instruction.operand_count = 0;
+		}
+#line 2886 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 155: /* data: data ',' $@8 sized_expression  */
+#line 70 "../x65/parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			(yyval.i) = (yyvsp[-3].i);
+		}
+#line 2895 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 160: /* a_width: TOK_AREG '=' TOK_INTEGER  */
+#line 85 "../x65/parser.y"
+                {
+			if(!uint_fits(*(yyvsp[0].j)))
+			{
+				yyerror("Invalid constant");
+				YYERROR;
+			}
+			switch(uint_get(*(yyvsp[0].j)))
+			{
+			case 8:
+				current_parser_state->abits = BITSIZE8;
+				break;
+			case 16:
+				current_parser_state->abits = BITSIZE16;
+				break;
+			default:
+				yyerror("Invalid constant");
+				YYERROR;
+				break;
+			}
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2922 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 161: /* x_width: TOK_XREG '=' TOK_INTEGER  */
+#line 111 "../x65/parser.y"
+                {
+			if(!uint_fits(*(yyvsp[0].j)))
+			{
+				yyerror("Invalid constant");
+				YYERROR;
+			}
+			switch(uint_get(*(yyvsp[0].j)))
+			{
+			case 8:
+				current_parser_state->xbits = BITSIZE8;
+				break;
+			case 16:
+				current_parser_state->xbits = BITSIZE16;
+				break;
+			default:
+				yyerror("Invalid constant");
+				YYERROR;
+				break;
+			}
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2949 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 162: /* mnemonic: TOK_MNEM  */
+#line 137 "../x65/parser.y"
+                {
+			instruction_clear(&current_instruction, current_parser_state);
+			current_instruction.mnemonic = (yyvsp[0].i) & 0xFFF;
+			current_instruction.bit = (yyvsp[0].i) >> 12;
+			/*if(current_parser_state->cpu_type == CPU_65CE02)
+			{
+				switch(current_instruction.mnemonic)
+				{
+				case MNEM_JSR:
+					current_instruction.mnemonic = MNEM_65CE02_JSR;
+					break;
+				case MNEM_LDA:
+					current_instruction.mnemonic = MNEM_65CE02_LDA;
+					break;
+				case MNEM_STA:
+					current_instruction.mnemonic = MNEM_65CE02_STA;
+					break;
+				}
+			}*/
+		}
+#line 2974 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 163: /* instruction: mnemonic '\n'  */
+#line 161 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_NONE);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2984 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 164: /* instruction: mnemonic operand '\n'  */
+#line 167 "../x65/parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2993 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 165: /* operand: '#' expression_noparen  */
+#line 175 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_IMM);
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3002 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 166: /* operand: '#' sized_expression  */
+#line 180 "../x65/parser.y"
+                {
+			current_operand.type = OPD_IMM;
+		}
+#line 3010 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 167: /* operand: TOK_AREG  */
+#line 184 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_REG_A);
+		}
+#line 3018 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 168: /* operand: expression_noparen  */
+#line 188 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM);
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3027 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 169: /* operand: sized_expression  */
+#line 193 "../x65/parser.y"
+                {
+		}
+#line 3034 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 170: /* operand: expression_noparen ',' TOK_XREG  */
+#line 196 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM_X);
+			current_operand.parameter = (yyvsp[-2].x);
+		}
+#line 3043 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 171: /* operand: sized_expression ',' TOK_XREG  */
+#line 201 "../x65/parser.y"
+                {
+			current_operand.type = OPD_MEM_X;
+		}
+#line 3051 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 172: /* operand: expression_noparen ',' TOK_YREG  */
+#line 205 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM_Y);
+			current_operand.parameter = (yyvsp[-2].x);
+		}
+#line 3060 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 173: /* operand: sized_expression ',' TOK_YREG  */
+#line 210 "../x65/parser.y"
+                {
+			current_operand.type = OPD_MEM_Y;
+		}
+#line 3068 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 174: /* operand: expression_noparen ',' TOK_SREG  */
+#line 214 "../x65/parser.y"
+                {
+			if(current_parser_state->cpu_type != CPU_65C816)
+			{
+				yyerror("Invalid addressing mode");
+				YYERROR;
+			}
+			operand_set(&current_operand, OPD_STK);
+			current_operand.parameter = (yyvsp[-2].x);
+		}
+#line 3082 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 175: /* operand: '(' expression ')'  */
+#line 224 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_IND);
+			current_operand.parameter = (yyvsp[-1].x);
+		}
+#line 3091 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 176: /* operand: '(' sized_expression ')'  */
+#line 229 "../x65/parser.y"
+                {
+			current_operand.type = OPD_IND;
+		}
+#line 3099 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 177: /* operand: '(' address ',' TOK_XREG ')'  */
+#line 233 "../x65/parser.y"
+                {
+			current_operand.type = OPD_IND_X;
+		}
+#line 3107 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 178: /* operand: '(' expression ')' ',' TOK_YREG  */
+#line 237 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_IND_Y);
+			current_operand.parameter = (yyvsp[-3].x);
+		}
+#line 3116 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 179: /* operand: '(' sized_expression ')' ',' TOK_YREG  */
+#line 242 "../x65/parser.y"
+                {
+			current_operand.type = OPD_IND_Y;
+		}
+#line 3124 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 180: /* operand: '(' expression ')' ',' TOK_ZREG  */
+#line 246 "../x65/parser.y"
+                {
+			if(current_parser_state->cpu_type != CPU_65CE02)
+			{
+				yyerror("Invalid addressing mode");
+				YYERROR;
+			}
+			operand_set(&current_operand, OPD_IND_Z);
+			current_operand.parameter = (yyvsp[-3].x);
+		}
+#line 3138 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 181: /* operand: '(' sized_expression ')' ',' TOK_ZREG  */
+#line 256 "../x65/parser.y"
+                {
+			if(current_parser_state->cpu_type != CPU_65CE02)
+			{
+				yyerror("Invalid addressing mode");
+				YYERROR;
+			}
+			current_operand.type = OPD_IND_Z;
+		}
+#line 3151 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 182: /* operand: '[' address ']'  */
+#line 265 "../x65/parser.y"
+                {
+			if(current_parser_state->cpu_type != CPU_65C816)
+			{
+				yyerror("Invalid addressing mode");
+				YYERROR;
+			}
+			current_operand.type = OPD_LNG;
+		}
+#line 3164 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 183: /* operand: '[' address ']' ',' TOK_YREG  */
+#line 274 "../x65/parser.y"
+                {
+			if(current_parser_state->cpu_type != CPU_65C816)
+			{
+				yyerror("Invalid addressing mode");
+				YYERROR;
+			}
+			current_operand.type = OPD_LNG_Y;
+		}
+#line 3177 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 184: /* operand: '(' address ',' TOK_SREG ')' ',' TOK_YREG  */
+#line 283 "../x65/parser.y"
+                {
+			if(current_parser_state->cpu_type != CPU_65CE02 && current_parser_state->cpu_type != CPU_65C816)
+			{
+				yyerror("Invalid addressing mode");
+				YYERROR;
+			}
+			current_operand.type = OPD_STK_Y;
+		}
+#line 3190 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 185: /* operand: expression_noparen ',' expression  */
+#line 292 "../x65/parser.y"
+                {
+			if(current_parser_state->cpu_type == CPU_6502)
+			{
+				yyerror("Invalid addressing mode");
+				YYERROR;
+			}
+			operand_set(&current_operand, OPD_PAIR);
+			current_operand.parameters[0] = (yyvsp[-2].x);
+			current_operand.parameters[1] = (yyvsp[0].x);
+		}
+#line 3205 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 186: /* address: expression  */
+#line 306 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM);
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3214 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 188: /* sized_expression: '<' expression  */
+#line 315 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM);
+			current_operand.mode = MODE_LOW_BYTE;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3224 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 189: /* sized_expression: KWD_LOW expression  */
+#line 321 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM);
+			current_operand.mode = MODE_LOW_BYTE;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3234 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 190: /* sized_expression: '>' expression  */
+#line 327 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM);
+			current_operand.mode = MODE_HIGH_BYTE;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3244 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 191: /* sized_expression: KWD_HIGH expression  */
+#line 333 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM);
+			current_operand.mode = MODE_HIGH_BYTE;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3254 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 192: /* sized_expression: KWD_ADDR expression  */
+#line 339 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM);
+			current_operand.mode = MODE_WORD;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3264 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 193: /* sized_expression: '@' expression  */
+#line 345 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM);
+			current_operand.mode = MODE_LONG;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3274 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 194: /* sized_expression: KWD_BANK expression  */
+#line 351 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM);
+			current_operand.mode = MODE_BANK;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3284 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+  case 195: /* sized_expression: TOK_DATA expression  */
+#line 357 "../x65/parser.y"
+                {
+			operand_set(&current_operand, OPD_MEM);
+			switch(_GET_DATA_SIZE((yyvsp[-1].i)))
+			{
+			case BITSIZE8:
+				current_operand.mode = MODE_LOW_BYTE;
+				break;
+			case BITSIZE16:
+				current_operand.mode = MODE_WORD;
+				break;
+			case BITSIZE24:
+				current_operand.mode = MODE_LONG;
+				break;
+			default:
+				yyerror("Invalid data width specification");
+				YYERROR;
+			}
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3308 "../../obj/x65/x65/parser.tab.c"
+    break;
+
+
+#line 3312 "../../obj/x65/x65/parser.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 378 "../x65/parser.y"
+
+#line 379 "../x65/parser.y"
+
+parser_state_t current_parser_state[1] =
+{
+	{
+		.line_number = 1,
+		.cpu_type = CPU_6502,
+		.abits = BITSIZE8,
+		.xbits = BITSIZE8,
+		.stream =
+		{
+			.first_instruction = NULL,
+			.last_instruction = &current_parser_state->stream.first_instruction,
+		},
+	}
+};
+
+void instruction_clear(instruction_t * ins, parser_state_t * state)
+{
+	memset(ins, 0, sizeof(instruction_t));
+	ins->line_number = state->line_number;
+	ins->cpu = state->cpu_type;
+	ins->abits = state->abits;
+	ins->xbits = state->xbits;
+}
+
+// TODO: operand types
+
+void operand_set(operand_t * opd, operand_type_t type)
+{
+	memset(opd, 0, sizeof(operand_t));
+	opd->type = type;
+}
+
+void operand_set_immediate(operand_t * opd, expression_t * value)
+{
+	memset(opd, 0, sizeof(operand_t));
+	opd->parameter = value;
+}
+
+void operand_set_memory(operand_t * opd)
+{
+	operand_set(opd, OPD_MEM);
+}
+
+
+#line 889 "../x65/../parser.y"
+
+// changes whenever tokens are added, removed or reordered in the grammar of the target
+uint64_t parser_get_token_fingerprint(void)
+{
+	// FNV-1a over the terminal names and the mapping of token numbers to them
+	uint64_t hash = 0xCBF29CE484222325;
+	for(int symbol = 0; symbol < YYNTOKENS; symbol++)
+	{
+		for(const char * name = yytname[symbol]; ; name++)
+		{
+			hash ^= (uint8_t)*name;
+			hash *= 0x100000001B3;
+			if(*name == '\0')
+				break;
+		}
+	}
+	for(size_t token = 0; token < sizeof yytranslate / sizeof yytranslate[0]; token++)
+	{
+		hash ^= yytranslate[token];
+		hash *= 0x100000001B3;
+	}
+	return hash;
+}
+
+void yyerror(const char * s)
+{
+	const char * filename = preprocessor_get_current_filename();
+	if(filename != NULL)
+		fprintf(stderr, "Error in %s, line %ld: %s\n", filename, current_parser_state->line_number, s);
+	else
+		fprintf(stderr, "Error in line %ld: %s\n", current_parser_state->line_number, s);
+}
+
@@ -0,0 +1,4728 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 7 "../x86/../parser.y"
+
+#include <assert.h>
+#include <stdio.h>
+#include "../../../src/syntax.h"
+#include "../../../src/asm.h"
+
+typedef enum operand_type_t operand_type_t;
+typedef struct operand_t operand_t;
+
+extern int yylex(void);
+void yyerror(const char * s);
+
+#line 84 "../../obj/x86/x86/parser.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parser.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_KWD_ALIGN = 3,                  /* KWD_ALIGN  */
+  YYSYMBOL_KWD_COMMON = 4,                 /* KWD_COMMON  */
+  YYSYMBOL_TOK_DATA = 5,                   /* TOK_DATA  */
+  YYSYMBOL_KWD_DEFINED = 6,                /* KWD_DEFINED  */
+  YYSYMBOL_KWD_ELSE_IF = 7,                /* KWD_ELSE_IF  */
+  YYSYMBOL_KWD_ELSE = 8,                   /* KWD_ELSE  */
+  YYSYMBOL_KWD_ENDFILL = 9,                /* KWD_ENDFILL  */
+  YYSYMBOL_KWD_ENDIF = 10,                 /* KWD_ENDIF  */
+  YYSYMBOL_KWD_ENDMACRO = 11,              /* KWD_ENDMACRO  */
+  YYSYMBOL_KWD_ENDREPEAT = 12,             /* KWD_ENDREPEAT  */
+  YYSYMBOL_KWD_ENDTIMES = 13,              /* KWD_ENDTIMES  */
+  YYSYMBOL_KWD_ENTRY = 14,                 /* KWD_ENTRY  */
+  YYSYMBOL_KWD_EQU = 15,                   /* KWD_EQU  */
+  YYSYMBOL_KWD_EXPORT = 16,                /* KWD_EXPORT  */
+  YYSYMBOL_KWD_EXTERN = 17,                /* KWD_EXTERN  */
+  YYSYMBOL_KWD_FILL = 18,                  /* KWD_FILL  */
+  YYSYMBOL_KWD_GLOBAL = 19,                /* KWD_GLOBAL  */
+  YYSYMBOL_KWD_IF = 20,                    /* KWD_IF  */
+  YYSYMBOL_KWD_IMPORT = 21,                /* KWD_IMPORT  */
+  YYSYMBOL_KWD_INCLUDE = 22,               /* KWD_INCLUDE  */
+  YYSYMBOL_KWD_MACRO = 23,                 /* KWD_MACRO  */
+  YYSYMBOL_KWD_ONCE = 24,                  /* KWD_ONCE  */
+  YYSYMBOL_KWD_ORG = 25,                   /* KWD_ORG  */
+  YYSYMBOL_KWD_REPEAT = 26,                /* KWD_REPEAT  */
+  YYSYMBOL_KWD_SECTION = 27,               /* KWD_SECTION  */
+  YYSYMBOL_KWD_SKIP = 28,                  /* KWD_SKIP  */
+  YYSYMBOL_KWD_TIMES = 29,                 /* KWD_TIMES  */
+  YYSYMBOL_TOK_IDENTIFIER = 30,            /* TOK_IDENTIFIER  */
+  YYSYMBOL_TOK_INTEGER = 31,               /* TOK_INTEGER  */
+  YYSYMBOL_TOK_LABEL_FORWARD = 32,         /* TOK_LABEL_FORWARD  */
+  YYSYMBOL_TOK_LABEL_BACKWARD = 33,        /* TOK_LABEL_BACKWARD  */
+  YYSYMBOL_TOK_STRING = 34,                /* TOK_STRING  */
+  YYSYMBOL_TOK_MACRONAME = 35,             /* TOK_MACRONAME  */
+  YYSYMBOL_TOK_MACRO_PARAM = 36,           /* TOK_MACRO_PARAM  */
+  YYSYMBOL_TOK_REPEAT_COUNTER = 37,        /* TOK_REPEAT_COUNTER  */
+  YYSYMBOL_DEL_AND = 38,                   /* "&&"  */
+  YYSYMBOL_DEL_CMP = 39,                   /* "<=>"  */
+  YYSYMBOL_DEL_EQ = 40,                    /* "=="  */
+  YYSYMBOL_DEL_GE = 41,                    /* ">="  */
+  YYSYMBOL_DEL_GE1 = 42,                   /* "=>"  */
+  YYSYMBOL_DEL_LE = 43,                    /* "<="  */
+  YYSYMBOL_DEL_LE1 = 44,                   /* "=<"  */
+  YYSYMBOL_DEL_NE = 45,                    /* "!="  */
+  YYSYMBOL_DEL_NE1 = 46,                   /* "<>"  */
+  YYSYMBOL_DEL_NE2 = 47,                   /* "><"  */
+  YYSYMBOL_DEL_OR = 48,                    /* "||"  */
+  YYSYMBOL_DEL_SECT = 49,                  /* "$$"  */
+  YYSYMBOL_DEL_SHL = 50,                   /* "<<"  */
+  YYSYMBOL_DEL_SHR = 51,                   /* ">>"  */
+  YYSYMBOL_DEL_XOR = 52,                   /* "^^"  */
+  YYSYMBOL_DEL_CMP_U = 53,                 /* "#<=>"  */
+  YYSYMBOL_DEL_GE_U = 54,                  /* "#>="  */
+  YYSYMBOL_DEL_GE1_U = 55,                 /* "#=>"  */
+  YYSYMBOL_DEL_LE_U = 56,                  /* "#<="  */
+  YYSYMBOL_DEL_LE1_U = 57,                 /* "#=<"  */
+  YYSYMBOL_DEL_LT_U = 58,                  /* "#<"  */
+  YYSYMBOL_DEL_GT_U = 59,                  /* "#>"  */
+  YYSYMBOL_DEL_SHL_S = 60,                 /* "<<<"  */
+  YYSYMBOL_DEL_SHR_S = 61,                 /* ">>>"  */
+  YYSYMBOL_DEL_DIV_S = 62,                 /* "//"  */
+  YYSYMBOL_DEL_MOD_S = 63,                 /* "%%"  */
+  YYSYMBOL_64_ = 64,                       /* '?'  */
+  YYSYMBOL_65_ = 65,                       /* ':'  */
+  YYSYMBOL_66_ = 66,                       /* '<'  */
+  YYSYMBOL_67_ = 67,                       /* '>'  */
+  YYSYMBOL_68_ = 68,                       /* '!'  */
+  YYSYMBOL_69_ = 69,                       /* '|'  */
+  YYSYMBOL_70_ = 70,                       /* '^'  */
+  YYSYMBOL_71_ = 71,                       /* '&'  */
+  YYSYMBOL_72_ = 72,                       /* '+'  */
+  YYSYMBOL_73_ = 73,                       /* '-'  */
+  YYSYMBOL_74_n_ = 74,                     /* '\n'  */
+  YYSYMBOL_75_ = 75,                       /* ','  */
+  YYSYMBOL_76_ = 76,                       /* '='  */
+  YYSYMBOL_77_ = 77,                       /* '*'  */
+  YYSYMBOL_78_ = 78,                       /* '.'  */
+  YYSYMBOL_79_ = 79,                       /* '$'  */
+  YYSYMBOL_80_ = 80,                       /* '~'  */
+  YYSYMBOL_81_ = 81,                       /* '('  */
+  YYSYMBOL_82_ = 82,                       /* ')'  */
+  YYSYMBOL_83_ = 83,                       /* '/'  */
+  YYSYMBOL_84_ = 84,                       /* '%'  */
+  YYSYMBOL_TOK_ARCH = 85,                  /* TOK_ARCH  */
+  YYSYMBOL_KWD_BITS = 86,                  /* KWD_BITS  */
+  YYSYMBOL_KWD_FAR = 87,                   /* KWD_FAR  */
+  YYSYMBOL_KWD_REL = 88,                   /* KWD_REL  */
+  YYSYMBOL_KWD_SEG = 89,                   /* KWD_SEG  */
+  YYSYMBOL_KWD_WRT = 90,                   /* KWD_WRT  */
+  YYSYMBOL_TOK_286_UMOV_PREFIX = 91,       /* TOK_286_UMOV_PREFIX  */
+  YYSYMBOL_TOK_FPU = 92,                   /* TOK_FPU  */
+  YYSYMBOL_TOK_ASIZE = 93,                 /* TOK_ASIZE  */
+  YYSYMBOL_TOK_BITS = 94,                  /* TOK_BITS  */
+  YYSYMBOL_TOK_CREG = 95,                  /* TOK_CREG  */
+  YYSYMBOL_TOK_CYSYMBOL = 96,              /* TOK_CYSYMBOL  */
+  YYSYMBOL_TOK_DIRSYMBOL = 97,             /* TOK_DIRSYMBOL  */
+  YYSYMBOL_TOK_DREG = 98,                  /* TOK_DREG  */
+  YYSYMBOL_TOK_GPR = 99,                   /* TOK_GPR  */
+  YYSYMBOL_TOK_IPREG = 100,                /* TOK_IPREG  */
+  YYSYMBOL_TOK_IRAM = 101,                 /* TOK_IRAM  */
+  YYSYMBOL_TOK_LOCK = 102,                 /* TOK_LOCK  */
+  YYSYMBOL_TOK_MNEMONIC = 103,             /* TOK_MNEMONIC  */
+  YYSYMBOL_TOK_MMREG = 104,                /* TOK_MMREG  */
+  YYSYMBOL_TOK_OSIZE = 105,                /* TOK_OSIZE  */
+  YYSYMBOL_TOK_PSWREG = 106,               /* TOK_PSWREG  */
+  YYSYMBOL_TOK_REP = 107,                  /* TOK_REP  */
+  YYSYMBOL_TOK_RSYMBOL = 108,              /* TOK_RSYMBOL  */
+  YYSYMBOL_TOK_SEG = 109,                  /* TOK_SEG  */
+  YYSYMBOL_TOK_STREG = 110,                /* TOK_STREG  */
+  YYSYMBOL_TOK_TREG = 111,                 /* TOK_TREG  */
+  YYSYMBOL_TOK_XMMREG = 112,               /* TOK_XMMREG  */
+  YYSYMBOL_TOK_YMMREG = 113,               /* TOK_YMMREG  */
+  YYSYMBOL_TOK_ZMMREG = 114,               /* TOK_ZMMREG  */
+  YYSYMBOL_TOK_DW = 115,                   /* TOK_DW  */
+  YYSYMBOL_TOK_I8080_MNEM = 116,           /* TOK_I8080_MNEM  */
+  YYSYMBOL_TOK_Z80_MNEM = 117,             /* TOK_Z80_MNEM  */
+  YYSYMBOL_TOK_X80_REG = 118,              /* TOK_X80_REG  */
+  YYSYMBOL_TOK_X80_MEM = 119,              /* TOK_X80_MEM  */
+  YYSYMBOL_TOK_X80_IDX = 120,              /* TOK_X80_IDX  */
+  YYSYMBOL_TOK_I8089_MNEM = 121,           /* TOK_I8089_MNEM  */
+  YYSYMBOL_TOK_I8089_VALREG = 122,         /* TOK_I8089_VALREG  */
+  YYSYMBOL_TOK_I8089_IXREG = 123,          /* TOK_I8089_IXREG  */
+  YYSYMBOL_TOK_I8089_PTRREG = 124,         /* TOK_I8089_PTRREG  */
+  YYSYMBOL_TOK_I8089_PPREG = 125,          /* TOK_I8089_PPREG  */
+  YYSYMBOL_TOK_BRACKET_DOT = 126,          /* "]."  */
+  YYSYMBOL_127_ = 127,                     /* '['  */
+  YYSYMBOL_128_ = 128,                     /* ']'  */
+  YYSYMBOL_YYACCEPT = 129,                 /* $accept  */
+  YYSYMBOL_file = 130,                     /* file  */
+  YYSYMBOL_line = 131,                     /* line  */
+  YYSYMBOL_directive = 132,                /* directive  */
+  YYSYMBOL_133_1 = 133,                    /* $@1  */
+  YYSYMBOL_134_2 = 134,                    /* $@2  */
+  YYSYMBOL_135_3 = 135,                    /* $@3  */
+  YYSYMBOL_136_4 = 136,                    /* $@4  */
+  YYSYMBOL_137_5 = 137,                    /* $@5  */
+  YYSYMBOL_138_6 = 138,                    /* $@6  */
+  YYSYMBOL_repeat_directive = 139,         /* repeat_directive  */
+  YYSYMBOL_macro_definition = 140,         /* macro_definition  */
+  YYSYMBOL_macro_definition_head = 141,    /* macro_definition_head  */
+  YYSYMBOL_macro_definition_arguments = 142, /* macro_definition_arguments  */
+  YYSYMBOL_section_directive = 143,        /* section_directive  */
+  YYSYMBOL_comma_opt = 144,                /* comma_opt  */
+  YYSYMBOL_data = 145,                     /* data  */
+  YYSYMBOL_extern = 146,                   /* extern  */
+  YYSYMBOL_global = 147,                   /* global  */
+  YYSYMBOL_common = 148,                   /* common  */
+  YYSYMBOL_import = 149,                   /* import  */
+  YYSYMBOL_export_head = 150,              /* export_head  */
+  YYSYMBOL_export_directive = 151,         /* export_directive  */
+  YYSYMBOL_export = 152,                   /* export  */
+  YYSYMBOL_here = 153,                     /* here  */
+  YYSYMBOL_prefix_expression_noparen = 154, /* prefix_expression_noparen  */
+  YYSYMBOL_prefix_expression = 155,        /* prefix_expression  */
+  YYSYMBOL_multiplication = 156,           /* multiplication  */
+  YYSYMBOL_multiplicative_expression = 157, /* multiplicative_expression  */
+  YYSYMBOL_multiplicative_expression_noparen = 158, /* multiplicative_expression_noparen  */
+  YYSYMBOL_addend = 159,                   /* addend  */
+  YYSYMBOL_operation_expression = 160,     /* operation_expression  */
+  YYSYMBOL_expression = 161,               /* expression  */
+  YYSYMBOL_expression_noparen = 162,       /* expression_noparen  */
+  YYSYMBOL_instruction = 163,              /* instruction  */
+  YYSYMBOL_segment_prefix = 164,           /* segment_prefix  */
+  YYSYMBOL_iram_prefix = 165,              /* iram_prefix  */
+  YYSYMBOL_x86_instruction = 166,          /* x86_instruction  */
+  YYSYMBOL_mnemonic = 167,                 /* mnemonic  */
+  YYSYMBOL_mnemonic_operands = 168,        /* mnemonic_operands  */
+  YYSYMBOL_169_7 = 169,                    /* $@7  */
+  YYSYMBOL_operand = 170,                  /* operand  */
+  YYSYMBOL_address_operand = 171,          /* address_operand  */
+  YYSYMBOL_172_8 = 172,                    /* $@8  */
+  YYSYMBOL_173_9 = 173,                    /* $@9  */
+  YYSYMBOL_174_10 = 174,                   /* $@10  */
+  YYSYMBOL_address = 175,                  /* address  */
+  YYSYMBOL_address_offset = 176,           /* address_offset  */
+  YYSYMBOL_i8080_mnemonic = 177,           /* i8080_mnemonic  */
+  YYSYMBOL_i8080_mnemonic_operands = 178,  /* i8080_mnemonic_operands  */
+  YYSYMBOL_i8080_instruction = 179,        /* i8080_instruction  */
+  YYSYMBOL_z80_mnemonic = 180,             /* z80_mnemonic  */
+  YYSYMBOL_z80_mnemonic_operands = 181,    /* z80_mnemonic_operands  */
+  YYSYMBOL_z80_instruction = 182,          /* z80_instruction  */
+  YYSYMBOL_i8080_operand = 183,            /* i8080_operand  */
+  YYSYMBOL_z80_operand = 184,              /* z80_operand  */
+  YYSYMBOL_i8089_mnemonic = 185,           /* i8089_mnemonic  */
+  YYSYMBOL_i8089_mnemonic_operand = 186,   /* i8089_mnemonic_operand  */
+  YYSYMBOL_i8089_instruction = 187,        /* i8089_instruction  */
+  YYSYMBOL_i8089_operand = 188,            /* i8089_operand  */
+  YYSYMBOL_i8089_base_address = 189        /* i8089_base_address  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+/* Second part of user prologue.  */
+#line 4 "../x86/parser.y"
+
+#include "../../../src/x86/isa.h"
+
+bool validate_scale_strict(bitsize_t address_size, integer_value_t scale);
+bool validate_scale_permissive(bitsize_t address_size, integer_value_t scale);
+
+parser_state_t current_parser_state[1];
+extern instruction_t current_instruction;
+#define current_operand (current_instruction.operand[current_instruction.operand_count])
+#define current_instruction_stream (&current_parser_state->stream)
+
+void operand_set(operand_t * opd, operand_type_t type);
+void operand_set_register(operand_t * opd, operand_type_t type, int number);
+void operand_set_immediate(operand_t * opd, expression_t * value);
+void operand_set_far_address(operand_t * opd, expression_t * segment, expression_t * offset);
+void operand_set_memory(operand_t * opd);
+
+#line 325 "../../obj/x86/x86/parser.tab.c"
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  2
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   2220
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  129
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  61
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  267
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  465
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   360
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+      74,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    68,     2,     2,    79,    84,    71,     2,
+      81,    82,    77,    72,    75,    73,    78,    83,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    65,     2,
+      66,    76,    67,    64,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   127,     2,   128,    70,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,    69,     2,    80,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   116,   116,   117,   121,   125,   126,   130,   131,   139,
+     143,   150,   157,   164,   170,   176,   182,   197,   196,   216,
+     215,   235,   241,   248,   247,   255,   260,   266,   272,   278,
+     284,   289,   294,   301,   300,   312,   311,   323,   337,   343,
+     350,   354,   358,   362,   366,   371,   370,   381,   386,   394,
+     395,   399,   406,   410,   417,   422,   426,   433,   443,   444,
+     448,   454,   463,   468,   476,   481,   489,   494,   499,   507,
+     518,   523,   528,   536,   541,   546,   553,   563,   568,   573,
+     581,   589,   597,   608,   609,   613,   614,   615,   619,   623,
+     627,   633,   639,   645,   649,   653,   657,   661,   665,   669,
+     673,   677,   681,   688,   689,   696,   700,   704,   708,   712,
+     716,   720,   724,   728,   735,   736,   740,   741,   745,   749,
+     753,   757,   764,   768,   772,   776,   780,   784,   788,   792,
+     796,   800,   804,   808,   812,   816,   820,   824,   828,   832,
+     836,   840,   844,   848,   852,   856,   860,   864,   868,   872,
+     879,   880,   884,   885,    76,    85,   120,   177,   216,   224,
+     232,   233,   237,   238,   242,   265,   275,   284,   293,   312,
+     331,   340,   344,   351,   371,   376,   375,   390,   394,   398,
+     402,   406,   410,   414,   418,   422,   426,   430,   434,   438,
+     443,   444,   448,   452,   457,   461,   466,   470,   474,   478,
+     486,   485,   491,   490,   499,   498,   509,   510,   514,   521,
+     526,   538,   543,   549,   567,   586,   597,   609,   628,   648,
+     653,   659,   665,   671,   680,   684,   691,   710,   714,   721,
+     725,   732,   741,   745,   752,   756,   763,   767,   771,   778,
+     782,   786,   790,   794,   799,   804,   809,   818,   825,   834,
+     838,   845,   849,   856,   860,   864,   868,   869,   874,   879,
+     884,   888,   892,   896,   903,   908,   916,   920
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "KWD_ALIGN",
+  "KWD_COMMON", "TOK_DATA", "KWD_DEFINED", "KWD_ELSE_IF", "KWD_ELSE",
+  "KWD_ENDFILL", "KWD_ENDIF", "KWD_ENDMACRO", "KWD_ENDREPEAT",
+  "KWD_ENDTIMES", "KWD_ENTRY", "KWD_EQU", "KWD_EXPORT", "KWD_EXTERN",
+  "KWD_FILL", "KWD_GLOBAL", "KWD_IF", "KWD_IMPORT", "KWD_INCLUDE",
+  "KWD_MACRO", "KWD_ONCE", "KWD_ORG", "KWD_REPEAT", "KWD_SECTION",
+  "KWD_SKIP", "KWD_TIMES", "TOK_IDENTIFIER", "TOK_INTEGER",
+  "TOK_LABEL_FORWARD", "TOK_LABEL_BACKWARD", "TOK_STRING", "TOK_MACRONAME",
+  "TOK_MACRO_PARAM", "TOK_REPEAT_COUNTER", "\"&&\"", "\"<=>\"", "\"==\"",
+  "\">=\"", "\"=>\"", "\"<=\"", "\"=<\"", "\"!=\"", "\"<>\"", "\"><\"",
+  "\"||\"", "\"$$\"", "\"<<\"", "\">>\"", "\"^^\"", "\"#<=>\"", "\"#>=\"",
+  "\"#=>\"", "\"#<=\"", "\"#=<\"", "\"#<\"", "\"#>\"", "\"<<<\"",
+  "\">>>\"", "\"//\"", "\"%%\"", "'?'", "':'", "'<'", "'>'", "'!'", "'|'",
+  "'^'", "'&'", "'+'", "'-'", "'\\n'", "','", "'='", "'*'", "'.'", "'$'",
+  "'~'", "'('", "')'", "'/'", "'%'", "TOK_ARCH", "KWD_BITS", "KWD_FAR",
+  "KWD_REL", "KWD_SEG", "KWD_WRT", "TOK_286_UMOV_PREFIX", "TOK_FPU",
+  "TOK_ASIZE", "TOK_BITS", "TOK_CREG", "TOK_CYSYMBOL", "TOK_DIRSYMBOL",
+  "TOK_DREG", "TOK_GPR", "TOK_IPREG", "TOK_IRAM", "TOK_LOCK",
+  "TOK_MNEMONIC", "TOK_MMREG", "TOK_OSIZE", "TOK_PSWREG", "TOK_REP",
+  "TOK_RSYMBOL", "TOK_SEG", "TOK_STREG", "TOK_TREG", "TOK_XMMREG",
+  "TOK_YMMREG", "TOK_ZMMREG", "TOK_DW", "TOK_I8080_MNEM", "TOK_Z80_MNEM",
+  "TOK_X80_REG", "TOK_X80_MEM", "TOK_X80_IDX", "TOK_I8089_MNEM",
+  "TOK_I8089_VALREG", "TOK_I8089_IXREG", "TOK_I8089_PTRREG",
+  "TOK_I8089_PPREG", "\"].\"", "'['", "']'", "$accept", "file", "line",
+  "directive", "$@1", "$@2", "$@3", "$@4", "$@5", "$@6",
+  "repeat_directive", "macro_definition", "macro_definition_head",
+  "macro_definition_arguments", "section_directive", "comma_opt", "data",
+  "extern", "global", "common", "import", "export_head",
+  "export_directive", "export", "here", "prefix_expression_noparen",
+  "prefix_expression", "multiplication", "multiplicative_expression",
+  "multiplicative_expression_noparen", "addend", "operation_expression",
+  "expression", "expression_noparen", "instruction", "segment_prefix",
+  "iram_prefix", "x86_instruction", "mnemonic", "mnemonic_operands", "$@7",
+  "operand", "address_operand", "$@8", "$@9", "$@10", "address",
+  "address_offset", "i8080_mnemonic", "i8080_mnemonic_operands",
+  "i8080_instruction", "z80_mnemonic", "z80_mnemonic_operands",
+  "z80_instruction", "i8080_operand", "z80_operand", "i8089_mnemonic",
+  "i8089_mnemonic_operand", "i8089_instruction", "i8089_operand",
+  "i8089_base_address", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-370)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-244)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -370,   646,  -370,  1216,     2,  1216,  1216,   -36,   -34,   -22,
+     -11,    -9,    37,    46,    50,    58,  1216,    61,  1216,    68,
+      70,  1216,  1216,    74,  1216,  1216,    -1,    47,  -370,  -370,
+    -370,  -370,  -370,    36,    97,     4,    62,     4,    81,   121,
+       4,  -370,     4,     4,   123,  1216,  -370,  -370,  -370,  -370,
+    -370,  -370,  -370,   160,    -2,   -15,    98,   103,   110,   132,
+     122,   127,   134,   193,     5,  -370,     4,     4,  -370,   331,
+     195,   912,   136,  -370,   771,   138,  -370,    52,   142,  -370,
+     145,   248,   257,   198,  -370,  -370,  -370,  -370,  -370,   557,
+     557,   557,   557,  1216,   259,  -370,  -370,  -370,  -370,   120,
+    -370,  1448,  1216,  2040,  1562,  -370,  -370,  -370,  -370,  -370,
+     216,   217,   190,  -370,  1599,  -370,  1636,   261,  -370,  1673,
+    1524,  -370,  1710,  1486,  1216,  -370,  1216,  -370,  -370,   219,
+    -370,  -370,  -370,  -370,  -370,  -370,  -370,  -370,  -370,  2040,
+     221,   222,  -370,  -370,   274,  -370,   275,  -370,  1216,  -370,
+     276,  -370,   277,  -370,   278,  -370,   279,   280,  -370,  1216,
+    1216,  -370,  -370,   543,  -370,     7,  -370,  -370,  -370,  -370,
+    -370,   246,  -370,  -370,  -370,   249,  -370,  -370,  -370,  -370,
+    -370,  -370,  -370,  1932,  -370,  -370,  -370,   238,  -370,  -370,
+    -370,  2040,  -370,  -370,   932,  -370,   852,  -370,  -370,  -370,
+     148,   150,  -370,   153,  2040,  -370,  -370,  -370,   832,  -370,
+    -370,  -370,  -370,   105,  1968,  -370,  -370,   267,  1216,  -370,
+    -370,   285,  -370,  -370,  -370,  -370,  -370,  1313,  -370,   557,
+     557,   557,   557,   557,   557,   557,   557,   557,  1216,  1216,
+    1216,  1216,  1216,  1216,  1216,  1216,  1216,  1216,  1216,  1216,
+    1216,  1216,  1216,  1216,  1216,  1216,  1216,  1216,  1216,  1216,
+    1216,  1216,  1216,  1216,  1216,  1216,  -370,    12,  2040,  -370,
+    -370,  1216,   286,  -370,  -370,  -370,   201,  -370,   288,  -370,
+    -370,    22,  1747,  1784,  -370,  -370,  -370,  -370,   243,  2040,
+    -370,  -370,   245,   247,   250,  1821,  1858,   249,  2040,  -370,
+     -58,  -370,   197,   200,   992,  1116,   444,  -370,   240,   -28,
+    1358,  -370,  -370,  -370,   -56,  1216,  -370,  1268,  -370,  -370,
+    -370,  -370,  -370,  -370,  -370,  -370,  -370,  -370,  -370,  2147,
+      94,    94,    94,    94,    94,    94,    94,    94,    94,  2076,
+    2112,    94,    94,    94,    94,    94,    94,    94,  2004,    94,
+      94,   128,   128,    71,   161,  -370,  -370,    25,   -68,  1895,
+    -370,  -370,  -370,  -370,    25,   -68,  -370,  -370,   233,   235,
+     241,   244,  -370,  -370,  -370,  -370,  -370,  1136,  1196,    42,
+     204,   255,   260,  2040,   202,  -370,  1216,  2040,  -370,  -370,
+     557,   557,  -370,   -26,   205,   738,  1216,   251,  2040,  1216,
+    -370,  1216,   207,  -370,  -370,   209,  -370,  -370,  -370,  -370,
+    -370,  -370,  -370,  -370,  -370,  1056,  1056,  1216,  2040,  1216,
+    2040,   430,   297,   213,   213,  1056,  1056,  -370,  2040,   120,
+     120,   557,   557,  -370,   -41,   645,  2040,  1216,  1403,  2040,
+    -370,  -370,   203,   210,  2040,  2040,    45,   204,  -370,  -370,
+     120,   120,   214,  -370,  -370,  2040,  -370,  -370,  -370,   301,
+     213,   213,  -370,   204,   213
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       2,     0,     1,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     8,     4,
+      85,    86,    87,     0,     0,     0,     0,     0,     0,   162,
+       0,   173,     0,     0,   160,     0,   226,   231,   248,     3,
+       5,    23,    45,    49,    50,    58,     0,     0,     0,    58,
+       0,    83,    58,     0,     0,     7,     0,     0,   159,     0,
+     175,     0,     0,   224,     0,     0,   225,     0,     0,   247,
+       0,     0,     0,    88,    92,    90,    91,    93,    96,     0,
+       0,     0,     0,     0,     0,    95,   103,   114,   115,   150,
+     151,     0,     0,    60,     0,    30,    27,    31,    25,    22,
+       0,     0,    73,    62,     0,    64,     0,     0,    51,     0,
+      47,    54,     0,     0,     0,    38,     0,    39,   157,     0,
+     170,   158,   169,   155,   163,   167,   168,   166,   161,   154,
+       0,     0,    52,    59,     0,     9,     0,     6,     0,    40,
+       0,    41,     0,    42,     0,    43,     0,     0,    44,     0,
+       0,   164,   165,     0,   171,     0,   181,   198,   199,   182,
+     177,     0,   184,   196,   197,   179,   180,   183,   185,   186,
+     187,   178,   200,   188,   174,   190,   172,     0,   229,   236,
+     237,   238,   227,   230,     0,   234,     0,   239,   240,   241,
+     103,   115,   152,   151,     0,   242,   232,   235,     0,   251,
+     253,   254,   255,     0,   262,   249,   252,     0,     0,    94,
+      89,     0,    88,   100,    97,    98,    99,     0,   266,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    16,    19,    66,    29,
+      37,     0,    74,    75,    26,    28,    70,    15,     0,    32,
+      21,    35,     0,     0,   156,    24,    46,    53,    55,    61,
+      63,    65,    67,    77,    78,     0,     0,     0,   189,   191,
+       0,   192,     0,     0,     0,     0,     0,   228,     0,     0,
+       0,   233,   264,   265,     0,     0,   250,     0,   267,   104,
+     110,   112,   111,   113,   107,   109,   105,   106,   108,   146,
+     138,   128,   136,   137,   134,   135,   129,   130,   131,   148,
+     147,   145,   143,   144,   141,   142,   139,   140,     0,   132,
+     133,   127,   125,   126,   124,   122,   123,     0,     0,     0,
+      76,    71,    72,    48,     0,     0,    11,    12,     0,     0,
+       0,     0,    13,    14,   193,   204,   202,     0,     0,   211,
+     219,     0,     0,   209,     0,   206,     0,   194,   176,   244,
+       0,     0,   245,     0,   104,     0,     0,   256,   263,     0,
+     101,     0,     0,    20,    10,     0,    36,    56,    57,    68,
+      69,    79,    81,    80,    82,     0,     0,     0,   210,     0,
+     221,     0,     0,   212,   220,     0,     0,   201,   195,   118,
+     119,     0,     0,   246,     0,     0,   258,     0,     0,   149,
+      18,    34,     0,     0,   222,   223,   215,   213,   208,   207,
+     120,   121,     0,   260,   259,   257,   102,   205,   203,     0,
+     216,   214,   261,   217,   218
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -370,  -370,  -370,  -370,  -370,  -370,  -370,  -370,  -370,  -370,
+    -370,  -370,  -370,  -370,  -370,    34,  -328,  -370,  -370,  -370,
+    -370,  -370,  -370,  -370,   332,   -73,   -83,   -70,  -329,  -370,
+    -369,   -69,    -3,  -370,  -308,  -370,  -370,   152,  -370,  -370,
+    -370,    35,  -139,  -370,  -370,  -370,  -370,  -257,  -370,  -370,
+    -370,  -370,  -370,  -370,   149,   141,  -370,  -370,  -370,   133,
+    -370
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,    49,    50,   357,   358,   140,   364,   365,   141,
+      51,    52,    53,    54,    55,   144,    56,    57,    58,    59,
+      60,    61,    62,    63,    95,    96,    97,    98,    99,   202,
+     393,   100,   383,   205,    65,    66,    67,    68,    69,    70,
+     187,   184,   185,   304,   416,   415,   384,   385,    71,    72,
+      73,    74,    75,    76,   192,   206,    77,    78,    79,   215,
+     314
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     101,   200,   103,   104,   201,   203,   223,   224,   225,   226,
+     423,   424,   300,   114,   124,   116,   395,   -17,   119,   120,
+     159,   122,   123,    35,   299,    37,   301,   -33,   -58,   402,
+       5,   452,   102,    39,    40,    41,   405,    42,   105,    43,
+     106,    44,   139,   171,   390,   391,   431,   432,    46,    47,
+     403,   297,   107,    48,   392,    80,   433,   406,    81,   145,
+     143,   429,   430,   108,   125,   109,   183,   110,   191,   182,
+     396,   204,   397,   143,   214,   126,   111,   460,   461,    82,
+     112,   160,    83,    84,    85,    86,    87,   453,   113,   146,
+     227,   115,   429,   154,   464,    35,   157,    37,   117,   268,
+     118,    88,   450,   451,   121,    39,    40,    41,   171,    42,
+     128,    43,   127,    44,   421,   391,   297,   390,   391,   422,
+      89,   282,   459,   283,    90,    91,   209,   -17,   129,    30,
+      31,    32,    92,    93,   182,   200,   131,   -33,   201,   203,
+      45,    94,   263,   264,   265,   289,   320,   321,   322,   323,
+     324,   325,   326,   327,   328,   133,   295,   296,   442,   443,
+     298,   374,   260,   261,   262,   263,   264,   265,   448,   449,
+     229,   230,   147,   148,   210,   211,   212,   149,   150,   213,
+     231,   232,   233,   234,   151,   152,   134,   130,   138,   132,
+     142,   191,   135,   310,   136,   137,   155,   235,   262,   263,
+     264,   265,   156,   236,   237,   204,   153,   143,   -84,   143,
+     193,   194,   207,   208,   214,   317,   216,   217,   161,   162,
+     272,   273,  -116,  -116,  -117,  -117,   218,  -153,  -153,   312,
+     313,   361,   362,   264,   265,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   407,   408,   409,   410,   158,   359,   186,
+      80,   411,   412,    81,   413,   414,   390,   391,   219,  -243,
+    -243,   440,   148,   441,   148,   431,   432,   220,   221,   228,
+     270,   276,   271,   284,    82,   285,   286,    83,    84,    85,
+      86,    87,   387,   183,   287,   288,   290,   291,   292,   293,
+     294,   302,   398,   306,   303,   318,    88,   360,   363,   368,
+     425,   369,   389,   370,   375,   426,   371,   376,   447,   437,
+     427,   457,   463,    64,    80,    89,   163,    81,   458,    90,
+      91,   388,   462,   307,    30,    31,    32,    92,    93,   311,
+     316,     0,     0,     0,     0,     0,    94,     0,    82,     0,
+       0,    83,    84,    85,    86,    87,     0,     0,     0,     0,
+       0,     0,     0,     0,   418,   420,     0,     0,     0,     0,
+      88,     0,     0,   428,     0,     0,     0,     0,     0,   210,
+     211,   212,   435,   436,   213,     0,   438,     0,   439,    89,
+       0,     0,     0,    90,    91,   164,     0,     0,    30,    31,
+      32,    92,    93,     0,   444,     0,   445,     0,   165,     0,
+      94,     0,     0,     0,     0,     0,   166,   167,   168,   169,
+     170,     0,   171,    80,   455,   172,    81,   173,     0,   174,
+     175,   176,   177,   178,   179,   180,   181,    80,     0,   163,
+      81,     0,     0,     0,     0,     0,     0,    82,   182,     0,
+     222,    84,    85,    86,    87,     0,     0,     0,     0,     0,
+       0,    82,     0,     0,    83,    84,    85,    86,    87,    88,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    88,     0,     0,     0,     0,    89,     0,
+       0,     0,    90,    91,     0,     0,     0,    30,    31,    32,
+      92,    93,    89,     0,     0,     0,    90,    91,     0,     0,
+       0,    30,    31,    32,    92,    93,     0,     0,     0,   446,
+       0,   165,     0,    94,     0,     0,     0,     0,     0,   166,
+     167,   168,   169,   170,     0,   171,    80,     0,   172,    81,
+     173,     0,   174,   175,   176,   177,   178,   179,   180,   181,
+      80,     0,     0,    81,     0,     0,     0,     0,     0,     0,
+      82,   182,     0,    83,    84,    85,    86,    87,     0,     0,
+       0,     0,     0,     0,    82,     0,     0,   222,    84,    85,
+      86,    87,    88,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    88,     0,     0,     0,
+       0,    89,     0,     0,     0,    90,    91,     0,     0,     0,
+      30,    31,    32,    92,    93,    89,     0,     0,     0,    90,
+      91,     0,    94,     0,    30,    31,    32,    92,    93,     0,
+       0,     0,     0,     0,   171,     0,     2,     0,     0,     3,
+       4,     5,   297,     6,     7,     8,     9,     0,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,     0,    20,
+     182,    21,    22,    23,    24,    25,    26,    27,     0,     0,
+       0,    28,     0,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,     0,     0,     0,   249,   250,   251,
+     252,   253,   254,   255,   256,     0,     0,     0,     0,   257,
+       0,   258,   259,   260,   261,   262,   263,   264,   265,     0,
+      29,     0,     0,    30,    31,    32,     0,     0,     0,     0,
+       0,    33,    34,     0,     0,     0,     0,    35,    36,    37,
+      38,    80,     0,     0,    81,     0,     0,    39,    40,    41,
+       0,    42,     0,    43,     0,    44,     0,     0,     0,     0,
+       0,    45,    46,    47,     0,    82,     0,    48,    83,    84,
+      85,    86,    87,   454,    80,     0,     0,    81,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    88,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    82,     0,
+       0,    83,    84,    85,    86,    87,    89,     0,     0,     0,
+      90,    91,     0,     0,     0,    30,    31,    32,    92,    93,
+      88,     0,     0,     0,     0,     0,     0,    94,     0,     0,
+       0,     0,     0,     0,     0,    80,     0,     0,    81,    89,
+       0,     0,     0,    90,    91,   195,     0,     0,    30,    31,
+      32,    92,   196,     0,     0,    80,     0,     0,    81,    82,
+      94,   434,    83,    84,    85,    86,    87,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    82,
+       0,    88,    83,    84,    85,    86,    87,     0,     0,   197,
+     198,   199,     0,     0,     0,     0,     0,     0,     0,     0,
+      89,    88,     0,     0,    90,    91,     0,     0,     0,    30,
+      31,    32,    92,   196,     0,    80,     0,     0,    81,     0,
+      89,    94,     0,     0,    90,    91,     0,     0,     0,    30,
+      31,    32,    92,    93,     0,    80,     0,     0,    81,    82,
+       0,    94,    83,    84,    85,    86,    87,     0,     0,     0,
+     197,   198,   199,     0,     0,     0,     0,     0,     0,    82,
+       0,    88,    83,    84,    85,    86,    87,     0,     0,     0,
+       0,   308,   309,     0,     0,     0,     0,     0,     0,     0,
+      89,    88,     0,     0,    90,    91,   188,     0,     0,    30,
+      31,    32,    92,    93,     0,    80,     0,   377,    81,     0,
+      89,    94,     0,     0,    90,    91,     0,     0,     0,    30,
+      31,    32,    92,    93,     0,     0,     0,     0,     0,    82,
+       0,    94,    83,    84,    85,    86,    87,     0,     0,     0,
+     189,   190,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    88,     0,     0,     0,     0,     0,     0,     0,     0,
+     189,   190,     0,     0,     0,     0,     0,     0,     0,    80,
+      89,   377,    81,     0,    90,    91,     0,     0,     0,    30,
+      31,    32,    92,    93,     0,     0,     0,     0,     0,     0,
+     378,    94,     0,    82,     0,     0,    83,    84,    85,    86,
+      87,   379,   380,   381,     0,     0,     0,     0,     0,     0,
+       0,   382,     0,     0,     0,    88,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    80,
+       0,   386,    81,     0,    89,     0,     0,     0,    90,    91,
+       0,     0,     0,    30,    31,    32,    92,    93,     0,    80,
+       0,     0,    81,    82,   378,    94,    83,    84,    85,    86,
+      87,     0,     0,     0,     0,   379,   380,     0,     0,     0,
+       0,     0,     0,    82,     0,    88,    83,    84,    85,    86,
+      87,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    89,    88,     0,     0,    90,    91,
+       0,     0,     0,    30,    31,    32,    92,    93,     0,    80,
+       0,   419,    81,     0,    89,    94,     0,     0,    90,    91,
+       0,     0,     0,    30,    31,    32,    92,    93,     0,    80,
+       0,     0,    81,    82,   417,    94,    83,    84,    85,    86,
+      87,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    82,     0,    88,    83,    84,    85,    86,
+      87,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    89,    88,     0,     0,    90,    91,
+       0,     0,     0,    30,    31,    32,    92,    93,     0,     0,
+       0,     0,     0,     0,    89,    94,     0,     0,    90,    91,
+       0,     0,     0,    30,    31,    32,    92,    93,     0,     0,
+       0,     0,     0,     0,     0,    94,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,     0,     0,     0,
+     249,   250,   251,   252,   253,   254,   255,   256,     0,     0,
+       0,     0,   257,     0,   258,   259,   260,   261,   262,   263,
+     264,   265,     0,   399,     0,     0,     0,     0,     0,     0,
+     400,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,     0,     0,     0,   249,   250,   251,   252,   253,
+     254,   255,   256,     0,     0,     0,     0,   257,     0,   258,
+     259,   260,   261,   262,   263,   264,   265,     0,     0,     0,
+       0,     0,     0,     0,     0,   319,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,     0,     0,     0,
+     249,   250,   251,   252,   253,   254,   255,   256,     0,     0,
+       0,     0,   257,     0,   258,   259,   260,   261,   262,   263,
+     264,   265,     0,     0,     0,     0,     0,     0,     0,     0,
+     394,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,     0,     0,     0,   249,   250,   251,   252,   253,
+     254,   255,   256,     0,     0,     0,     0,   257,     0,   258,
+     259,   260,   261,   262,   263,   264,   265,     0,     0,     0,
+       0,     0,     0,     0,     0,   456,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,     0,     0,     0,
+     249,   250,   251,   252,   253,   254,   255,   256,     0,     0,
+       0,     0,   257,     0,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,   248,     0,     0,     0,   249,   250,
+     251,   252,   253,   254,   255,   256,     0,     0,     0,     0,
+     257,     0,   258,   259,   260,   261,   262,   263,   264,   265,
+     280,   281,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,     0,     0,     0,   249,   250,   251,   252,
+     253,   254,   255,   256,     0,     0,     0,     0,   257,     0,
+     258,   259,   260,   261,   262,   263,   264,   265,     0,   278,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     248,     0,     0,     0,   249,   250,   251,   252,   253,   254,
+     255,   256,     0,     0,     0,     0,   257,     0,   258,   259,
+     260,   261,   262,   263,   264,   265,   269,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,   248,     0,     0,
+       0,   249,   250,   251,   252,   253,   254,   255,   256,     0,
+       0,     0,     0,   257,     0,   258,   259,   260,   261,   262,
+     263,   264,   265,   274,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,   248,     0,     0,     0,   249,   250,
+     251,   252,   253,   254,   255,   256,     0,     0,     0,     0,
+     257,     0,   258,   259,   260,   261,   262,   263,   264,   265,
+     275,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,     0,     0,     0,   249,   250,   251,   252,   253,
+     254,   255,   256,     0,     0,     0,     0,   257,     0,   258,
+     259,   260,   261,   262,   263,   264,   265,   277,   238,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,     0,
+       0,     0,   249,   250,   251,   252,   253,   254,   255,   256,
+       0,     0,     0,     0,   257,     0,   258,   259,   260,   261,
+     262,   263,   264,   265,   279,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,     0,     0,     0,   249,
+     250,   251,   252,   253,   254,   255,   256,     0,     0,     0,
+       0,   257,     0,   258,   259,   260,   261,   262,   263,   264,
+     265,   366,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,     0,     0,     0,   249,   250,   251,   252,
+     253,   254,   255,   256,     0,     0,     0,     0,   257,     0,
+     258,   259,   260,   261,   262,   263,   264,   265,   367,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+       0,     0,     0,   249,   250,   251,   252,   253,   254,   255,
+     256,     0,     0,     0,     0,   257,     0,   258,   259,   260,
+     261,   262,   263,   264,   265,   372,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,     0,     0,     0,
+     249,   250,   251,   252,   253,   254,   255,   256,     0,     0,
+       0,     0,   257,     0,   258,   259,   260,   261,   262,   263,
+     264,   265,   373,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,     0,     0,     0,   249,   250,   251,
+     252,   253,   254,   255,   256,     0,     0,     0,     0,   257,
+       0,   258,   259,   260,   261,   262,   263,   264,   265,   404,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     248,     0,     0,     0,   249,   250,   251,   252,   253,   254,
+     255,   256,     0,     0,     0,     0,   257,   305,   258,   259,
+     260,   261,   262,   263,   264,   265,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,     0,     0,     0,
+     249,   250,   251,   252,   253,   254,   255,   256,     0,     0,
+       0,     0,   257,   315,   258,   259,   260,   261,   262,   263,
+     264,   265,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,     0,     0,     0,   249,   250,   251,   252,
+     253,   254,   255,   256,     0,     0,     0,     0,   257,   401,
+     258,   259,   260,   261,   262,   263,   264,   265,   238,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,     0,
+       0,     0,   249,   250,   251,   252,   253,   254,   255,   256,
+       0,     0,     0,     0,   257,     0,   258,   259,   260,   261,
+     262,   263,   264,   265,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,     0,     0,     0,     0,   249,   250,
+     251,   252,   253,   254,   255,   256,     0,     0,     0,     0,
+       0,     0,   258,   259,   260,   261,   262,   263,   264,   265,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+       0,     0,     0,     0,     0,   250,   251,   252,   253,   254,
+     255,   256,     0,     0,     0,     0,     0,     0,   258,   259,
+     260,   261,   262,   263,   264,   265,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,     0,     0,     0,     0,     0,
+     250,   251,   252,   253,   254,   255,   256,     0,     0,     0,
+       0,     0,     0,   258,   259,   260,   261,   262,   263,   264,
+     265
+};
+
+static const yytype_int16 yycheck[] =
+{
+       3,    74,     5,     6,    74,    74,    89,    90,    91,    92,
+     379,   380,     5,    16,    15,    18,    72,     5,    21,    22,
+      15,    24,    25,    91,   163,    93,   165,     5,    30,   357,
+       5,    72,    30,   101,   102,   103,   364,   105,    74,   107,
+      74,   109,    45,   101,    72,    73,    72,    73,   116,   117,
+     358,   109,    74,   121,    82,     3,    82,   365,     6,    74,
+      75,   390,   391,    74,    65,    74,    69,    30,    71,   127,
+     126,    74,   128,    75,    77,    76,    30,   446,   447,    27,
+      30,    76,    30,    31,    32,    33,    34,   128,    30,    55,
+      93,    30,   421,    59,   463,    91,    62,    93,    30,   102,
+      30,    49,   431,   432,    30,   101,   102,   103,   101,   105,
+      74,   107,    65,   109,    72,    73,   109,    72,    73,    77,
+      68,   124,    77,   126,    72,    73,    74,   115,    31,    77,
+      78,    79,    80,    81,   127,   208,    74,   115,   208,   208,
+     115,    89,    71,    72,    73,   148,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,    74,   159,   160,   415,   416,
+     163,   300,    68,    69,    70,    71,    72,    73,   425,   426,
+      50,    51,    74,    75,   122,   123,   124,    74,    75,   127,
+      60,    61,    62,    63,    74,    75,    65,    35,    65,    37,
+      30,   194,    40,   196,    42,    43,    74,    77,    70,    71,
+      72,    73,    75,    83,    84,   208,    74,    75,    74,    75,
+      74,    75,    74,    75,   217,   218,    74,    75,    66,    67,
+      30,    31,    74,    75,    74,    75,    81,    74,    75,   124,
+     125,    30,    31,    72,    73,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
+     263,   264,   265,    30,    31,    30,    31,    74,   271,    74,
+       3,    30,    31,     6,    30,    31,    72,    73,    30,    74,
+      75,    74,    75,    74,    75,    72,    73,    30,    90,    30,
+      74,    30,    75,    74,    27,    74,    74,    30,    31,    32,
+      33,    34,   305,   306,    30,    30,    30,    30,    30,    30,
+      30,    65,   315,    75,    65,    30,    49,    31,    30,    76,
+      65,    76,    82,    76,   127,    65,    76,   127,    31,    78,
+     128,   128,    31,     1,     3,    68,     5,     6,   128,    72,
+      73,   306,   128,   194,    77,    78,    79,    80,    81,   208,
+     217,    -1,    -1,    -1,    -1,    -1,    89,    -1,    27,    -1,
+      -1,    30,    31,    32,    33,    34,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   377,   378,    -1,    -1,    -1,    -1,
+      49,    -1,    -1,   386,    -1,    -1,    -1,    -1,    -1,   122,
+     123,   124,   395,   396,   127,    -1,   399,    -1,   401,    68,
+      -1,    -1,    -1,    72,    73,    74,    -1,    -1,    77,    78,
+      79,    80,    81,    -1,   417,    -1,   419,    -1,    87,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,
+      99,    -1,   101,     3,   437,   104,     6,   106,    -1,   108,
+     109,   110,   111,   112,   113,   114,   115,     3,    -1,     5,
+       6,    -1,    -1,    -1,    -1,    -1,    -1,    27,   127,    -1,
+      30,    31,    32,    33,    34,    -1,    -1,    -1,    -1,    -1,
+      -1,    27,    -1,    -1,    30,    31,    32,    33,    34,    49,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    49,    -1,    -1,    -1,    -1,    68,    -1,
+      -1,    -1,    72,    73,    -1,    -1,    -1,    77,    78,    79,
+      80,    81,    68,    -1,    -1,    -1,    72,    73,    -1,    -1,
+      -1,    77,    78,    79,    80,    81,    -1,    -1,    -1,    99,
+      -1,    87,    -1,    89,    -1,    -1,    -1,    -1,    -1,    95,
+      96,    97,    98,    99,    -1,   101,     3,    -1,   104,     6,
+     106,    -1,   108,   109,   110,   111,   112,   113,   114,   115,
+       3,    -1,    -1,     6,    -1,    -1,    -1,    -1,    -1,    -1,
+      27,   127,    -1,    30,    31,    32,    33,    34,    -1,    -1,
+      -1,    -1,    -1,    -1,    27,    -1,    -1,    30,    31,    32,
+      33,    34,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,    -1,
+      -1,    68,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,
+      77,    78,    79,    80,    81,    68,    -1,    -1,    -1,    72,
+      73,    -1,    89,    -1,    77,    78,    79,    80,    81,    -1,
+      -1,    -1,    -1,    -1,   101,    -1,     0,    -1,    -1,     3,
+       4,     5,   109,     7,     8,     9,    10,    -1,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    -1,    23,
+     127,    25,    26,    27,    28,    29,    30,    31,    -1,    -1,
+      -1,    35,    -1,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,
+      -1,    66,    67,    68,    69,    70,    71,    72,    73,    -1,
+      74,    -1,    -1,    77,    78,    79,    -1,    -1,    -1,    -1,
+      -1,    85,    86,    -1,    -1,    -1,    -1,    91,    92,    93,
+      94,     3,    -1,    -1,     6,    -1,    -1,   101,   102,   103,
+      -1,   105,    -1,   107,    -1,   109,    -1,    -1,    -1,    -1,
+      -1,   115,   116,   117,    -1,    27,    -1,   121,    30,    31,
+      32,    33,    34,   128,     3,    -1,    -1,     6,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    49,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    27,    -1,
+      -1,    30,    31,    32,    33,    34,    68,    -1,    -1,    -1,
+      72,    73,    -1,    -1,    -1,    77,    78,    79,    80,    81,
+      49,    -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,    -1,    -1,     6,    68,
+      -1,    -1,    -1,    72,    73,    74,    -1,    -1,    77,    78,
+      79,    80,    81,    -1,    -1,     3,    -1,    -1,     6,    27,
+      89,   123,    30,    31,    32,    33,    34,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    27,
+      -1,    49,    30,    31,    32,    33,    34,    -1,    -1,   118,
+     119,   120,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    49,    -1,    -1,    72,    73,    -1,    -1,    -1,    77,
+      78,    79,    80,    81,    -1,     3,    -1,    -1,     6,    -1,
+      68,    89,    -1,    -1,    72,    73,    -1,    -1,    -1,    77,
+      78,    79,    80,    81,    -1,     3,    -1,    -1,     6,    27,
+      -1,    89,    30,    31,    32,    33,    34,    -1,    -1,    -1,
+     118,   119,   120,    -1,    -1,    -1,    -1,    -1,    -1,    27,
+      -1,    49,    30,    31,    32,    33,    34,    -1,    -1,    -1,
+      -1,   119,   120,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    49,    -1,    -1,    72,    73,    74,    -1,    -1,    77,
+      78,    79,    80,    81,    -1,     3,    -1,     5,     6,    -1,
+      68,    89,    -1,    -1,    72,    73,    -1,    -1,    -1,    77,
+      78,    79,    80,    81,    -1,    -1,    -1,    -1,    -1,    27,
+      -1,    89,    30,    31,    32,    33,    34,    -1,    -1,    -1,
+     118,   119,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     118,   119,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+      68,     5,     6,    -1,    72,    73,    -1,    -1,    -1,    77,
+      78,    79,    80,    81,    -1,    -1,    -1,    -1,    -1,    -1,
+      88,    89,    -1,    27,    -1,    -1,    30,    31,    32,    33,
+      34,    99,   100,   101,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   109,    -1,    -1,    -1,    49,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+      -1,     5,     6,    -1,    68,    -1,    -1,    -1,    72,    73,
+      -1,    -1,    -1,    77,    78,    79,    80,    81,    -1,     3,
+      -1,    -1,     6,    27,    88,    89,    30,    31,    32,    33,
+      34,    -1,    -1,    -1,    -1,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,    27,    -1,    49,    30,    31,    32,    33,
+      34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    49,    -1,    -1,    72,    73,
+      -1,    -1,    -1,    77,    78,    79,    80,    81,    -1,     3,
+      -1,     5,     6,    -1,    68,    89,    -1,    -1,    72,    73,
+      -1,    -1,    -1,    77,    78,    79,    80,    81,    -1,     3,
+      -1,    -1,     6,    27,    88,    89,    30,    31,    32,    33,
+      34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    27,    -1,    49,    30,    31,    32,    33,
+      34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    49,    -1,    -1,    72,    73,
+      -1,    -1,    -1,    77,    78,    79,    80,    81,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    89,    -1,    -1,    72,    73,
+      -1,    -1,    -1,    77,    78,    79,    80,    81,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    89,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    73,    -1,    75,    -1,    -1,    -1,    -1,    -1,    -1,
+      82,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,
+      67,    68,    69,    70,    71,    72,    73,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    82,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      82,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,
+      67,    68,    69,    70,    71,    72,    73,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    82,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,
+      64,    -1,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    73,    -1,    75,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    -1,
+      -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,
+      64,    -1,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      -1,    -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    -1,    -1,    -1,
+      -1,    64,    -1,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,
+      -1,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    -1,    -1,    -1,    -1,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    -1,    -1,    -1,    -1,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      -1,    -1,    -1,    -1,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    73,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    -1,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    -1,    -1,    -1,    -1,
+      -1,    -1,    66,    67,    68,    69,    70,    71,    72,    73,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    -1,    -1,    -1,    -1,    -1,    -1,    66,    67,
+      68,    69,    70,    71,    72,    73,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    -1,    -1,    -1,    -1,    -1,
+      53,    54,    55,    56,    57,    58,    59,    -1,    -1,    -1,
+      -1,    -1,    -1,    66,    67,    68,    69,    70,    71,    72,
+      73
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,   130,     0,     3,     4,     5,     7,     8,     9,    10,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      23,    25,    26,    27,    28,    29,    30,    31,    35,    74,
+      77,    78,    79,    85,    86,    91,    92,    93,    94,   101,
+     102,   103,   105,   107,   109,   115,   116,   117,   121,   131,
+     132,   139,   140,   141,   142,   143,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   163,   164,   165,   166,   167,
+     168,   177,   178,   179,   180,   181,   182,   185,   186,   187,
+       3,     6,    27,    30,    31,    32,    33,    34,    49,    68,
+      72,    73,    80,    81,    89,   153,   154,   155,   156,   157,
+     160,   161,    30,   161,   161,    74,    74,    74,    74,    74,
+      30,    30,    30,    30,   161,    30,   161,    30,    30,   161,
+     161,    30,   161,   161,    15,    65,    76,    65,    74,    31,
+     166,    74,   166,    74,    65,   166,   166,   166,    65,   161,
+     135,   138,    30,    75,   144,    74,   144,    74,    75,    74,
+      75,    74,    75,    74,   144,    74,    75,   144,    74,    15,
+      76,   166,   166,     5,    74,    87,    95,    96,    97,    98,
+      99,   101,   104,   106,   108,   109,   110,   111,   112,   113,
+     114,   115,   127,   161,   170,   171,    74,   169,    74,   118,
+     119,   161,   183,    74,    75,    74,    81,   118,   119,   120,
+     154,   156,   158,   160,   161,   162,   184,    74,    75,    74,
+     122,   123,   124,   127,   161,   188,    74,    75,    81,    30,
+      30,    90,    30,   155,   155,   155,   155,   161,    30,    50,
+      51,    60,    61,    62,    63,    77,    83,    84,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    52,
+      53,    54,    55,    56,    57,    58,    59,    64,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,   161,    74,
+      74,    75,    30,    31,    74,    74,    30,    74,    75,    74,
+      74,    75,   161,   161,    74,    74,    74,    30,    30,   161,
+      30,    30,    30,    30,    30,   161,   161,   109,   161,   171,
+       5,   171,    65,    65,   172,    65,    75,   183,   119,   120,
+     161,   184,   124,   125,   189,    65,   188,   161,    30,    82,
+     155,   155,   155,   155,   155,   155,   155,   155,   155,   161,
+     161,   161,   161,   161,   161,   161,   161,   161,   161,   161,
+     161,   161,   161,   161,   161,   161,   161,   161,   161,   161,
+     161,   161,   161,   161,   161,   161,   161,   133,   134,   161,
+      31,    30,    31,    30,   136,   137,    74,    74,    76,    76,
+      76,    76,    74,    74,   171,   127,   127,     5,    88,    99,
+     100,   101,   109,   161,   175,   176,     5,   161,   170,    82,
+      72,    73,    82,   159,    82,    72,   126,   128,   161,    75,
+      82,    65,   145,   163,    74,   145,   163,    30,    31,    30,
+      31,    30,    31,    30,    31,   174,   173,    88,   161,     5,
+     161,    72,    77,   159,   159,    65,    65,   128,   161,   157,
+     157,    72,    73,    82,   123,   161,   161,    78,   161,   161,
+      74,    74,   176,   176,   161,   161,    99,    31,   176,   176,
+     157,   157,    72,   128,   128,   161,    82,   128,   128,    77,
+     159,   159,   128,    31,   159
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,   129,   130,   130,   131,   131,   131,   131,   131,   132,
+     132,   132,   132,   132,   132,   132,   132,   133,   132,   134,
+     132,   132,   132,   135,   132,   132,   132,   132,   132,   132,
+     132,   132,   132,   136,   132,   137,   132,   132,   132,   132,
+     132,   132,   132,   132,   132,   138,   132,   139,   139,   140,
+     140,   141,   142,   142,   143,   143,   143,   143,   144,   144,
+     145,   145,   146,   146,   147,   147,   148,   148,   148,   148,
+     149,   149,   149,   150,   150,   150,   150,   151,   151,   151,
+     151,   151,   151,   152,   152,   153,   153,   153,   154,   154,
+     154,   154,   154,   154,   154,   154,   154,   154,   154,   154,
+     154,   154,   154,   155,   155,   156,   156,   156,   156,   156,
+     156,   156,   156,   156,   157,   157,   158,   158,   159,   159,
+     159,   159,   160,   160,   160,   160,   160,   160,   160,   160,
+     160,   160,   160,   160,   160,   160,   160,   160,   160,   160,
+     160,   160,   160,   160,   160,   160,   160,   160,   160,   160,
+     161,   161,   162,   162,   145,   132,   132,   132,   132,   163,
+     164,   164,   165,   165,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   167,   168,   169,   168,   170,   170,   170,
+     170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
+     170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
+     172,   171,   173,   171,   174,   171,   175,   175,   175,   176,
+     176,   176,   176,   176,   176,   176,   176,   176,   176,   176,
+     176,   176,   176,   176,   163,   163,   177,   178,   178,   179,
+     179,   180,   181,   181,   182,   182,   183,   183,   183,   184,
+     184,   184,   184,   184,   184,   184,   184,   163,   185,   186,
+     186,   187,   187,   188,   188,   188,   188,   188,   188,   188,
+     188,   188,   188,   188,   189,   189,   161,   161
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     1,     1,     2,     1,     1,     2,
+       5,     4,     4,     4,     4,     3,     3,     0,     6,     0,
+       5,     3,     2,     0,     3,     2,     3,     2,     3,     3,
+       2,     2,     3,     0,     6,     0,     5,     3,     2,     2,
+       2,     2,     2,     2,     2,     0,     3,     2,     4,     1,
+       1,     2,     2,     3,     2,     3,     5,     5,     0,     1,
+       2,     3,     2,     3,     2,     3,     3,     3,     5,     5,
+       3,     4,     4,     2,     3,     3,     4,     3,     3,     5,
+       5,     5,     5,     1,     1,     1,     1,     1,     1,     2,
+       1,     1,     1,     1,     2,     1,     1,     2,     2,     2,
+       2,     4,     6,     1,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     1,     1,     1,     1,     2,     2,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     5,
+       1,     1,     1,     1,     2,     2,     3,     2,     2,     1,
+       1,     2,     1,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     1,     2,     0,     4,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       1,     2,     2,     3,     3,     4,     1,     1,     1,     1,
+       0,     4,     0,     6,     0,     6,     1,     3,     3,     1,
+       2,     1,     2,     3,     4,     3,     4,     5,     6,     1,
+       2,     2,     3,     3,     1,     1,     1,     2,     3,     2,
+       2,     1,     2,     3,     2,     2,     1,     1,     1,     1,
+       1,     1,     1,     3,     3,     3,     4,     1,     1,     2,
+       3,     2,     2,     1,     1,     1,     3,     5,     4,     5,
+       5,     6,     1,     3,     1,     1,     2,     3
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 4: /* line: '\n'  */
+#line 122 "../x86/../parser.y"
+                {
+			advance_line();
+		}
+#line 1988 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 6: /* line: data '\n'  */
+#line 127 "../x86/../parser.y"
+                {
+			advance_line();
+		}
+#line 1996 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 8: /* line: TOK_MACRONAME  */
+#line 132 "../x86/../parser.y"
+                {
+			invoke_macro((yyvsp[0].macro));
+			advance_line();
+		}
+#line 2005 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 9: /* directive: section_directive '\n'  */
+#line 140 "../x86/../parser.y"
+                {
+			advance_line();
+		}
+#line 2013 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 10: /* directive: KWD_EQU TOK_IDENTIFIER ',' expression '\n'  */
+#line 144 "../x86/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-3].s), (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-3].s), (yyvsp[-1].x));
+			advance_line();
+		}
+#line 2024 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 11: /* directive: TOK_IDENTIFIER KWD_EQU expression '\n'  */
+#line 151 "../x86/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-3].s), (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-3].s), (yyvsp[-1].x));
+			advance_line();
+		}
+#line 2035 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 12: /* directive: TOK_IDENTIFIER '=' expression '\n'  */
+#line 158 "../x86/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-3].s), (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-3].s), (yyvsp[-1].x));
+			advance_line();
+		}
+#line 2046 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 13: /* directive: here KWD_EQU expression '\n'  */
+#line 165 "../x86/../parser.y"
+                {
+			instruction_make_set_location(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2056 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 14: /* directive: here '=' expression '\n'  */
+#line 171 "../x86/../parser.y"
+                {
+			instruction_make_set_location(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2066 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 15: /* directive: KWD_ORG expression '\n'  */
+#line 177 "../x86/../parser.y"
+                {
+			instruction_make_set_location(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2076 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 16: /* directive: KWD_ALIGN expression '\n'  */
+#line 183 "../x86/../parser.y"
+                {
+			instruction_make_skip(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, (yyvsp[-1].x),
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2094 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 17: /* $@1: %empty  */
+#line 197 "../x86/../parser.y"
+                {
+			instruction_make_fill(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, (yyvsp[-1].x),
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2111 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 18: /* directive: KWD_ALIGN expression ',' $@1 data '\n'  */
+#line 210 "../x86/../parser.y"
+                {
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2121 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 19: /* $@2: %empty  */
+#line 216 "../x86/../parser.y"
+                {
+			instruction_make_fill(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, (yyvsp[-1].x),
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2138 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 20: /* directive: KWD_ALIGN expression ',' $@2 instruction  */
+#line 229 "../x86/../parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2149 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 21: /* directive: KWD_TIMES expression '\n'  */
+#line 236 "../x86/../parser.y"
+                {
+			instruction_make_times(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2159 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 22: /* directive: KWD_ENDTIMES '\n'  */
+#line 242 "../x86/../parser.y"
+                {
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2169 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 23: /* $@3: %empty  */
+#line 248 "../x86/../parser.y"
+                {
+			parse_repeat_definition();
+		}
+#line 2177 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 24: /* directive: repeat_directive $@3 '\n'  */
+#line 252 "../x86/../parser.y"
+                {
+			advance_line();
+		}
+#line 2185 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 25: /* directive: KWD_ENDREPEAT '\n'  */
+#line 256 "../x86/../parser.y"
+                {
+			yyerror("no matching .repeat found for .endrepeat");
+			YYABORT;
+		}
+#line 2194 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 26: /* directive: KWD_FILL expression '\n'  */
+#line 261 "../x86/../parser.y"
+                {
+			instruction_make_fill(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2204 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 27: /* directive: KWD_ENDFILL '\n'  */
+#line 267 "../x86/../parser.y"
+                {
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2214 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 28: /* directive: KWD_IF expression '\n'  */
+#line 273 "../x86/../parser.y"
+                {
+			handle_if_directive((yyvsp[-1].x));
+			// TODO: optionally delete $2
+			advance_line();
+		}
+#line 2224 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 29: /* directive: KWD_ELSE_IF expression '\n'  */
+#line 279 "../x86/../parser.y"
+                {
+			handle_else_if_directive((yyvsp[-1].x));
+			// TODO: optionally delete $2
+			advance_line();
+		}
+#line 2234 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 30: /* directive: KWD_ELSE '\n'  */
+#line 285 "../x86/../parser.y"
+                {
+			handle_else_directive();
+			advance_line();
+		}
+#line 2243 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 31: /* directive: KWD_ENDIF '\n'  */
+#line 290 "../x86/../parser.y"
+                {
+			handle_end_if_directive();
+			advance_line();
+		}
+#line 2252 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 32: /* directive: KWD_SKIP expression '\n'  */
+#line 295 "../x86/../parser.y"
+                {
+			instruction_make_skip(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2262 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 33: /* $@4: %empty  */
+#line 301 "../x86/../parser.y"
+                {
+			instruction_make_times(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2271 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 34: /* directive: KWD_TIMES expression ',' $@4 data '\n'  */
+#line 306 "../x86/../parser.y"
+                {
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+#line 2281 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 35: /* $@5: %empty  */
+#line 312 "../x86/../parser.y"
+                {
+			instruction_make_times(&current_instruction, current_parser_state, (yyvsp[-1].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2290 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 36: /* directive: KWD_TIMES expression ',' $@5 instruction  */
+#line 317 "../x86/../parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2301 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 37: /* directive: KWD_ENTRY TOK_IDENTIFIER '\n'  */
+#line 324 "../x86/../parser.y"
+                {
+			if(entry_point_name == NULL)
+			{
+				entry_point_name = (yyvsp[-1].s);
+			}
+			else
+			{
+				yyerror("Error: repeated .entry directive\n");
+				if(!is_replacement)
+					free((yyvsp[-1].s));
+			}
+			advance_line();
+		}
+#line 2319 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 38: /* directive: TOK_IDENTIFIER ':'  */
+#line 338 "../x86/../parser.y"
+                {
+			instruction_make_equ(&current_instruction, current_parser_state, (yyvsp[-1].s), expression_current_location());
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define((yyvsp[-1].s), expression_current_location());
+		}
+#line 2329 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 39: /* directive: TOK_INTEGER ':'  */
+#line 344 "../x86/../parser.y"
+                {
+			instruction_make_local_label(&current_instruction, current_parser_state, (yyvsp[-1].j));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete((yyvsp[-1].j));
+		}
+#line 2340 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 40: /* directive: extern '\n'  */
+#line 351 "../x86/../parser.y"
+                {
+			advance_line();
+		}
+#line 2348 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 41: /* directive: global '\n'  */
+#line 355 "../x86/../parser.y"
+                {
+			advance_line();
+		}
+#line 2356 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 42: /* directive: common '\n'  */
+#line 359 "../x86/../parser.y"
+                {
+			advance_line();
+		}
+#line 2364 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 43: /* directive: import '\n'  */
+#line 363 "../x86/../parser.y"
+                {
+			advance_line();
+		}
+#line 2372 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 44: /* directive: export '\n'  */
+#line 367 "../x86/../parser.y"
+                {
+			advance_line();
+		}
+#line 2380 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 45: /* $@6: %empty  */
+#line 371 "../x86/../parser.y"
+                {
+			parse_macro_definition();
+		}
+#line 2388 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 46: /* directive: macro_definition $@6 '\n'  */
+#line 375 "../x86/../parser.y"
+                {
+			advance_line();
+		}
+#line 2396 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 47: /* repeat_directive: KWD_REPEAT expression  */
+#line 382 "../x86/../parser.y"
+                {
+			if(!begin_repeat_definition((yyvsp[0].x), NULL))
+				YYABORT;
+		}
+#line 2405 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 48: /* repeat_directive: KWD_REPEAT expression ',' TOK_IDENTIFIER  */
+#line 387 "../x86/../parser.y"
+                {
+			if(!begin_repeat_definition((yyvsp[-2].x), (yyvsp[0].s)))
+				YYABORT;
+		}
+#line 2414 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 51: /* macro_definition_head: KWD_MACRO TOK_IDENTIFIER  */
+#line 400 "../x86/../parser.y"
+                {
+			begin_macro_definition((yyvsp[0].s));
+		}
+#line 2422 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 52: /* macro_definition_arguments: macro_definition_head TOK_IDENTIFIER  */
+#line 407 "../x86/../parser.y"
+                {
+			append_macro_definition_parameter((yyvsp[0].s));
+		}
+#line 2430 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 53: /* macro_definition_arguments: macro_definition_arguments comma_opt TOK_IDENTIFIER  */
+#line 411 "../x86/../parser.y"
+                {
+			append_macro_definition_parameter((yyvsp[0].s));
+		}
+#line 2438 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 54: /* section_directive: KWD_SECTION TOK_IDENTIFIER  */
+#line 418 "../x86/../parser.y"
+                {
+			instruction_make_section(&current_instruction, current_parser_state, (yyvsp[0].s));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2447 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 55: /* section_directive: section_directive comma_opt TOK_IDENTIFIER  */
+#line 423 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[1].parameter, expression_identifier((yyvsp[0].s)));
+		}
+#line 2455 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 56: /* section_directive: section_directive comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 427 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[1].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+		}
+#line 2466 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 57: /* section_directive: section_directive comma_opt TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 434 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[1].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+		}
+#line 2477 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 60: /* data: TOK_DATA expression  */
+#line 449 "../x86/../parser.y"
+                {
+			instruction_make_data(&current_instruction, current_parser_state, (yyvsp[-1].i), (yyvsp[0].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			(yyval.i) = (yyvsp[-1].i);
+		}
+#line 2487 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 61: /* data: data ',' expression  */
+#line 455 "../x86/../parser.y"
+                {
+			instruction_make_data(&current_instruction, current_parser_state, (yyvsp[-2].i), (yyvsp[0].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			(yyval.i) = (yyvsp[-2].i);
+		}
+#line 2497 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 62: /* extern: KWD_EXTERN TOK_IDENTIFIER  */
+#line 464 "../x86/../parser.y"
+                {
+			instruction_make_external(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2506 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 63: /* extern: extern ',' TOK_IDENTIFIER  */
+#line 469 "../x86/../parser.y"
+                {
+			instruction_make_external(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2515 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 64: /* global: KWD_GLOBAL TOK_IDENTIFIER  */
+#line 477 "../x86/../parser.y"
+                {
+			instruction_make_global(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2524 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 65: /* global: global ',' TOK_IDENTIFIER  */
+#line 482 "../x86/../parser.y"
+                {
+			instruction_make_global(&current_instruction, current_parser_state, (yyvsp[0].s));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2533 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 66: /* common: KWD_COMMON TOK_IDENTIFIER expression  */
+#line 490 "../x86/../parser.y"
+                {
+			instruction_make_common(&current_instruction, current_parser_state, (yyvsp[-1].s), (yyvsp[0].x));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2542 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 67: /* common: common comma_opt TOK_IDENTIFIER  */
+#line 495 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[2].parameter, expression_identifier((yyvsp[0].s)));
+			(yyval.ins) = (yyvsp[-2].ins);
+		}
+#line 2551 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 68: /* common: common comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 500 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[2].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2563 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 69: /* common: common comma_opt TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 508 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[2].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2575 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 70: /* import: KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER  */
+#line 519 "../x86/../parser.y"
+                {
+			instruction_make_import(&current_instruction, current_parser_state, (yyvsp[-1].s), (yyvsp[0].s), NULL);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2584 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 71: /* import: KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_IDENTIFIER  */
+#line 524 "../x86/../parser.y"
+                {
+			instruction_make_import(&current_instruction, current_parser_state, (yyvsp[-2].s), (yyvsp[-1].s), expression_identifier((yyvsp[0].s)));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2593 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 72: /* import: KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_INTEGER  */
+#line 529 "../x86/../parser.y"
+                {
+			instruction_make_import(&current_instruction, current_parser_state, (yyvsp[-2].s), (yyvsp[-1].s), expression_integer((yyvsp[0].j)));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2602 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 73: /* export_head: KWD_EXPORT TOK_IDENTIFIER  */
+#line 537 "../x86/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[0].s), NULL, NO_ORDINAL);
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2611 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 74: /* export_head: KWD_EXPORT TOK_IDENTIFIER TOK_IDENTIFIER  */
+#line 542 "../x86/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[-1].s), (yyvsp[0].s), NO_ORDINAL);
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 2620 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 75: /* export_head: KWD_EXPORT TOK_IDENTIFIER TOK_INTEGER  */
+#line 547 "../x86/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[-1].s), NULL, (yyvsp[0].j));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2631 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 76: /* export_head: KWD_EXPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_INTEGER  */
+#line 554 "../x86/../parser.y"
+                {
+			instruction_make_export(&current_instruction, current_parser_state, (yyvsp[-2].s), (yyvsp[-1].s), (yyvsp[0].j));
+			(yyval.ins) = instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2642 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 77: /* export_directive: export_head ',' TOK_IDENTIFIER  */
+#line 564 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[3].parameter, expression_identifier((yyvsp[0].s)));
+			(yyval.ins) = (yyvsp[-2].ins);
+		}
+#line 2651 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 78: /* export_directive: export_directive comma_opt TOK_IDENTIFIER  */
+#line 569 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-2].ins)->operand[3].parameter, expression_identifier((yyvsp[0].s)));
+			(yyval.ins) = (yyvsp[-2].ins);
+		}
+#line 2660 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 79: /* export_directive: export_head ',' TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 574 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2672 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 80: /* export_directive: export_directive comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER  */
+#line 582 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_identifier((yyvsp[0].s))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2684 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 81: /* export_directive: export_head ',' TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 590 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2696 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 82: /* export_directive: export_directive comma_opt TOK_IDENTIFIER '=' TOK_INTEGER  */
+#line 598 "../x86/../parser.y"
+                {
+			expression_list_append((yyvsp[-4].ins)->operand[3].parameter,
+				expression_assignment(
+					expression_identifier((yyvsp[-2].s)),
+					expression_integer((yyvsp[0].j))));
+			(yyval.ins) = (yyvsp[-4].ins);
+		}
+#line 2708 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 88: /* prefix_expression_noparen: TOK_IDENTIFIER  */
+#line 620 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_identifier((yyvsp[0].s));
+		}
+#line 2716 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 89: /* prefix_expression_noparen: KWD_SECTION TOK_IDENTIFIER  */
+#line 624 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_section((yyvsp[0].s));
+		}
+#line 2724 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 90: /* prefix_expression_noparen: TOK_LABEL_FORWARD  */
+#line 628 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_label_forward((yyvsp[0].j));
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2734 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 91: /* prefix_expression_noparen: TOK_LABEL_BACKWARD  */
+#line 634 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_label_backward((yyvsp[0].j));
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2744 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 92: /* prefix_expression_noparen: TOK_INTEGER  */
+#line 640 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_integer((yyvsp[0].j));
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 2754 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 93: /* prefix_expression_noparen: TOK_STRING  */
+#line 646 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_string((yyvsp[0].s));
+		}
+#line 2762 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 94: /* prefix_expression_noparen: KWD_DEFINED TOK_IDENTIFIER  */
+#line 650 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_is_defined((yyvsp[0].s));
+		}
+#line 2770 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 95: /* prefix_expression_noparen: here  */
+#line 654 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_current_location();
+		}
+#line 2778 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 96: /* prefix_expression_noparen: "$$"  */
+#line 658 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_current_section();
+		}
+#line 2786 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 97: /* prefix_expression_noparen: '+' prefix_expression  */
+#line 662 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_PLUS, (yyvsp[0].x));
+		}
+#line 2794 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 98: /* prefix_expression_noparen: '-' prefix_expression  */
+#line 666 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_MINUS, (yyvsp[0].x));
+		}
+#line 2802 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 99: /* prefix_expression_noparen: '~' prefix_expression  */
+#line 670 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_BITNOT, (yyvsp[0].x));
+		}
+#line 2810 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 100: /* prefix_expression_noparen: '!' prefix_expression  */
+#line 674 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_NOT, (yyvsp[0].x));
+		}
+#line 2818 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 101: /* prefix_expression_noparen: KWD_ALIGN '(' expression ')'  */
+#line 678 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_ALIGN, (yyvsp[-1].x), expression_current_location());
+		}
+#line 2826 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 102: /* prefix_expression_noparen: KWD_ALIGN '(' expression ',' expression ')'  */
+#line 682 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_ALIGN, (yyvsp[-3].x), (yyvsp[-1].x));
+		}
+#line 2834 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 104: /* prefix_expression: '(' expression ')'  */
+#line 690 "../x86/../parser.y"
+                {
+			(yyval.x) = (yyvsp[-1].x);
+		}
+#line 2842 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 105: /* multiplication: multiplicative_expression '*' prefix_expression  */
+#line 697 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_MUL, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2850 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 106: /* multiplication: multiplicative_expression '/' prefix_expression  */
+#line 701 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_DIVU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2858 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 107: /* multiplication: multiplicative_expression "//" prefix_expression  */
+#line 705 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_DIV, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2866 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 108: /* multiplication: multiplicative_expression '%' prefix_expression  */
+#line 709 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_MODU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2874 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 109: /* multiplication: multiplicative_expression "%%" prefix_expression  */
+#line 713 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_MOD, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2882 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 110: /* multiplication: multiplicative_expression "<<" prefix_expression  */
+#line 717 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHLU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2890 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 111: /* multiplication: multiplicative_expression "<<<" prefix_expression  */
+#line 721 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHL, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2898 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 112: /* multiplication: multiplicative_expression ">>" prefix_expression  */
+#line 725 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHRU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2906 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 113: /* multiplication: multiplicative_expression ">>>" prefix_expression  */
+#line 729 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SHR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2914 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 118: /* addend: '+' multiplicative_expression  */
+#line 746 "../x86/../parser.y"
+                {
+			(yyval.x) = (yyvsp[0].x);
+		}
+#line 2922 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 119: /* addend: '-' multiplicative_expression  */
+#line 750 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_unary(EXP_MINUS, (yyvsp[0].x));
+		}
+#line 2930 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 120: /* addend: addend '+' multiplicative_expression  */
+#line 754 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_ADD, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2938 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 121: /* addend: addend '-' multiplicative_expression  */
+#line 758 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SUB, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2946 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 122: /* operation_expression: expression '+' expression  */
+#line 765 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_ADD, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2954 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 123: /* operation_expression: expression '-' expression  */
+#line 769 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_SUB, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2962 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 124: /* operation_expression: expression '&' expression  */
+#line 773 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITAND, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2970 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 125: /* operation_expression: expression '|' expression  */
+#line 777 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITOR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2978 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 126: /* operation_expression: expression '^' expression  */
+#line 781 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITXOR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2986 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 127: /* operation_expression: expression '!' expression  */
+#line 785 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_BITORNOT, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 2994 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 128: /* operation_expression: expression "==" expression  */
+#line 789 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_EQ, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3002 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 129: /* operation_expression: expression "!=" expression  */
+#line 793 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_NE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3010 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 130: /* operation_expression: expression "<>" expression  */
+#line 797 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_NE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3018 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 131: /* operation_expression: expression "><" expression  */
+#line 801 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_NE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3026 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 132: /* operation_expression: expression '<' expression  */
+#line 805 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LT, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3034 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 133: /* operation_expression: expression '>' expression  */
+#line 809 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GT, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3042 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 134: /* operation_expression: expression "<=" expression  */
+#line 813 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3050 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 135: /* operation_expression: expression "=<" expression  */
+#line 817 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3058 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 136: /* operation_expression: expression ">=" expression  */
+#line 821 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3066 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 137: /* operation_expression: expression "=>" expression  */
+#line 825 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GE, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3074 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 138: /* operation_expression: expression "<=>" expression  */
+#line 829 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_CMP, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3082 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 139: /* operation_expression: expression "#<" expression  */
+#line 833 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LTU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3090 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 140: /* operation_expression: expression "#>" expression  */
+#line 837 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GTU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3098 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 141: /* operation_expression: expression "#<=" expression  */
+#line 841 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3106 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 142: /* operation_expression: expression "#=<" expression  */
+#line 845 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_LEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3114 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 143: /* operation_expression: expression "#>=" expression  */
+#line 849 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3122 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 144: /* operation_expression: expression "#=>" expression  */
+#line 853 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_GEU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3130 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 145: /* operation_expression: expression "#<=>" expression  */
+#line 857 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_CMPU, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3138 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 146: /* operation_expression: expression "&&" expression  */
+#line 861 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_AND, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3146 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 147: /* operation_expression: expression "^^" expression  */
+#line 865 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_XOR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3154 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 148: /* operation_expression: expression "||" expression  */
+#line 869 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_binary(EXP_OR, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3162 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 149: /* operation_expression: expression '?' expression ':' expression  */
+#line 873 "../x86/../parser.y"
+                {
+			(yyval.x) = expression_conditional((yyvsp[-4].x), (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3170 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 154: /* data: TOK_DW expression  */
+#line 77 "../x86/parser.y"
+                {
+			instruction_make_data(&current_instruction, current_parser_state, _DATA_LE(BITSIZE16), (yyvsp[0].x));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			(yyval.i) = _DATA_LE(BITSIZE16);
+		}
+#line 3180 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 155: /* directive: TOK_BITS '\n'  */
+#line 86 "../x86/parser.y"
+                {
+			switch((yyvsp[-1].i))
+			{
+			case BITSIZE16:
+				current_parser_state->bit_size = (yyvsp[-1].i);
+				break;
+			case BITSIZE32:
+				if(current_parser_state->cpu_type < CPU_386)
+				{
+					yyerror("Current architecture does not support 32-bit");
+					YYERROR;
+				}
+				else
+				{
+					current_parser_state->bit_size = (yyvsp[-1].i);
+				}
+				break;
+			case BITSIZE64:
+				if(current_parser_state->cpu_type < CPU_X64)
+				{
+					yyerror("Current architecture does not support 64-bit");
+					YYERROR;
+				}
+				else
+				{
+					current_parser_state->bit_size = (yyvsp[-1].i);
+				}
+				break;
+			default:
+				assert(false);
+			}
+			lexer_switch_mode(current_parser_state);
+			advance_line();
+		}
+#line 3219 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 156: /* directive: KWD_BITS TOK_INTEGER '\n'  */
+#line 121 "../x86/parser.y"
+                {
+			if(!uint_fits(INTVAL((yyvsp[-1].j))))
+			{
+				yyerror("Invalid instruction set bit length");
+				YYERROR;
+			}
+			switch(uint_get(INTVAL((yyvsp[-1].j))))
+			{
+			case 8:
+				switch(current_parser_state->cpu_type)
+				{
+				case CPU_V30:
+					current_parser_state->x80_cpu_type = CPU_8080;
+					break;
+				case CPU_9002:
+					current_parser_state->x80_cpu_type = CPU_Z80;
+					break;
+				default:
+					yyerror("Current architecture does not support 8080/Z80 emulation");
+					YYERROR;
+				}
+				current_parser_state->bit_size = BITSIZE8;
+				break;
+			case 16:
+				current_parser_state->bit_size = BITSIZE16;
+				break;
+			case 32:
+				if(current_parser_state->cpu_type < CPU_386)
+				{
+					yyerror("Current architecture does not support 32-bit");
+					YYERROR;
+				}
+				else
+				{
+					current_parser_state->bit_size = BITSIZE32;
+				}
+				break;
+			case 64:
+				if(current_parser_state->cpu_type < 64)
+				{
+					yyerror("Current architecture does not support 64-bit");
+					YYERROR;
+				}
+				else
+				{
+					current_parser_state->bit_size = BITSIZE64;
+				}
+				break;
+			default:
+				yyerror("Invalid instruction set bit length");
+				YYERROR;
+				break;
+			}
+			lexer_switch_mode(current_parser_state);
+			advance_line();
+		}
+#line 3280 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 157: /* directive: TOK_ARCH '\n'  */
+#line 178 "../x86/parser.y"
+                {
+			if((yyvsp[-1].i) == CPU_8089)
+			{
+				current_parser_state->cpu_type = (yyvsp[-1].i);
+				current_parser_state->bit_size = BITSIZE16;
+			}
+			else if((yyvsp[-1].i) == CPU_8080 || (yyvsp[-1].i) == CPU_Z80)
+			{
+				current_parser_state->x80_cpu_type = (yyvsp[-1].i);
+				current_parser_state->bit_size = BITSIZE8;
+			}
+			else
+			{
+				current_parser_state->cpu_type = (yyvsp[-1].i);
+
+				if(current_parser_state->cpu_type < CPU_386)
+					current_parser_state->bit_size = BITSIZE16;
+				else if(current_parser_state->cpu_type != CPU_X64 && BITSIN(current_parser_state->bit_size) == BITSIZE64)
+					current_parser_state->bit_size = BITSIZE32;
+				else if(current_parser_state->cpu_type != CPU_V30 && current_parser_state->cpu_type != CPU_9002 && BITSIN(current_parser_state->bit_size) == BITSIZE8)
+					current_parser_state->bit_size = BITSIZE16;
+
+				if(current_parser_state->cpu_type < CPU_286)
+					current_parser_state->fpu_type = FPU_8087;
+				else if(current_parser_state->cpu_type < CPU_386)
+					current_parser_state->fpu_type = FPU_287;
+				else
+					current_parser_state->fpu_type = FPU_387;
+
+				if(current_parser_state->cpu_type == CPU_9002)
+					current_parser_state->x80_cpu_type = CPU_Z80;
+				else
+					current_parser_state->x80_cpu_type = CPU_8080;
+			}
+
+			lexer_switch_mode(current_parser_state);
+			advance_line();
+		}
+#line 3323 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 158: /* directive: TOK_FPU '\n'  */
+#line 217 "../x86/parser.y"
+                {
+			current_parser_state->fpu_type = (yyvsp[-1].i);
+			advance_line();
+		}
+#line 3332 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 159: /* instruction: x86_instruction  */
+#line 225 "../x86/parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+//printf("%d\n", ((instruction_t *)((char *)current_instruction_stream->last_instruction - offsetof(instruction_t, next_instruction)))->operation_size);
+		}
+#line 3341 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 164: /* x86_instruction: segment_prefix x86_instruction  */
+#line 243 "../x86/parser.y"
+                {
+			if((yyvsp[-1].i) == REG_DS3)
+			{
+				if(current_instruction.target_segment_prefix != REG_NOSEG)
+				{
+					yyerror("Duplicate segment prefix");
+					YYERROR;
+				}
+				current_instruction.target_segment_prefix = (yyvsp[-1].i);
+				current_instruction.segment_prefix = (yyvsp[-1].i);
+			}
+			else
+			{
+				if(current_instruction.source_segment_prefix != REG_NOSEG)
+				{
+					yyerror("Duplicate segment prefix");
+					YYERROR;
+				}
+				current_instruction.target_segment_prefix = (yyvsp[-1].i);
+				current_instruction.segment_prefix = (yyvsp[-1].i);
+			}
+		}
+#line 3368 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 165: /* x86_instruction: iram_prefix x86_instruction  */
+#line 266 "../x86/parser.y"
+                {
+			if(current_instruction.target_segment_prefix != REG_NOSEG)
+			{
+				yyerror("Duplicate segment prefix");
+				YYERROR;
+			}
+			current_instruction.target_segment_prefix = REG_IRAM;
+			current_instruction.segment_prefix = REG_IRAM;
+		}
+#line 3382 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 166: /* x86_instruction: TOK_REP x86_instruction  */
+#line 276 "../x86/parser.y"
+                {
+			if(current_instruction.repeat_prefix != PREF_NOREP)
+			{
+				yyerror("Duplicate repeat prefix");
+				YYERROR;
+			}
+			current_instruction.repeat_prefix = (yyvsp[-1].i);
+		}
+#line 3395 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 167: /* x86_instruction: TOK_LOCK x86_instruction  */
+#line 285 "../x86/parser.y"
+                {
+			if(current_instruction.lock_prefix)
+			{
+				yyerror("Duplicate lock prefix");
+				YYERROR;
+			}
+			current_instruction.lock_prefix = true;
+		}
+#line 3408 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 168: /* x86_instruction: TOK_OSIZE x86_instruction  */
+#line 294 "../x86/parser.y"
+                {
+			if(current_parser_state->cpu_type < CPU_386)
+			{
+				yyerror("Operation size prefix not permitted for this CPU type");
+				YYERROR;
+			}
+			if((yyvsp[-1].i) == BITSIZE64 && BITSIN(current_parser_state->bit_size) != BITSIZE64)
+			{
+				yyerror("Operation size prefix not permitted for this CPU mode");
+				YYERROR;
+			}
+			if(current_instruction.operation_size != 0)
+			{
+				yyerror("Duplicate operation size prefix");
+				YYERROR;
+			}
+			current_instruction.operation_size = (yyvsp[-1].i);
+		}
+#line 3431 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 169: /* x86_instruction: TOK_ASIZE x86_instruction  */
+#line 313 "../x86/parser.y"
+                {
+			if(current_parser_state->cpu_type < CPU_386)
+			{
+				yyerror("Operation size prefix not permitted for this CPU type");
+				YYERROR;
+			}
+			if((yyvsp[-1].i) == BITSIZE64 && BITSIN(current_parser_state->bit_size) != BITSIZE64)
+			{
+				yyerror("Operation size prefix not permitted for this CPU mode");
+				YYERROR;
+			}
+			if(current_instruction.address_size != 0)
+			{
+				yyerror("Duplicate address size prefix");
+				YYERROR;
+			}
+			current_instruction.address_size = (yyvsp[-1].i);
+		}
+#line 3454 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 170: /* x86_instruction: TOK_286_UMOV_PREFIX x86_instruction  */
+#line 332 "../x86/parser.y"
+                {
+			if(current_instruction.umov_prefix)
+			{
+				yyerror("Duplicate 286 user mode prefix");
+				YYERROR;
+			}
+			current_instruction.umov_prefix = true;
+		}
+#line 3467 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 171: /* x86_instruction: mnemonic '\n'  */
+#line 341 "../x86/parser.y"
+                {
+			advance_line();
+		}
+#line 3475 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 172: /* x86_instruction: mnemonic_operands '\n'  */
+#line 345 "../x86/parser.y"
+                {
+			advance_line();
+		}
+#line 3483 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 173: /* mnemonic: TOK_MNEMONIC  */
+#line 352 "../x86/parser.y"
+                {
+			instruction_clear(&current_instruction, current_parser_state);
+			current_instruction.isa = ISA_X86;
+			current_instruction.mnemonic = _GET_MNEM((yyvsp[0].i));
+			switch(current_instruction.mnemonic)
+			{
+			case MNEM_CMOV_CC:
+			case MNEM_FCMOV_CC:
+			case MNEM_J_CC:
+			case MNEM_SET_CC:
+				current_instruction.condition = _GET_COND((yyvsp[0].i));
+				break;
+			default:
+				break;
+			}
+		}
+#line 3504 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 174: /* mnemonic_operands: mnemonic operand  */
+#line 372 "../x86/parser.y"
+                {
+			current_instruction.operand_count ++;
+		}
+#line 3512 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 175: /* $@7: %empty  */
+#line 376 "../x86/parser.y"
+                {
+			if(current_instruction.operand_count >= MAX_OPD_COUNT)
+			{
+				yyerror("Too many operands to instruction");
+				YYERROR;
+			}
+		}
+#line 3524 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 176: /* mnemonic_operands: mnemonic_operands $@7 ',' operand  */
+#line 384 "../x86/parser.y"
+                {
+			current_instruction.operand_count ++;
+		}
+#line 3532 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 177: /* operand: TOK_GPR  */
+#line 391 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, _OPD_TYPE((yyvsp[0].i)), _OPD_VALUE((yyvsp[0].i)));
+		}
+#line 3540 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 178: /* operand: TOK_DW  */
+#line 395 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_GPRW, REG_DX);
+		}
+#line 3548 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 179: /* operand: TOK_SEG  */
+#line 399 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_SEG, (yyvsp[0].i));
+		}
+#line 3556 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 180: /* operand: TOK_STREG  */
+#line 403 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_STREG, (yyvsp[0].i));
+		}
+#line 3564 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 181: /* operand: TOK_CREG  */
+#line 407 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_CREG, (yyvsp[0].i));
+		}
+#line 3572 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 182: /* operand: TOK_DREG  */
+#line 411 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_DREG, (yyvsp[0].i));
+		}
+#line 3580 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 183: /* operand: TOK_TREG  */
+#line 415 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_TREG, (yyvsp[0].i));
+		}
+#line 3588 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 184: /* operand: TOK_MMREG  */
+#line 419 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_MMREG, (yyvsp[0].i));
+		}
+#line 3596 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 185: /* operand: TOK_XMMREG  */
+#line 423 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_XMMREG, (yyvsp[0].i));
+		}
+#line 3604 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 186: /* operand: TOK_YMMREG  */
+#line 427 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_YMMREG, (yyvsp[0].i));
+		}
+#line 3612 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 187: /* operand: TOK_ZMMREG  */
+#line 431 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_ZMMREG, (yyvsp[0].i));
+		}
+#line 3620 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 188: /* operand: expression  */
+#line 435 "../x86/parser.y"
+                {
+			operand_set_immediate(&current_operand, (yyvsp[0].x));
+		}
+#line 3628 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 189: /* operand: TOK_DATA expression  */
+#line 439 "../x86/parser.y"
+                {
+			operand_set_immediate(&current_operand, (yyvsp[0].x));
+			current_operand.size = _GET_DATA_SIZE((yyvsp[-1].i));
+		}
+#line 3637 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 191: /* operand: TOK_DATA address_operand  */
+#line 445 "../x86/parser.y"
+                {
+			current_operand.size = _GET_DATA_SIZE((yyvsp[-1].i));
+		}
+#line 3645 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 192: /* operand: KWD_FAR address_operand  */
+#line 449 "../x86/parser.y"
+                {
+			current_operand.type = OPD_FARMEM;
+		}
+#line 3653 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 193: /* operand: KWD_FAR TOK_DATA address_operand  */
+#line 453 "../x86/parser.y"
+                {
+			current_operand.type = OPD_FARMEM;
+			current_operand.size = _GET_DATA_SIZE((yyvsp[-1].i));
+		}
+#line 3662 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 194: /* operand: expression ':' expression  */
+#line 458 "../x86/parser.y"
+                {
+			operand_set_far_address(&current_operand, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 3670 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 195: /* operand: expression ':' TOK_DATA expression  */
+#line 462 "../x86/parser.y"
+                {
+			operand_set_far_address(&current_operand, (yyvsp[-3].x), (yyvsp[0].x));
+			current_operand.size = _GET_DATA_SIZE((yyvsp[-1].i));
+		}
+#line 3679 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 196: /* operand: TOK_PSWREG  */
+#line 467 "../x86/parser.y"
+                {
+			operand_set(&current_operand, OPD_PSW);
+		}
+#line 3687 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 197: /* operand: TOK_RSYMBOL  */
+#line 471 "../x86/parser.y"
+                {
+			operand_set(&current_operand, OPD_RREG);
+		}
+#line 3695 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 198: /* operand: TOK_CYSYMBOL  */
+#line 475 "../x86/parser.y"
+                {
+			operand_set(&current_operand, OPD_CY);
+		}
+#line 3703 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 199: /* operand: TOK_DIRSYMBOL  */
+#line 479 "../x86/parser.y"
+                {
+			operand_set(&current_operand, OPD_DIR);
+		}
+#line 3711 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 200: /* $@8: %empty  */
+#line 486 "../x86/parser.y"
+                {
+			operand_set_memory(&current_operand);
+		}
+#line 3719 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 202: /* $@9: %empty  */
+#line 491 "../x86/parser.y"
+                {
+			operand_set_memory(&current_operand);
+		}
+#line 3727 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 203: /* address_operand: TOK_SEG ':' '[' $@9 address_offset ']'  */
+#line 495 "../x86/parser.y"
+                {
+			current_operand.segment = (yyvsp[-5].i);
+		}
+#line 3735 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 204: /* $@10: %empty  */
+#line 499 "../x86/parser.y"
+                {
+			operand_set_memory(&current_operand);
+		}
+#line 3743 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 205: /* address_operand: TOK_IRAM ':' '[' $@10 address_offset ']'  */
+#line 503 "../x86/parser.y"
+                {
+			current_operand.segment = REG_IRAM;
+		}
+#line 3751 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 207: /* address: TOK_SEG ':' address_offset  */
+#line 511 "../x86/parser.y"
+                {
+			current_operand.segment = (yyvsp[-2].i);
+		}
+#line 3759 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 208: /* address: TOK_IRAM ':' address_offset  */
+#line 515 "../x86/parser.y"
+                {
+			current_operand.segment = REG_IRAM;
+		}
+#line 3767 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 209: /* address_offset: expression  */
+#line 522 "../x86/parser.y"
+                {
+			current_operand.address_size = current_parser_state->bit_size;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3776 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 210: /* address_offset: TOK_DATA expression  */
+#line 527 "../x86/parser.y"
+                {
+			current_operand.address_size = _GET_DATA_SIZE((yyvsp[-1].i));
+			if(BITSIN(current_parser_state->bit_size) != BITSIZE64
+				? BITSIN(current_operand.address_size) == BITSIZE64
+				: BITSIN(current_operand.address_size) == BITSIZE16)
+			{
+				yyerror("Invalid address size\n");
+				YYERROR;
+			}
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3792 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 211: /* address_offset: TOK_GPR  */
+#line 539 "../x86/parser.y"
+                {
+			current_operand.address_size = gprsize(_OPD_TYPE((yyvsp[0].i)));
+			current_operand.base = _OPD_VALUE((yyvsp[0].i));
+		}
+#line 3801 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 212: /* address_offset: TOK_GPR addend  */
+#line 544 "../x86/parser.y"
+                {
+			current_operand.address_size = gprsize(_OPD_TYPE((yyvsp[-1].i)));
+			current_operand.base = _OPD_VALUE((yyvsp[-1].i));
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3811 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 213: /* address_offset: TOK_GPR '*' TOK_INTEGER  */
+#line 550 "../x86/parser.y"
+                {
+			current_operand.address_size = gprsize(_OPD_TYPE((yyvsp[-2].i)));
+			if(!validate_scale_permissive(current_operand.address_size, (yyvsp[0].j)))
+			{
+				yyerror("Invalid scale in memory address");
+				YYERROR;
+			}
+			current_operand.index = _OPD_VALUE((yyvsp[-2].i));
+			current_operand.scale = uint_get(INTVAL((yyvsp[0].j)));
+			if(current_operand.scale != 1 && (current_operand.scale & 1) != 0)
+			{
+				current_operand.base = _OPD_VALUE((yyvsp[-2].i));
+				current_operand.scale --;
+			}
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 3833 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 214: /* address_offset: TOK_GPR '*' TOK_INTEGER addend  */
+#line 568 "../x86/parser.y"
+                {
+			current_operand.address_size = gprsize(_OPD_TYPE((yyvsp[-3].i)));
+			if(!validate_scale_permissive(current_operand.address_size, (yyvsp[-1].j)))
+			{
+				yyerror("Invalid scale in memory address");
+				YYERROR;
+			}
+			current_operand.index = _OPD_VALUE((yyvsp[-3].i));
+			current_operand.scale = uint_get(INTVAL((yyvsp[-1].j)));
+			if(current_operand.scale != 1 && (current_operand.scale & 1) != 0)
+			{
+				current_operand.base = _OPD_VALUE((yyvsp[-3].i));
+				current_operand.scale --;
+			}
+			current_operand.parameter = (yyvsp[0].x);
+			if(!is_replacement)
+				int_delete((yyvsp[-1].j));
+		}
+#line 3856 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 215: /* address_offset: TOK_GPR '+' TOK_GPR  */
+#line 587 "../x86/parser.y"
+                {
+			current_operand.address_size = gprsize(_OPD_TYPE((yyvsp[-2].i)));
+			if(current_operand.address_size != gprsize(_OPD_TYPE((yyvsp[0].i))))
+			{
+				yyerror("Base/index register size mismatch");
+				YYERROR;
+			}
+			current_operand.base = _OPD_VALUE((yyvsp[-2].i));
+			current_operand.index = _OPD_VALUE((yyvsp[0].i));
+		}
+#line 3871 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 216: /* address_offset: TOK_GPR '+' TOK_GPR addend  */
+#line 598 "../x86/parser.y"
+                {
+			current_operand.address_size = gprsize(_OPD_TYPE((yyvsp[-3].i)));
+			if(current_operand.address_size != gprsize(_OPD_TYPE((yyvsp[-1].i))))
+			{
+				yyerror("Base/index register size mismatch");
+				YYERROR;
+			}
+			current_operand.base = _OPD_VALUE((yyvsp[-3].i));
+			current_operand.index = _OPD_VALUE((yyvsp[-1].i));
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3887 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 217: /* address_offset: TOK_GPR '+' TOK_GPR '*' TOK_INTEGER  */
+#line 610 "../x86/parser.y"
+                {
+			current_operand.address_size = gprsize(_OPD_TYPE((yyvsp[-4].i)));
+			if(current_operand.address_size != gprsize(_OPD_TYPE((yyvsp[-2].i))))
+			{
+				yyerror("Base/index register size mismatch");
+				YYERROR;
+			}
+			if(!validate_scale_strict(current_operand.address_size, (yyvsp[0].j)))
+			{
+				yyerror("Invalid scale in memory address");
+				YYERROR;
+			}
+			current_operand.base = _OPD_VALUE((yyvsp[-4].i));
+			current_operand.index = _OPD_VALUE((yyvsp[-2].i));
+			current_operand.scale = uint_get(INTVAL((yyvsp[0].j)));
+			if(!is_replacement)
+				int_delete((yyvsp[0].j));
+		}
+#line 3910 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 218: /* address_offset: TOK_GPR '+' TOK_GPR '*' TOK_INTEGER addend  */
+#line 629 "../x86/parser.y"
+                {
+			current_operand.address_size = gprsize(_OPD_TYPE((yyvsp[-5].i)));
+			if(current_operand.address_size != gprsize(_OPD_TYPE((yyvsp[-3].i))))
+			{
+				yyerror("Base/index register size mismatch");
+				YYERROR;
+			}
+			if(!validate_scale_strict(current_operand.address_size, (yyvsp[-1].j)))
+			{
+				yyerror("Invalid scale in memory address");
+				YYERROR;
+			}
+			current_operand.base = _OPD_VALUE((yyvsp[-5].i));
+			current_operand.index = _OPD_VALUE((yyvsp[-3].i));
+			current_operand.scale = uint_get(INTVAL((yyvsp[-1].j)));
+			if(!is_replacement)
+				int_delete((yyvsp[-1].j));
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3934 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 219: /* address_offset: TOK_IPREG  */
+#line 649 "../x86/parser.y"
+                {
+			current_operand.address_size = gprsize(_OPD_TYPE((yyvsp[0].i)));
+			current_operand.base = REG_IP;
+		}
+#line 3943 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 220: /* address_offset: TOK_IPREG addend  */
+#line 654 "../x86/parser.y"
+                {
+			current_operand.address_size = gprsize(_OPD_TYPE((yyvsp[-1].i)));
+			current_operand.base = REG_IP;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3953 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 221: /* address_offset: KWD_REL expression  */
+#line 660 "../x86/parser.y"
+                {
+			current_operand.address_size = current_parser_state->bit_size;
+			current_operand.base = REG_IPREL;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3963 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 222: /* address_offset: TOK_DATA KWD_REL expression  */
+#line 666 "../x86/parser.y"
+                {
+			current_operand.address_size = _GET_DATA_SIZE((yyvsp[-2].i));
+			current_operand.base = REG_IPREL;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3973 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 223: /* address_offset: KWD_REL TOK_DATA expression  */
+#line 672 "../x86/parser.y"
+                {
+			current_operand.address_size = _GET_DATA_SIZE((yyvsp[-1].i));
+			current_operand.base = REG_IPREL;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 3983 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 224: /* instruction: i8080_instruction  */
+#line 681 "../x86/parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 3991 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 225: /* instruction: z80_instruction  */
+#line 685 "../x86/parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 3999 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 226: /* i8080_mnemonic: TOK_I8080_MNEM  */
+#line 692 "../x86/parser.y"
+                {
+			instruction_clear(&current_instruction, current_parser_state);
+			current_instruction.isa = ISA_X80;
+			current_instruction.mnemonic = _GET_MNEM((yyvsp[0].i));
+			switch(current_instruction.mnemonic)
+			{
+			case MNEM_I8080_C_CC:
+			case MNEM_I8080_J_CC:
+			case MNEM_I8080_R_CC:
+				current_instruction.condition = _GET_COND((yyvsp[0].i));
+				break;
+			default:
+				break;
+			}
+		}
+#line 4019 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 227: /* i8080_mnemonic_operands: i8080_mnemonic i8080_operand  */
+#line 711 "../x86/parser.y"
+                {
+			current_instruction.operand_count ++;
+		}
+#line 4027 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 228: /* i8080_mnemonic_operands: i8080_mnemonic_operands ',' i8080_operand  */
+#line 715 "../x86/parser.y"
+                {
+			current_instruction.operand_count ++;
+		}
+#line 4035 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 229: /* i8080_instruction: i8080_mnemonic '\n'  */
+#line 722 "../x86/parser.y"
+                {
+			advance_line();
+		}
+#line 4043 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 230: /* i8080_instruction: i8080_mnemonic_operands '\n'  */
+#line 726 "../x86/parser.y"
+                {
+			advance_line();
+		}
+#line 4051 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 231: /* z80_mnemonic: TOK_Z80_MNEM  */
+#line 733 "../x86/parser.y"
+                {
+			instruction_clear(&current_instruction, current_parser_state);
+			current_instruction.isa = ISA_X80;
+			current_instruction.mnemonic = (yyvsp[0].i);
+		}
+#line 4061 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 232: /* z80_mnemonic_operands: z80_mnemonic z80_operand  */
+#line 742 "../x86/parser.y"
+                {
+			current_instruction.operand_count ++;
+		}
+#line 4069 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 233: /* z80_mnemonic_operands: z80_mnemonic_operands ',' z80_operand  */
+#line 746 "../x86/parser.y"
+                {
+			current_instruction.operand_count ++;
+		}
+#line 4077 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 234: /* z80_instruction: z80_mnemonic '\n'  */
+#line 753 "../x86/parser.y"
+                {
+			advance_line();
+		}
+#line 4085 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 235: /* z80_instruction: z80_mnemonic_operands '\n'  */
+#line 757 "../x86/parser.y"
+                {
+			advance_line();
+		}
+#line 4093 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 236: /* i8080_operand: TOK_X80_REG  */
+#line 764 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_TOKEN, (yyvsp[0].i));
+		}
+#line 4101 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 237: /* i8080_operand: TOK_X80_MEM  */
+#line 768 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_TOKEN, (yyvsp[0].i));
+		}
+#line 4109 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 238: /* i8080_operand: expression  */
+#line 772 "../x86/parser.y"
+                {
+			operand_set_immediate(&current_operand, (yyvsp[0].x));
+		}
+#line 4117 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 239: /* z80_operand: TOK_X80_REG  */
+#line 779 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_TOKEN, (yyvsp[0].i));
+		}
+#line 4125 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 240: /* z80_operand: TOK_X80_MEM  */
+#line 783 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_TOKEN, (yyvsp[0].i));
+		}
+#line 4133 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 241: /* z80_operand: TOK_X80_IDX  */
+#line 787 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_TOKEN, (yyvsp[0].i));
+		}
+#line 4141 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 242: /* z80_operand: expression_noparen  */
+#line 791 "../x86/parser.y"
+                {
+			operand_set_immediate(&current_operand, (yyvsp[0].x));
+		}
+#line 4149 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 243: /* z80_operand: '(' expression ')'  */
+#line 795 "../x86/parser.y"
+                {
+			operand_set_memory(&current_operand);
+			current_operand.parameter = (yyvsp[-1].x);
+		}
+#line 4158 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 244: /* z80_operand: '(' TOK_X80_MEM ')'  */
+#line 800 "../x86/parser.y"
+                {
+			operand_set_memory(&current_operand);
+			current_operand.base = (yyvsp[-1].i);
+		}
+#line 4167 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 245: /* z80_operand: '(' TOK_X80_IDX ')'  */
+#line 805 "../x86/parser.y"
+                {
+			operand_set_memory(&current_operand);
+			current_operand.base = (yyvsp[-1].i);
+		}
+#line 4176 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 246: /* z80_operand: '(' TOK_X80_IDX addend ')'  */
+#line 810 "../x86/parser.y"
+                {
+			operand_set_memory(&current_operand);
+			current_operand.base = (yyvsp[-2].i);
+			current_operand.parameter = (yyvsp[-1].x);
+		}
+#line 4186 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 247: /* instruction: i8089_instruction  */
+#line 819 "../x86/parser.y"
+                {
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+#line 4194 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 248: /* i8089_mnemonic: TOK_I8089_MNEM  */
+#line 826 "../x86/parser.y"
+                {
+			instruction_clear(&current_instruction, current_parser_state);
+			current_instruction.isa = ISA_8089;
+			current_instruction.mnemonic = (yyvsp[0].i);
+		}
+#line 4204 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 249: /* i8089_mnemonic_operand: i8089_mnemonic i8089_operand  */
+#line 835 "../x86/parser.y"
+                {
+			current_instruction.operand_count ++;
+		}
+#line 4212 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 250: /* i8089_mnemonic_operand: i8089_mnemonic_operand ',' i8089_operand  */
+#line 839 "../x86/parser.y"
+                {
+			current_instruction.operand_count ++;
+		}
+#line 4220 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 251: /* i8089_instruction: i8089_mnemonic '\n'  */
+#line 846 "../x86/parser.y"
+                {
+			advance_line();
+		}
+#line 4228 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 252: /* i8089_instruction: i8089_mnemonic_operand '\n'  */
+#line 850 "../x86/parser.y"
+                {
+			advance_line();
+		}
+#line 4236 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 253: /* i8089_operand: TOK_I8089_VALREG  */
+#line 857 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_GPRW, (yyvsp[0].i));
+		}
+#line 4244 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 254: /* i8089_operand: TOK_I8089_IXREG  */
+#line 861 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_GPRW, (yyvsp[0].i));
+		}
+#line 4252 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 255: /* i8089_operand: TOK_I8089_PTRREG  */
+#line 865 "../x86/parser.y"
+                {
+			operand_set_register(&current_operand, OPD_GPRW, (yyvsp[0].i));
+		}
+#line 4260 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 257: /* i8089_operand: '[' i8089_base_address ']' '.' expression  */
+#line 870 "../x86/parser.y"
+                {
+			current_operand.x89_mode = X89_OFFSET;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 4269 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 258: /* i8089_operand: '[' i8089_base_address "]." expression  */
+#line 875 "../x86/parser.y"
+                {
+			current_operand.x89_mode = X89_OFFSET;
+			current_operand.parameter = (yyvsp[0].x);
+		}
+#line 4278 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 259: /* i8089_operand: '[' i8089_base_address '+' expression ']'  */
+#line 880 "../x86/parser.y"
+                {
+			current_operand.x89_mode = X89_OFFSET;
+			current_operand.parameter = (yyvsp[-1].x);
+		}
+#line 4287 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 260: /* i8089_operand: '[' i8089_base_address '+' TOK_I8089_IXREG ']'  */
+#line 885 "../x86/parser.y"
+                {
+			current_operand.x89_mode = X89_INDEX;
+		}
+#line 4295 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 261: /* i8089_operand: '[' i8089_base_address '+' TOK_I8089_IXREG '+' ']'  */
+#line 889 "../x86/parser.y"
+                {
+			current_operand.x89_mode = X89_INCREMENT;
+		}
+#line 4303 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 262: /* i8089_operand: expression  */
+#line 893 "../x86/parser.y"
+                {
+			operand_set_immediate(&current_operand, (yyvsp[0].x));
+		}
+#line 4311 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 263: /* i8089_operand: expression ':' expression  */
+#line 897 "../x86/parser.y"
+                {
+			operand_set_far_address(&current_operand, (yyvsp[-2].x), (yyvsp[0].x));
+		}
+#line 4319 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 264: /* i8089_base_address: TOK_I8089_PTRREG  */
+#line 904 "../x86/parser.y"
+                {
+			operand_set_memory(&current_operand);
+			current_operand.base = (yyvsp[0].i);
+		}
+#line 4328 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 265: /* i8089_base_address: TOK_I8089_PPREG  */
+#line 909 "../x86/parser.y"
+                {
+			operand_set_memory(&current_operand);
+			current_operand.base = (yyvsp[0].i);
+		}
+#line 4337 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 266: /* expression: KWD_SEG TOK_IDENTIFIER  */
+#line 917 "../x86/parser.y"
+                {
+			(yyval.x) = expression_segment_of((yyvsp[0].s));
+		}
+#line 4345 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+  case 267: /* expression: TOK_IDENTIFIER KWD_WRT TOK_IDENTIFIER  */
+#line 921 "../x86/parser.y"
+                {
+			(yyval.x) = expression_relative_to((yyvsp[-2].s), (yyvsp[0].s));
+		}
+#line 4353 "../../obj/x86/x86/parser.tab.c"
+    break;
+
+
+#line 4357 "../../obj/x86/x86/parser.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 926 "../x86/parser.y"
+
+#line 927 "../x86/parser.y"
+
+bool validate_scale_strict(bitsize_t address_size, integer_value_t scale)
+{
+	if(!uint_fits(INTVAL(scale)))
+		return false;
+	switch(uint_get(INTVAL(scale)))
+	{
+	case 1:
+		return true;
+	case 2:
+	case 4:
+	case 8:
+		return address_size != BITSIZE16;
+	default:
+		return false;
+	}
+}
+
+bool validate_scale_permissive(bitsize_t address_size, integer_value_t scale)
+{
+	if(!uint_fits(INTVAL(scale)))
+		return false;
+	switch(uint_get(INTVAL(scale)))
+	{
+	case 1:
+		return true;
+	case 2:
+	case 3:
+	case 4:
+	case 5:
+	case 8:
+	case 9:
+		return address_size != BITSIZE16;
+	default:
+		return false;
+	}
+}
+
+parser_state_t current_parser_state[1] =
+{
+	{
+		.line_number = 1,
+		.cpu_type = CPU_8086,
+		.x80_cpu_type = CPU_8080,
+		.bit_size = BITSIZE16,
+		.stream =
+		{
+			.first_instruction = NULL,
+			.last_instruction = &current_parser_state->stream.first_instruction,
+		},
+	}
+};
+
+void instruction_clear(instruction_t * ins, parser_state_t * state)
+{
+	memset(ins, 0, sizeof(instruction_t));
+	ins->line_number = state->line_number;
+	ins->cpu = state->cpu_type;
+	ins->bits = state->bit_size;
+	ins->fpu = state->fpu_type;
+	ins->condition = COND_NONE;
+	ins->segment_prefix = REG_NOSEG;
+	ins->source_segment_prefix = REG_NOSEG;
+	ins->target_segment_prefix = REG_NOSEG;
+}
+
+void operand_set(operand_t * opd, operand_type_t type)
+{
+	memset(opd, 0, sizeof(operand_t));
+	opd->type = type;
+}
+
+void operand_set_register(operand_t * opd, operand_type_t type, int number)
+{
+	operand_set(opd, type);
+	opd->base = number;
+	switch(opd->type)
+	{
+	case OPD_GPRB:
+	case OPD_GPRH:
+		opd->size = BITSIZE8;
+		break;
+	case OPD_GPRW:
+#if 0
+	case OPD_SEG:
+#endif
+		opd->size = BITSIZE16;
+		break;
+	case OPD_GPRD:
+#if 0
+	case OPD_TREG:
+#endif
+		opd->size = BITSIZE32;
+		break;
+	case OPD_GPRQ:
+	case OPD_MMREG:
+		opd->size = BITSIZE64;
+		break;
+#if 0
+	case OPD_CREG:
+	case OPD_DREG:
+		opd->size = state->bit_size;
+		break;
+	case OPD_STREG:
+		opd->size = BITSIZE80;
+		break;
+#endif
+	case OPD_XMMREG:
+		opd->size = BITSIZE128;
+		break;
+	case OPD_YMMREG:
+		opd->size = BITSIZE256;
+		break;
+	case OPD_ZMMREG:
+		opd->size = BITSIZE512;
+		break;
+	default:
+		break;
+	}
+}
+
+void operand_set_immediate(operand_t * opd, expression_t * value)
+{
+	memset(opd, 0, sizeof(operand_t));
+	opd->parameter = value;
+}
+
+void operand_set_far_address(operand_t * opd, expression_t * segment, expression_t * offset)
+{
+	operand_set(opd, OPD_FARIMM);
+	opd->parameter = offset;
+	opd->segment_value = segment;
+}
+
+void operand_set_memory(operand_t * opd)
+{
+	operand_set(opd, OPD_MEM);
+	opd->segment = REG_NOSEG;
+	opd->base = REG_NONE;
+	opd->index = REG_NONE;
+	opd->scale = 1;
+}
+
+#line 889 "../x86/../parser.y"
+
+// changes whenever tokens are added, removed or reordered in the grammar of the target
+uint64_t parser_get_token_fingerprint(void)
+{
+	// FNV-1a over the terminal names and the mapping of token numbers to them
+	uint64_t hash = 0xCBF29CE484222325;
+	for(int symbol = 0; symbol < YYNTOKENS; symbol++)
+	{
+		for(const char * name = yytname[symbol]; ; name++)
+		{
+			hash ^= (uint8_t)*name;
+			hash *= 0x100000001B3;
+			if(*name == '\0')
+				break;
+		}
+	}
+	for(size_t token = 0; token < sizeof yytranslate / sizeof yytranslate[0]; token++)
+	{
+		hash ^= yytranslate[token];
+		hash *= 0x100000001B3;
+	}
+	return hash;
+}
+
+void yyerror(const char * s)
+{
+	const char * filename = preprocessor_get_current_filename();
+	if(filename != NULL)
+		fprintf(stderr, "Error in %s, line %ld: %s\n", filename, current_parser_state->line_number, s);
+	else
+		fprintf(stderr, "Error in line %ld: %s\n", current_parser_state->line_number, s);
+}
+
@@ -0,0 +1,201 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_OBJ_X86_X86_PARSER_TAB_H_INCLUDED
+# define YY_YY_OBJ_X86_X86_PARSER_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 3 "../x86/../parser.y"
+
+#include "../../../src/preprocess.h"
+
+#line 53 "../../obj/x86/x86/parser.tab.h"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    KWD_ALIGN = 258,               /* KWD_ALIGN  */
+    KWD_COMMON = 259,              /* KWD_COMMON  */
+    TOK_DATA = 260,                /* TOK_DATA  */
+    KWD_DEFINED = 261,             /* KWD_DEFINED  */
+    KWD_ELSE_IF = 262,             /* KWD_ELSE_IF  */
+    KWD_ELSE = 263,                /* KWD_ELSE  */
+    KWD_ENDFILL = 264,             /* KWD_ENDFILL  */
+    KWD_ENDIF = 265,               /* KWD_ENDIF  */
+    KWD_ENDMACRO = 266,            /* KWD_ENDMACRO  */
+    KWD_ENDREPEAT = 267,           /* KWD_ENDREPEAT  */
+    KWD_ENDTIMES = 268,            /* KWD_ENDTIMES  */
+    KWD_ENTRY = 269,               /* KWD_ENTRY  */
+    KWD_EQU = 270,                 /* KWD_EQU  */
+    KWD_EXPORT = 271,              /* KWD_EXPORT  */
+    KWD_EXTERN = 272,              /* KWD_EXTERN  */
+    KWD_FILL = 273,                /* KWD_FILL  */
+    KWD_GLOBAL = 274,              /* KWD_GLOBAL  */
+    KWD_IF = 275,                  /* KWD_IF  */
+    KWD_IMPORT = 276,              /* KWD_IMPORT  */
+    KWD_INCLUDE = 277,             /* KWD_INCLUDE  */
+    KWD_MACRO = 278,               /* KWD_MACRO  */
+    KWD_ONCE = 279,                /* KWD_ONCE  */
+    KWD_ORG = 280,                 /* KWD_ORG  */
+    KWD_REPEAT = 281,              /* KWD_REPEAT  */
+    KWD_SECTION = 282,             /* KWD_SECTION  */
+    KWD_SKIP = 283,                /* KWD_SKIP  */
+    KWD_TIMES = 284,               /* KWD_TIMES  */
+    TOK_IDENTIFIER = 285,          /* TOK_IDENTIFIER  */
+    TOK_INTEGER = 286,             /* TOK_INTEGER  */
+    TOK_LABEL_FORWARD = 287,       /* TOK_LABEL_FORWARD  */
+    TOK_LABEL_BACKWARD = 288,      /* TOK_LABEL_BACKWARD  */
+    TOK_STRING = 289,              /* TOK_STRING  */
+    TOK_MACRONAME = 290,           /* TOK_MACRONAME  */
+    TOK_MACRO_PARAM = 291,         /* TOK_MACRO_PARAM  */
+    TOK_REPEAT_COUNTER = 292,      /* TOK_REPEAT_COUNTER  */
+    DEL_AND = 293,                 /* "&&"  */
+    DEL_CMP = 294,                 /* "<=>"  */
+    DEL_EQ = 295,                  /* "=="  */
+    DEL_GE = 296,                  /* ">="  */
+    DEL_GE1 = 297,                 /* "=>"  */
+    DEL_LE = 298,                  /* "<="  */
+    DEL_LE1 = 299,                 /* "=<"  */
+    DEL_NE = 300,                  /* "!="  */
+    DEL_NE1 = 301,                 /* "<>"  */
+    DEL_NE2 = 302,                 /* "><"  */
+    DEL_OR = 303,                  /* "||"  */
+    DEL_SECT = 304,                /* "$$"  */
+    DEL_SHL = 305,                 /* "<<"  */
+    DEL_SHR = 306,                 /* ">>"  */
+    DEL_XOR = 307,                 /* "^^"  */
+    DEL_CMP_U = 308,               /* "#<=>"  */
+    DEL_GE_U = 309,                /* "#>="  */
+    DEL_GE1_U = 310,               /* "#=>"  */
+    DEL_LE_U = 311,                /* "#<="  */
+    DEL_LE1_U = 312,               /* "#=<"  */
+    DEL_LT_U = 313,                /* "#<"  */
+    DEL_GT_U = 314,                /* "#>"  */
+    DEL_SHL_S = 315,               /* "<<<"  */
+    DEL_SHR_S = 316,               /* ">>>"  */
+    DEL_DIV_S = 317,               /* "//"  */
+    DEL_MOD_S = 318,               /* "%%"  */
+    TOK_ARCH = 319,                /* TOK_ARCH  */
+    KWD_BITS = 320,                /* KWD_BITS  */
+    KWD_FAR = 321,                 /* KWD_FAR  */
+    KWD_REL = 322,                 /* KWD_REL  */
+    KWD_SEG = 323,                 /* KWD_SEG  */
+    KWD_WRT = 324,                 /* KWD_WRT  */
+    TOK_286_UMOV_PREFIX = 325,     /* TOK_286_UMOV_PREFIX  */
+    TOK_FPU = 326,                 /* TOK_FPU  */
+    TOK_ASIZE = 327,               /* TOK_ASIZE  */
+    TOK_BITS = 328,                /* TOK_BITS  */
+    TOK_CREG = 329,                /* TOK_CREG  */
+    TOK_CYSYMBOL = 330,            /* TOK_CYSYMBOL  */
+    TOK_DIRSYMBOL = 331,           /* TOK_DIRSYMBOL  */
+    TOK_DREG = 332,                /* TOK_DREG  */
+    TOK_GPR = 333,                 /* TOK_GPR  */
+    TOK_IPREG = 334,               /* TOK_IPREG  */
+    TOK_IRAM = 335,                /* TOK_IRAM  */
+    TOK_LOCK = 336,                /* TOK_LOCK  */
+    TOK_MNEMONIC = 337,            /* TOK_MNEMONIC  */
+    TOK_MMREG = 338,               /* TOK_MMREG  */
+    TOK_OSIZE = 339,               /* TOK_OSIZE  */
+    TOK_PSWREG = 340,              /* TOK_PSWREG  */
+    TOK_REP = 341,                 /* TOK_REP  */
+    TOK_RSYMBOL = 342,             /* TOK_RSYMBOL  */
+    TOK_SEG = 343,                 /* TOK_SEG  */
+    TOK_STREG = 344,               /* TOK_STREG  */
+    TOK_TREG = 345,                /* TOK_TREG  */
+    TOK_XMMREG = 346,              /* TOK_XMMREG  */
+    TOK_YMMREG = 347,              /* TOK_YMMREG  */
+    TOK_ZMMREG = 348,              /* TOK_ZMMREG  */
+    TOK_DW = 349,                  /* TOK_DW  */
+    TOK_I8080_MNEM = 350,          /* TOK_I8080_MNEM  */
+    TOK_Z80_MNEM = 351,            /* TOK_Z80_MNEM  */
+    TOK_X80_REG = 352,             /* TOK_X80_REG  */
+    TOK_X80_MEM = 353,             /* TOK_X80_MEM  */
+    TOK_X80_IDX = 354,             /* TOK_X80_IDX  */
+    TOK_I8089_MNEM = 355,          /* TOK_I8089_MNEM  */
+    TOK_I8089_VALREG = 356,        /* TOK_I8089_VALREG  */
+    TOK_I8089_IXREG = 357,         /* TOK_I8089_IXREG  */
+    TOK_I8089_PTRREG = 358,        /* TOK_I8089_PTRREG  */
+    TOK_I8089_PPREG = 359,         /* TOK_I8089_PPREG  */
+    TOK_BRACKET_DOT = 360          /* "]."  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 24 "../x86/../parser.y"
+
+	long i;
+	char * s;
+	expression_t * x;
+
+	integer_value_t j;
+
+	instruction_t * ins;
+
+	replacement_t * macro;
+
+#line 187 "../../obj/x86/x86/parser.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_OBJ_X86_X86_PARSER_TAB_H_INCLUDED  */
@@ -0,0 +1,1994 @@
+#line 1 "../x86/parser.y"
+
+#line 1 "../x86/../parser.y"
+
+%code requires
+{
+#include "../../../src/preprocess.h"
+}
+
+%{
+#include <assert.h>
+#include <stdio.h>
+#include "../../../src/syntax.h"
+#include "../../../src/asm.h"
+
+typedef enum operand_type_t operand_type_t;
+typedef struct operand_t operand_t;
+
+extern int yylex(void);
+void yyerror(const char * s);
+%}
+
+// the token names are used to identify the token numbering in precompiled token files
+%token-table
+
+%union
+{
+	long i;
+	char * s;
+	expression_t * x;
+
+	integer_value_t j;
+
+	instruction_t * ins;
+
+	replacement_t * macro;
+}
+
+%token KWD_ALIGN
+%token KWD_COMMON
+%token <i> TOK_DATA
+%token KWD_DEFINED
+%token KWD_ELSE_IF
+%token KWD_ELSE
+%token KWD_ENDFILL
+%token KWD_ENDIF
+%token KWD_ENDMACRO
+%token KWD_ENDREPEAT
+%token KWD_ENDTIMES
+%token KWD_ENTRY
+%token KWD_EQU
+%token KWD_EXPORT
+%token KWD_EXTERN
+%token KWD_FILL
+%token KWD_GLOBAL
+%token KWD_IF
+%token KWD_IMPORT
+%token KWD_INCLUDE
+%token KWD_MACRO
+%token KWD_ONCE
+%token KWD_ORG
+%token KWD_REPEAT
+%token KWD_SECTION
+%token KWD_SKIP
+%token KWD_TIMES
+
+%token <s> TOK_IDENTIFIER
+%token <j> TOK_INTEGER TOK_LABEL_FORWARD TOK_LABEL_BACKWARD
+%token <s> TOK_STRING
+%token <macro> TOK_MACRONAME
+%token TOK_MACRO_PARAM /* only used inside macro bodies */
+%token TOK_REPEAT_COUNTER /* only used inside .repeat bodies */
+
+%token DEL_AND "&&"
+%token DEL_CMP "<=>"
+%token DEL_EQ "=="
+%token DEL_GE ">="
+%token DEL_GE1 "=>"
+%token DEL_LE "<="
+%token DEL_LE1 "=<"
+%token DEL_NE "!="
+%token DEL_NE1 "<>"
+%token DEL_NE2 "><"
+%token DEL_OR "||"
+%token DEL_SECT "$$"
+%token DEL_SHL "<<"
+%token DEL_SHR ">>"
+%token DEL_XOR "^^"
+
+%token DEL_CMP_U "#<=>"
+%token DEL_GE_U "#>="
+%token DEL_GE1_U "#=>"
+%token DEL_LE_U "#<="
+%token DEL_LE1_U "#=<"
+%token DEL_LT_U "#<"
+%token DEL_GT_U "#>"
+%token DEL_SHL_S "<<<"
+%token DEL_SHR_S ">>>"
+%token DEL_DIV_S "//"
+%token DEL_MOD_S "%%"
+
+%right '?' ':'
+%left "||"
+%left "^^"
+%left "&&"
+%left "==" "!=" "<>" "><" '<' '>' "<=" "=<" ">=" "=>" "<=>" "#<" "#>" "#<=" "#=<" "#>=" "#=>" "#<=>"
+%left '!' '|'
+%left '^'
+%left '&'
+%left '+' '-'
+
+%type <i> data
+%type <x> prefix_expression_noparen prefix_expression multiplicative_expression multiplicative_expression_noparen multiplication addend expression expression_noparen operation_expression
+%type <ins> section_directive common export_head export_directive
+
+#line 3 "../x86/parser.y"
+
+%{
+#include "../../../src/x86/isa.h"
+
+bool validate_scale_strict(bitsize_t address_size, integer_value_t scale);
+bool validate_scale_permissive(bitsize_t address_size, integer_value_t scale);
+
+parser_state_t current_parser_state[1];
+extern instruction_t current_instruction;
+#define current_operand (current_instruction.operand[current_instruction.operand_count])
+#define current_instruction_stream (&current_parser_state->stream)
+
+void operand_set(operand_t * opd, operand_type_t type);
+void operand_set_register(operand_t * opd, operand_type_t type, int number);
+void operand_set_immediate(operand_t * opd, expression_t * value);
+void operand_set_far_address(operand_t * opd, expression_t * segment, expression_t * offset);
+void operand_set_memory(operand_t * opd);
+%}
+
+%token <i> TOK_ARCH
+%token KWD_BITS
+%token KWD_FAR
+%token KWD_REL
+%token KWD_SEG
+%token KWD_WRT
+
+%token TOK_286_UMOV_PREFIX
+%token <i> TOK_FPU
+%token <i> TOK_ASIZE
+%token <i> TOK_BITS
+%token <i> TOK_CREG
+%token TOK_CYSYMBOL
+%token TOK_DIRSYMBOL
+%token <i> TOK_DREG
+%token <i> TOK_GPR
+%token <i> TOK_IPREG
+%token TOK_IRAM
+%token TOK_LOCK
+%token <i> TOK_MNEMONIC
+%token <i> TOK_MMREG
+%token <i> TOK_OSIZE
+%token TOK_PSWREG
+%token <i> TOK_REP
+%token TOK_RSYMBOL
+%token <i> TOK_SEG
+%token <i> TOK_STREG
+%token <i> TOK_TREG
+%token <i> TOK_XMMREG
+%token <i> TOK_YMMREG
+%token <i> TOK_ZMMREG
+%token TOK_DW // required for NEC
+
+%type <i> segment_prefix
+
+%token <i> TOK_I8080_MNEM
+%token <i> TOK_Z80_MNEM
+%token <i> TOK_X80_REG
+%token <i> TOK_X80_MEM
+%token <i> TOK_X80_IDX
+
+%token <i> TOK_I8089_MNEM
+%token <i> TOK_I8089_VALREG
+%token <i> TOK_I8089_IXREG
+%token <i> TOK_I8089_PTRREG
+%token <i> TOK_I8089_PPREG
+
+%token TOK_BRACKET_DOT "]."
+
+%%
+#line 72 "../x86/parser.y"
+
+#line 114 "../x86/../parser.y"
+
+file
+	:
+	| file line
+	;
+
+line
+	: '\n'
+		{
+			advance_line();
+		}
+	| directive
+	| data '\n'
+		{
+			advance_line();
+		}
+	| instruction
+	| TOK_MACRONAME
+		{
+			invoke_macro($1);
+			advance_line();
+		}
+	;
+
+directive
+	: section_directive '\n'
+		{
+			advance_line();
+		}
+	| KWD_EQU TOK_IDENTIFIER ',' expression '\n'
+		{
+			instruction_make_equ(&current_instruction, current_parser_state, $2, $4);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define($2, $4);
+			advance_line();
+		}
+	| TOK_IDENTIFIER KWD_EQU expression '\n'
+		{
+			instruction_make_equ(&current_instruction, current_parser_state, $1, $3);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define($1, $3);
+			advance_line();
+		}
+	| TOK_IDENTIFIER '=' expression '\n'
+		{
+			instruction_make_equ(&current_instruction, current_parser_state, $1, $3);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define($1, $3);
+			advance_line();
+		}
+	| here KWD_EQU expression '\n'
+		{
+			instruction_make_set_location(&current_instruction, current_parser_state, $3);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| here '=' expression '\n'
+		{
+			instruction_make_set_location(&current_instruction, current_parser_state, $3);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| KWD_ORG expression '\n'
+		{
+			instruction_make_set_location(&current_instruction, current_parser_state, $2);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| KWD_ALIGN expression '\n'
+		{
+			instruction_make_skip(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, $2,
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| KWD_ALIGN expression ','
+		{
+			instruction_make_fill(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, $2,
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+		data '\n'
+		{
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| KWD_ALIGN expression ','
+		{
+			instruction_make_fill(&current_instruction, current_parser_state,
+				expression_binary(EXP_SUB,
+					expression_binary(EXP_ALIGN, $2,
+						expression_binary(EXP_SUB,
+							expression_current_location(),
+							expression_current_section())),
+					expression_binary(EXP_SUB,
+						expression_current_location(),
+						expression_current_section())));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+		instruction
+		{
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| KWD_TIMES expression '\n'
+		{
+			instruction_make_times(&current_instruction, current_parser_state, $2);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| KWD_ENDTIMES '\n'
+		{
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| repeat_directive
+		{
+			parse_repeat_definition();
+		}
+		'\n'
+		{
+			advance_line();
+		}
+	| KWD_ENDREPEAT '\n'
+		{
+			yyerror("no matching .repeat found for .endrepeat");
+			YYABORT;
+		}
+	| KWD_FILL expression '\n'
+		{
+			instruction_make_fill(&current_instruction, current_parser_state, $2);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| KWD_ENDFILL '\n'
+		{
+			instruction_make_end_fill(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| KWD_IF expression '\n'
+		{
+			handle_if_directive($2);
+			// TODO: optionally delete $2
+			advance_line();
+		}
+	| KWD_ELSE_IF expression '\n'
+		{
+			handle_else_if_directive($2);
+			// TODO: optionally delete $2
+			advance_line();
+		}
+	| KWD_ELSE '\n'
+		{
+			handle_else_directive();
+			advance_line();
+		}
+	| KWD_ENDIF '\n'
+		{
+			handle_end_if_directive();
+			advance_line();
+		}
+	| KWD_SKIP expression '\n'
+		{
+			instruction_make_skip(&current_instruction, current_parser_state, $2);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| KWD_TIMES expression ','
+		{
+			instruction_make_times(&current_instruction, current_parser_state, $2);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+		data '\n'
+		{
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			advance_line();
+		}
+	| KWD_TIMES expression ','
+		{
+			instruction_make_times(&current_instruction, current_parser_state, $2);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+		instruction
+		{
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+
+			instruction_make_end_times(&current_instruction, current_parser_state);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| KWD_ENTRY TOK_IDENTIFIER '\n'
+		{
+			if(entry_point_name == NULL)
+			{
+				entry_point_name = $2;
+			}
+			else
+			{
+				yyerror("Error: repeated .entry directive\n");
+				if(!is_replacement)
+					free($2);
+			}
+			advance_line();
+		}
+	| TOK_IDENTIFIER ':'
+		{
+			instruction_make_equ(&current_instruction, current_parser_state, $1, expression_current_location());
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			preprocessor_define($1, expression_current_location());
+		}
+	| TOK_INTEGER ':'
+		{
+			instruction_make_local_label(&current_instruction, current_parser_state, $1);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete($1);
+		}
+	| extern '\n'
+		{
+			advance_line();
+		}
+	| global '\n'
+		{
+			advance_line();
+		}
+	| common '\n'
+		{
+			advance_line();
+		}
+	| import '\n'
+		{
+			advance_line();
+		}
+	| export '\n'
+		{
+			advance_line();
+		}
+	| macro_definition
+		{
+			parse_macro_definition();
+		}
+		'\n'
+		{
+			advance_line();
+		}
+	;
+
+repeat_directive
+	: KWD_REPEAT expression
+		{
+			if(!begin_repeat_definition($2, NULL))
+				YYABORT;
+		}
+	| KWD_REPEAT expression ',' TOK_IDENTIFIER
+		{
+			if(!begin_repeat_definition($2, $4))
+				YYABORT;
+		}
+	;
+
+macro_definition
+	: macro_definition_head
+	| macro_definition_arguments
+	;
+
+macro_definition_head
+	: KWD_MACRO TOK_IDENTIFIER
+		{
+			begin_macro_definition($2);
+		}
+	;
+
+macro_definition_arguments
+	: macro_definition_head TOK_IDENTIFIER
+		{
+			append_macro_definition_parameter($2);
+		}
+	| macro_definition_arguments comma_opt TOK_IDENTIFIER
+		{
+			append_macro_definition_parameter($3);
+		}
+	;
+
+section_directive
+	: KWD_SECTION TOK_IDENTIFIER
+		{
+			instruction_make_section(&current_instruction, current_parser_state, $2);
+			$$ = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| section_directive comma_opt TOK_IDENTIFIER
+		{
+			expression_list_append($1->operand[1].parameter, expression_identifier($3));
+		}
+	| section_directive comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER
+		{
+			expression_list_append($1->operand[1].parameter,
+				expression_assignment(
+					expression_identifier($3),
+					expression_identifier($5)));
+		}
+	| section_directive comma_opt TOK_IDENTIFIER '=' TOK_INTEGER
+		{
+			expression_list_append($1->operand[1].parameter,
+				expression_assignment(
+					expression_identifier($3),
+					expression_integer($5)));
+		}
+	;
+
+comma_opt
+	:
+	| ','
+	;
+
+data
+	: TOK_DATA expression
+		{
+			instruction_make_data(&current_instruction, current_parser_state, $1, $2);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			$$ = $1;
+		}
+	| data ',' expression
+		{
+			instruction_make_data(&current_instruction, current_parser_state, $1, $3);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			$$ = $1;
+		}
+	;
+
+extern
+	: KWD_EXTERN TOK_IDENTIFIER
+		{
+			instruction_make_external(&current_instruction, current_parser_state, $2);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| extern ',' TOK_IDENTIFIER
+		{
+			instruction_make_external(&current_instruction, current_parser_state, $3);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	;
+
+global
+	: KWD_GLOBAL TOK_IDENTIFIER
+		{
+			instruction_make_global(&current_instruction, current_parser_state, $2);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| global ',' TOK_IDENTIFIER
+		{
+			instruction_make_global(&current_instruction, current_parser_state, $3);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	;
+
+common
+	: KWD_COMMON TOK_IDENTIFIER expression
+		{
+			instruction_make_common(&current_instruction, current_parser_state, $2, $3);
+			$$ = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| common comma_opt TOK_IDENTIFIER
+		{
+			expression_list_append($1->operand[2].parameter, expression_identifier($3));
+			$$ = $1;
+		}
+	| common comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER
+		{
+			expression_list_append($1->operand[2].parameter,
+				expression_assignment(
+					expression_identifier($3),
+					expression_identifier($5)));
+			$$ = $1;
+		}
+	| common comma_opt TOK_IDENTIFIER '=' TOK_INTEGER
+		{
+			expression_list_append($1->operand[2].parameter,
+				expression_assignment(
+					expression_identifier($3),
+					expression_integer($5)));
+			$$ = $1;
+		}
+	;
+
+import
+	: KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER
+		{
+			instruction_make_import(&current_instruction, current_parser_state, $2, $3, NULL);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_IDENTIFIER
+		{
+			instruction_make_import(&current_instruction, current_parser_state, $2, $3, expression_identifier($4));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| KWD_IMPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_INTEGER
+		{
+			instruction_make_import(&current_instruction, current_parser_state, $2, $3, expression_integer($4));
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	;
+
+export_head
+	: KWD_EXPORT TOK_IDENTIFIER
+		{
+			instruction_make_export(&current_instruction, current_parser_state, $2, NULL, NO_ORDINAL);
+			$$ = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| KWD_EXPORT TOK_IDENTIFIER TOK_IDENTIFIER
+		{
+			instruction_make_export(&current_instruction, current_parser_state, $2, $3, NO_ORDINAL);
+			$$ = instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| KWD_EXPORT TOK_IDENTIFIER TOK_INTEGER
+		{
+			instruction_make_export(&current_instruction, current_parser_state, $2, NULL, $3);
+			$$ = instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete($3);
+		}
+	| KWD_EXPORT TOK_IDENTIFIER TOK_IDENTIFIER TOK_INTEGER
+		{
+			instruction_make_export(&current_instruction, current_parser_state, $2, $3, $4);
+			$$ = instruction_stream_append(current_instruction_stream, &current_instruction);
+			if(!is_replacement)
+				int_delete($4);
+		}
+	;
+
+export_directive
+	: export_head ',' TOK_IDENTIFIER
+		{
+			expression_list_append($1->operand[3].parameter, expression_identifier($3));
+			$$ = $1;
+		}
+	| export_directive comma_opt TOK_IDENTIFIER
+		{
+			expression_list_append($1->operand[3].parameter, expression_identifier($3));
+			$$ = $1;
+		}
+	| export_head ',' TOK_IDENTIFIER '=' TOK_IDENTIFIER
+		{
+			expression_list_append($1->operand[3].parameter,
+				expression_assignment(
+					expression_identifier($3),
+					expression_identifier($5)));
+			$$ = $1;
+		}
+	| export_directive comma_opt TOK_IDENTIFIER '=' TOK_IDENTIFIER
+		{
+			expression_list_append($1->operand[3].parameter,
+				expression_assignment(
+					expression_identifier($3),
+					expression_identifier($5)));
+			$$ = $1;
+		}
+	| export_head ',' TOK_IDENTIFIER '=' TOK_INTEGER
+		{
+			expression_list_append($1->operand[3].parameter,
+				expression_assignment(
+					expression_identifier($3),
+					expression_integer($5)));
+			$$ = $1;
+		}
+	| export_directive comma_opt TOK_IDENTIFIER '=' TOK_INTEGER
+		{
+			expression_list_append($1->operand[3].parameter,
+				expression_assignment(
+					expression_identifier($3),
+					expression_integer($5)));
+			$$ = $1;
+		}
+	;
+
+export
+	: export_head
+	| export_directive
+	;
+
+here
+	: '*' // xa
+	| '.' // gnu
+	| '$' // nasm
+	;
+
+prefix_expression_noparen
+	: TOK_IDENTIFIER
+		{
+			$$ = expression_identifier($1);
+		}
+	| KWD_SECTION TOK_IDENTIFIER
+		{
+			$$ = expression_section($2);
+		}
+	| TOK_LABEL_FORWARD
+		{
+			$$ = expression_label_forward($1);
+			if(!is_replacement)
+				int_delete($1);
+		}
+	| TOK_LABEL_BACKWARD
+		{
+			$$ = expression_label_backward($1);
+			if(!is_replacement)
+				int_delete($1);
+		}
+	| TOK_INTEGER
+		{
+			$$ = expression_integer($1);
+			if(!is_replacement)
+				int_delete($1);
+		}
+	| TOK_STRING
+		{
+			$$ = expression_string($1);
+		}
+	| KWD_DEFINED TOK_IDENTIFIER
+		{
+			$$ = expression_is_defined($2);
+		}
+	| here
+		{
+			$$ = expression_current_location();
+		}
+	| "$$" // nasm
+		{
+			$$ = expression_current_section();
+		}
+	| '+' prefix_expression // nasm
+		{
+			$$ = expression_unary(EXP_PLUS, $2);
+		}
+	| '-' prefix_expression
+		{
+			$$ = expression_unary(EXP_MINUS, $2);
+		}
+	| '~' prefix_expression
+		{
+			$$ = expression_unary(EXP_BITNOT, $2);
+		}
+	| '!' prefix_expression // nasm
+		{
+			$$ = expression_unary(EXP_NOT, $2);
+		}
+	| KWD_ALIGN '(' expression ')'
+		{
+			$$ = expression_binary(EXP_ALIGN, $3, expression_current_location());
+		}
+	| KWD_ALIGN '(' expression ',' expression ')'
+		{
+			$$ = expression_binary(EXP_ALIGN, $3, $5);
+		}
+	;
+
+prefix_expression
+	: prefix_expression_noparen
+	| '(' expression ')'
+		{
+			$$ = $2;
+		}
+	;
+
+multiplication
+	: multiplicative_expression '*' prefix_expression
+		{
+			$$ = expression_binary(EXP_MUL, $1, $3);
+		}
+	| multiplicative_expression '/' prefix_expression
+		{
+			$$ = expression_binary(EXP_DIVU, $1, $3);
+		}
+	| multiplicative_expression "//" prefix_expression
+		{
+			$$ = expression_binary(EXP_DIV, $1, $3);
+		}
+	| multiplicative_expression '%' prefix_expression
+		{
+			$$ = expression_binary(EXP_MODU, $1, $3);
+		}
+	| multiplicative_expression "%%" prefix_expression
+		{
+			$$ = expression_binary(EXP_MOD, $1, $3);
+		}
+	| multiplicative_expression "<<" prefix_expression
+		{
+			$$ = expression_binary(EXP_SHLU, $1, $3);
+		}
+	| multiplicative_expression "<<<" prefix_expression
+		{
+			$$ = expression_binary(EXP_SHL, $1, $3);
+		}
+	| multiplicative_expression ">>" prefix_expression
+		{
+			$$ = expression_binary(EXP_SHRU, $1, $3);
+		}
+	| multiplicative_expression ">>>" prefix_expression
+		{
+			$$ = expression_binary(EXP_SHR, $1, $3);
+		}
+	;
+
+multiplicative_expression
+	: prefix_expression
+	| multiplication
+	;
+
+multiplicative_expression_noparen
+	: prefix_expression_noparen
+	| multiplication
+	;
+
+addend
+	: '+' multiplicative_expression
+		{
+			$$ = $2;
+		}
+	| '-' multiplicative_expression
+		{
+			$$ = expression_unary(EXP_MINUS, $2);
+		}
+	| addend '+' multiplicative_expression
+		{
+			$$ = expression_binary(EXP_ADD, $1, $3);
+		}
+	| addend '-' multiplicative_expression
+		{
+			$$ = expression_binary(EXP_SUB, $1, $3);
+		}
+	;
+
+operation_expression
+	: expression '+' expression
+		{
+			$$ = expression_binary(EXP_ADD, $1, $3);
+		}
+	| expression '-' expression
+		{
+			$$ = expression_binary(EXP_SUB, $1, $3);
+		}
+	| expression '&' expression
+		{
+			$$ = expression_binary(EXP_BITAND, $1, $3);
+		}
+	| expression '|' expression
+		{
+			$$ = expression_binary(EXP_BITOR, $1, $3);
+		}
+	| expression '^' expression
+		{
+			$$ = expression_binary(EXP_BITXOR, $1, $3);
+		}
+	| expression '!' expression // gas
+		{
+			$$ = expression_binary(EXP_BITORNOT, $1, $3);
+		}
+	| expression "==" expression
+		{
+			$$ = expression_binary(EXP_EQ, $1, $3);
+		}
+	| expression "!=" expression
+		{
+			$$ = expression_binary(EXP_NE, $1, $3);
+		}
+	| expression "<>" expression
+		{
+			$$ = expression_binary(EXP_NE, $1, $3);
+		}
+	| expression "><" expression // xa
+		{
+			$$ = expression_binary(EXP_NE, $1, $3);
+		}
+	| expression '<' expression
+		{
+			$$ = expression_binary(EXP_LT, $1, $3);
+		}
+	| expression '>' expression
+		{
+			$$ = expression_binary(EXP_GT, $1, $3);
+		}
+	| expression "<=" expression
+		{
+			$$ = expression_binary(EXP_LE, $1, $3);
+		}
+	| expression "=<" expression // xa
+		{
+			$$ = expression_binary(EXP_LE, $1, $3);
+		}
+	| expression ">=" expression
+		{
+			$$ = expression_binary(EXP_GE, $1, $3);
+		}
+	| expression "=>" expression // xa
+		{
+			$$ = expression_binary(EXP_GE, $1, $3);
+		}
+	| expression "<=>" expression // nasm
+		{
+			$$ = expression_binary(EXP_CMP, $1, $3);
+		}
+	| expression "#<" expression
+		{
+			$$ = expression_binary(EXP_LTU, $1, $3);
+		}
+	| expression "#>" expression
+		{
+			$$ = expression_binary(EXP_GTU, $1, $3);
+		}
+	| expression "#<=" expression
+		{
+			$$ = expression_binary(EXP_LEU, $1, $3);
+		}
+	| expression "#=<" expression // xa
+		{
+			$$ = expression_binary(EXP_LEU, $1, $3);
+		}
+	| expression "#>=" expression
+		{
+			$$ = expression_binary(EXP_GEU, $1, $3);
+		}
+	| expression "#=>" expression // xa
+		{
+			$$ = expression_binary(EXP_GEU, $1, $3);
+		}
+	| expression "#<=>" expression // nasm
+		{
+			$$ = expression_binary(EXP_CMPU, $1, $3);
+		}
+	| expression "&&" expression
+		{
+			$$ = expression_binary(EXP_AND, $1, $3);
+		}
+	| expression "^^" expression // nasm
+		{
+			$$ = expression_binary(EXP_XOR, $1, $3);
+		}
+	| expression "||" expression
+		{
+			$$ = expression_binary(EXP_OR, $1, $3);
+		}
+	| expression '?' expression ':' expression
+		{
+			$$ = expression_conditional($1, $3, $5);
+		}
+	;
+
+expression
+	: multiplicative_expression
+	| operation_expression
+	;
+
+expression_noparen
+	: multiplicative_expression_noparen
+	| operation_expression
+	;
+
+#line 74 "../x86/parser.y"
+
+data
+	: TOK_DW expression
+		{
+			instruction_make_data(&current_instruction, current_parser_state, _DATA_LE(BITSIZE16), $2);
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+			$$ = _DATA_LE(BITSIZE16);
+		}
+	;
+
+directive
+	: TOK_BITS '\n'
+		{
+			switch($1)
+			{
+			case BITSIZE16:
+				current_parser_state->bit_size = $1;
+				break;
+			case BITSIZE32:
+				if(current_parser_state->cpu_type < CPU_386)
+				{
+					yyerror("Current architecture does not support 32-bit");
+					YYERROR;
+				}
+				else
+				{
+					current_parser_state->bit_size = $1;
+				}
+				break;
+			case BITSIZE64:
+				if(current_parser_state->cpu_type < CPU_X64)
+				{
+					yyerror("Current architecture does not support 64-bit");
+					YYERROR;
+				}
+				else
+				{
+					current_parser_state->bit_size = $1;
+				}
+				break;
+			default:
+				assert(false);
+			}
+			lexer_switch_mode(current_parser_state);
+			advance_line();
+		}
+	| KWD_BITS TOK_INTEGER '\n'
+		{
+			if(!uint_fits(INTVAL($2)))
+			{
+				yyerror("Invalid instruction set bit length");
+				YYERROR;
+			}
+			switch(uint_get(INTVAL($2)))
+			{
+			case 8:
+				switch(current_parser_state->cpu_type)
+				{
+				case CPU_V30:
+					current_parser_state->x80_cpu_type = CPU_8080;
+					break;
+				case CPU_9002:
+					current_parser_state->x80_cpu_type = CPU_Z80;
+					break;
+				default:
+					yyerror("Current architecture does not support 8080/Z80 emulation");
+					YYERROR;
+				}
+				current_parser_state->bit_size = BITSIZE8;
+				break;
+			case 16:
+				current_parser_state->bit_size = BITSIZE16;
+				break;
+			case 32:
+				if(current_parser_state->cpu_type < CPU_386)
+				{
+					yyerror("Current architecture does not support 32-bit");
+					YYERROR;
+				}
+				else
+				{
+					current_parser_state->bit_size = BITSIZE32;
+				}
+				break;
+			case 64:
+				if(current_parser_state->cpu_type < 64)
+				{
+					yyerror("Current architecture does not support 64-bit");
+					YYERROR;
+				}
+				else
+				{
+					current_parser_state->bit_size = BITSIZE64;
+				}
+				break;
+			default:
+				yyerror("Invalid instruction set bit length");
+				YYERROR;
+				break;
+			}
+			lexer_switch_mode(current_parser_state);
+			advance_line();
+		}
+	| TOK_ARCH '\n'
+		{
+			if($1 == CPU_8089)
+			{
+				current_parser_state->cpu_type = $1;
+				current_parser_state->bit_size = BITSIZE16;
+			}
+			else if($1 == CPU_8080 || $1 == CPU_Z80)
+			{
+				current_parser_state->x80_cpu_type = $1;
+				current_parser_state->bit_size = BITSIZE8;
+			}
+			else
+			{
+				current_parser_state->cpu_type = $1;
+
+				if(current_parser_state->cpu_type < CPU_386)
+					current_parser_state->bit_size = BITSIZE16;
+				else if(current_parser_state->cpu_type != CPU_X64 && BITSIN(current_parser_state->bit_size) == BITSIZE64)
+					current_parser_state->bit_size = BITSIZE32;
+				else if(current_parser_state->cpu_type != CPU_V30 && current_parser_state->cpu_type != CPU_9002 && BITSIN(current_parser_state->bit_size) == BITSIZE8)
+					current_parser_state->bit_size = BITSIZE16;
+
+				if(current_parser_state->cpu_type < CPU_286)
+					current_parser_state->fpu_type = FPU_8087;
+				else if(current_parser_state->cpu_type < CPU_386)
+					current_parser_state->fpu_type = FPU_287;
+				else
+					current_parser_state->fpu_type = FPU_387;
+
+				if(current_parser_state->cpu_type == CPU_9002)
+					current_parser_state->x80_cpu_type = CPU_Z80;
+				else
+					current_parser_state->x80_cpu_type = CPU_8080;
+			}
+
+			lexer_switch_mode(current_parser_state);
+			advance_line();
+		}
+	| TOK_FPU '\n'
+		{
+			current_parser_state->fpu_type = $1;
+			advance_line();
+		}
+	;
+
+instruction
+	: x86_instruction
+		{
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+//printf("%d\n", ((instruction_t *)((char *)current_instruction_stream->last_instruction - offsetof(instruction_t, next_instruction)))->operation_size);
+		}
+	;
+
+segment_prefix
+	: TOK_SEG
+	| TOK_SEG ':'
+	;
+
+iram_prefix
+	: TOK_IRAM
+	| TOK_IRAM ':'
+	;
+
+x86_instruction
+	: segment_prefix x86_instruction
+		{
+			if($1 == REG_DS3)
+			{
+				if(current_instruction.target_segment_prefix != REG_NOSEG)
+				{
+					yyerror("Duplicate segment prefix");
+					YYERROR;
+				}
+				current_instruction.target_segment_prefix = $1;
+				current_instruction.segment_prefix = $1;
+			}
+			else
+			{
+				if(current_instruction.source_segment_prefix != REG_NOSEG)
+				{
+					yyerror("Duplicate segment prefix");
+					YYERROR;
+				}
+				current_instruction.target_segment_prefix = $1;
+				current_instruction.segment_prefix = $1;
+			}
+		}
+	| iram_prefix x86_instruction
+		{
+			if(current_instruction.target_segment_prefix != REG_NOSEG)
+			{
+				yyerror("Duplicate segment prefix");
+				YYERROR;
+			}
+			current_instruction.target_segment_prefix = REG_IRAM;
+			current_instruction.segment_prefix = REG_IRAM;
+		}
+	| TOK_REP x86_instruction
+		{
+			if(current_instruction.repeat_prefix != PREF_NOREP)
+			{
+				yyerror("Duplicate repeat prefix");
+				YYERROR;
+			}
+			current_instruction.repeat_prefix = $1;
+		}
+	| TOK_LOCK x86_instruction
+		{
+			if(current_instruction.lock_prefix)
+			{
+				yyerror("Duplicate lock prefix");
+				YYERROR;
+			}
+			current_instruction.lock_prefix = true;
+		}
+	| TOK_OSIZE x86_instruction
+		{
+			if(current_parser_state->cpu_type < CPU_386)
+			{
+				yyerror("Operation size prefix not permitted for this CPU type");
+				YYERROR;
+			}
+			if($1 == BITSIZE64 && BITSIN(current_parser_state->bit_size) != BITSIZE64)
+			{
+				yyerror("Operation size prefix not permitted for this CPU mode");
+				YYERROR;
+			}
+			if(current_instruction.operation_size != 0)
+			{
+				yyerror("Duplicate operation size prefix");
+				YYERROR;
+			}
+			current_instruction.operation_size = $1;
+		}
+	| TOK_ASIZE x86_instruction
+		{
+			if(current_parser_state->cpu_type < CPU_386)
+			{
+				yyerror("Operation size prefix not permitted for this CPU type");
+				YYERROR;
+			}
+			if($1 == BITSIZE64 && BITSIN(current_parser_state->bit_size) != BITSIZE64)
+			{
+				yyerror("Operation size prefix not permitted for this CPU mode");
+				YYERROR;
+			}
+			if(current_instruction.address_size != 0)
+			{
+				yyerror("Duplicate address size prefix");
+				YYERROR;
+			}
+			current_instruction.address_size = $1;
+		}
+	| TOK_286_UMOV_PREFIX x86_instruction
+		{
+			if(current_instruction.umov_prefix)
+			{
+				yyerror("Duplicate 286 user mode prefix");
+				YYERROR;
+			}
+			current_instruction.umov_prefix = true;
+		}
+	| mnemonic '\n'
+		{
+			advance_line();
+		}
+	| mnemonic_operands '\n'
+		{
+			advance_line();
+		}
+	;
+
+mnemonic
+	: TOK_MNEMONIC
+		{
+			instruction_clear(&current_instruction, current_parser_state);
+			current_instruction.isa = ISA_X86;
+			current_instruction.mnemonic = _GET_MNEM($1);
+			switch(current_instruction.mnemonic)
+			{
+			case MNEM_CMOV_CC:
+			case MNEM_FCMOV_CC:
+			case MNEM_J_CC:
+			case MNEM_SET_CC:
+				current_instruction.condition = _GET_COND($1);
+				break;
+			default:
+				break;
+			}
+		}
+	;
+
+mnemonic_operands
+	: mnemonic operand
+		{
+			current_instruction.operand_count ++;
+		}
+	| mnemonic_operands
+		{
+			if(current_instruction.operand_count >= MAX_OPD_COUNT)
+			{
+				yyerror("Too many operands to instruction");
+				YYERROR;
+			}
+		}
+		',' operand
+		{
+			current_instruction.operand_count ++;
+		}
+	;
+
+operand
+	: TOK_GPR
+		{
+			operand_set_register(&current_operand, _OPD_TYPE($1), _OPD_VALUE($1));
+		}
+	| TOK_DW
+		{
+			operand_set_register(&current_operand, OPD_GPRW, REG_DX);
+		}
+	| TOK_SEG
+		{
+			operand_set_register(&current_operand, OPD_SEG, $1);
+		}
+	| TOK_STREG
+		{
+			operand_set_register(&current_operand, OPD_STREG, $1);
+		}
+	| TOK_CREG
+		{
+			operand_set_register(&current_operand, OPD_CREG, $1);
+		}
+	| TOK_DREG
+		{
+			operand_set_register(&current_operand, OPD_DREG, $1);
+		}
+	| TOK_TREG
+		{
+			operand_set_register(&current_operand, OPD_TREG, $1);
+		}
+	| TOK_MMREG
+		{
+			operand_set_register(&current_operand, OPD_MMREG, $1);
+		}
+	| TOK_XMMREG
+		{
+			operand_set_register(&current_operand, OPD_XMMREG, $1);
+		}
+	| TOK_YMMREG
+		{
+			operand_set_register(&current_operand, OPD_YMMREG, $1);
+		}
+	| TOK_ZMMREG
+		{
+			operand_set_register(&current_operand, OPD_ZMMREG, $1);
+		}
+	| expression
+		{
+			operand_set_immediate(&current_operand, $1);
+		}
+	| TOK_DATA expression
+		{
+			operand_set_immediate(&current_operand, $2);
+			current_operand.size = _GET_DATA_SIZE($1);
+		}
+	| address_operand
+	| TOK_DATA address_operand
+		{
+			current_operand.size = _GET_DATA_SIZE($1);
+		}
+	| KWD_FAR address_operand
+		{
+			current_operand.type = OPD_FARMEM;
+		}
+	| KWD_FAR TOK_DATA address_operand
+		{
+			current_operand.type = OPD_FARMEM;
+			current_operand.size = _GET_DATA_SIZE($2);
+		}
+	| expression ':' expression
+		{
+			operand_set_far_address(&current_operand, $1, $3);
+		}
+	| expression ':' TOK_DATA expression
+		{
+			operand_set_far_address(&current_operand, $1, $4);
+			current_operand.size = _GET_DATA_SIZE($3);
+		}
+	| TOK_PSWREG // nec
+		{
+			operand_set(&current_operand, OPD_PSW);
+		}
+	| TOK_RSYMBOL // nec
+		{
+			operand_set(&current_operand, OPD_RREG);
+		}
+	| TOK_CYSYMBOL // nec
+		{
+			operand_set(&current_operand, OPD_CY);
+		}
+	| TOK_DIRSYMBOL // nec
+		{
+			operand_set(&current_operand, OPD_DIR);
+		}
+	;
+
+address_operand
+	: '['
+		{
+			operand_set_memory(&current_operand);
+		}
+		address ']'
+	| TOK_SEG ':' '['
+		{
+			operand_set_memory(&current_operand);
+		}
+		address_offset ']'
+		{
+			current_operand.segment = $1;
+		}
+	| TOK_IRAM ':' '['
+		{
+			operand_set_memory(&current_operand);
+		}
+		address_offset ']'
+		{
+			current_operand.segment = REG_IRAM;
+		}
+	;
+
+address
+	: address_offset
+	| TOK_SEG ':' address_offset
+		{
+			current_operand.segment = $1;
+		}
+	| TOK_IRAM ':' address_offset
+		{
+			current_operand.segment = REG_IRAM;
+		}
+	;
+
+address_offset
+	: expression
+		{
+			current_operand.address_size = current_parser_state->bit_size;
+			current_operand.parameter = $1;
+		}
+	| TOK_DATA expression
+		{
+			current_operand.address_size = _GET_DATA_SIZE($1);
+			if(BITSIN(current_parser_state->bit_size) != BITSIZE64
+				? BITSIN(current_operand.address_size) == BITSIZE64
+				: BITSIN(current_operand.address_size) == BITSIZE16)
+			{
+				yyerror("Invalid address size\n");
+				YYERROR;
+			}
+			current_operand.parameter = $2;
+		}
+	| TOK_GPR
+		{
+			current_operand.address_size = gprsize(_OPD_TYPE($1));
+			current_operand.base = _OPD_VALUE($1);
+		}
+	| TOK_GPR addend
+		{
+			current_operand.address_size = gprsize(_OPD_TYPE($1));
+			current_operand.base = _OPD_VALUE($1);
+			current_operand.parameter = $2;
+		}
+	| TOK_GPR '*' TOK_INTEGER
+		{
+			current_operand.address_size = gprsize(_OPD_TYPE($1));
+			if(!validate_scale_permissive(current_operand.address_size, $3))
+			{
+				yyerror("Invalid scale in memory address");
+				YYERROR;
+			}
+			current_operand.index = _OPD_VALUE($1);
+			current_operand.scale = uint_get(INTVAL($3));
+			if(current_operand.scale != 1 && (current_operand.scale & 1) != 0)
+			{
+				current_operand.base = _OPD_VALUE($1);
+				current_operand.scale --;
+			}
+			if(!is_replacement)
+				int_delete($3);
+		}
+	| TOK_GPR '*' TOK_INTEGER addend
+		{
+			current_operand.address_size = gprsize(_OPD_TYPE($1));
+			if(!validate_scale_permissive(current_operand.address_size, $3))
+			{
+				yyerror("Invalid scale in memory address");
+				YYERROR;
+			}
+			current_operand.index = _OPD_VALUE($1);
+			current_operand.scale = uint_get(INTVAL($3));
+			if(current_operand.scale != 1 && (current_operand.scale & 1) != 0)
+			{
+				current_operand.base = _OPD_VALUE($1);
+				current_operand.scale --;
+			}
+			current_operand.parameter = $4;
+			if(!is_replacement)
+				int_delete($3);
+		}
+	| TOK_GPR '+' TOK_GPR
+		{
+			current_operand.address_size = gprsize(_OPD_TYPE($1));
+			if(current_operand.address_size != gprsize(_OPD_TYPE($3)))
+			{
+				yyerror("Base/index register size mismatch");
+				YYERROR;
+			}
+			current_operand.base = _OPD_VALUE($1);
+			current_operand.index = _OPD_VALUE($3);
+		}
+	| TOK_GPR '+' TOK_GPR addend
+		{
+			current_operand.address_size = gprsize(_OPD_TYPE($1));
+			if(current_operand.address_size != gprsize(_OPD_TYPE($3)))
+			{
+				yyerror("Base/index register size mismatch");
+				YYERROR;
+			}
+			current_operand.base = _OPD_VALUE($1);
+			current_operand.index = _OPD_VALUE($3);
+			current_operand.parameter = $4;
+		}
+	| TOK_GPR '+' TOK_GPR '*' TOK_INTEGER
+		{
+			current_operand.address_size = gprsize(_OPD_TYPE($1));
+			if(current_operand.address_size != gprsize(_OPD_TYPE($3)))
+			{
+				yyerror("Base/index register size mismatch");
+				YYERROR;
+			}
+			if(!validate_scale_strict(current_operand.address_size, $5))
+			{
+				yyerror("Invalid scale in memory address");
+				YYERROR;
+			}
+			current_operand.base = _OPD_VALUE($1);
+			current_operand.index = _OPD_VALUE($3);
+			current_operand.scale = uint_get(INTVAL($5));
+			if(!is_replacement)
+				int_delete($5);
+		}
+	| TOK_GPR '+' TOK_GPR '*' TOK_INTEGER addend
+		{
+			current_operand.address_size = gprsize(_OPD_TYPE($1));
+			if(current_operand.address_size != gprsize(_OPD_TYPE($3)))
+			{
+				yyerror("Base/index register size mismatch");
+				YYERROR;
+			}
+			if(!validate_scale_strict(current_operand.address_size, $5))
+			{
+				yyerror("Invalid scale in memory address");
+				YYERROR;
+			}
+			current_operand.base = _OPD_VALUE($1);
+			current_operand.index = _OPD_VALUE($3);
+			current_operand.scale = uint_get(INTVAL($5));
+			if(!is_replacement)
+				int_delete($5);
+			current_operand.parameter = $6;
+		}
+	| TOK_IPREG
+		{
+			current_operand.address_size = gprsize(_OPD_TYPE($1));
+			current_operand.base = REG_IP;
+		}
+	| TOK_IPREG addend
+		{
+			current_operand.address_size = gprsize(_OPD_TYPE($1));
+			current_operand.base = REG_IP;
+			current_operand.parameter = $2;
+		}
+	| KWD_REL expression
+		{
+			current_operand.address_size = current_parser_state->bit_size;
+			current_operand.base = REG_IPREL;
+			current_operand.parameter = $2;
+		}
+	| TOK_DATA KWD_REL expression
+		{
+			current_operand.address_size = _GET_DATA_SIZE($1);
+			current_operand.base = REG_IPREL;
+			current_operand.parameter = $3;
+		}
+	| KWD_REL TOK_DATA expression
+		{
+			current_operand.address_size = _GET_DATA_SIZE($2);
+			current_operand.base = REG_IPREL;
+			current_operand.parameter = $3;
+		}
+	;
+
+instruction
+	: i8080_instruction
+		{
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	| z80_instruction
+		{
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	;
+
+i8080_mnemonic
+	: TOK_I8080_MNEM
+		{
+			instruction_clear(&current_instruction, current_parser_state);
+			current_instruction.isa = ISA_X80;
+			current_instruction.mnemonic = _GET_MNEM($1);
+			switch(current_instruction.mnemonic)
+			{
+			case MNEM_I8080_C_CC:
+			case MNEM_I8080_J_CC:
+			case MNEM_I8080_R_CC:
+				current_instruction.condition = _GET_COND($1);
+				break;
+			default:
+				break;
+			}
+		}
+	;
+
+i8080_mnemonic_operands
+	: i8080_mnemonic i8080_operand
+		{
+			current_instruction.operand_count ++;
+		}
+	| i8080_mnemonic_operands ',' i8080_operand
+		{
+			current_instruction.operand_count ++;
+		}
+	;
+
+i8080_instruction
+	: i8080_mnemonic '\n'
+		{
+			advance_line();
+		}
+	| i8080_mnemonic_operands '\n'
+		{
+			advance_line();
+		}
+	;
+
+z80_mnemonic
+	: TOK_Z80_MNEM
+		{
+			instruction_clear(&current_instruction, current_parser_state);
+			current_instruction.isa = ISA_X80;
+			current_instruction.mnemonic = $1;
+		}
+	;
+
+z80_mnemonic_operands
+	: z80_mnemonic z80_operand
+		{
+			current_instruction.operand_count ++;
+		}
+	| z80_mnemonic_operands ',' z80_operand
+		{
+			current_instruction.operand_count ++;
+		}
+	;
+
+z80_instruction
+	: z80_mnemonic '\n'
+		{
+			advance_line();
+		}
+	| z80_mnemonic_operands '\n'
+		{
+			advance_line();
+		}
+	;
+
+i8080_operand
+	: TOK_X80_REG
+		{
+			operand_set_register(&current_operand, OPD_TOKEN, $1);
+		}
+	| TOK_X80_MEM
+		{
+			operand_set_register(&current_operand, OPD_TOKEN, $1);
+		}
+	| expression
+		{
+			operand_set_immediate(&current_operand, $1);
+		}
+	;
+
+z80_operand
+	: TOK_X80_REG
+		{
+			operand_set_register(&current_operand, OPD_TOKEN, $1);
+		}
+	| TOK_X80_MEM
+		{
+			operand_set_register(&current_operand, OPD_TOKEN, $1);
+		}
+	| TOK_X80_IDX
+		{
+			operand_set_register(&current_operand, OPD_TOKEN, $1);
+		}
+	| expression_noparen
+		{
+			operand_set_immediate(&current_operand, $1);
+		}
+	| '(' expression ')'
+		{
+			operand_set_memory(&current_operand);
+			current_operand.parameter = $2;
+		}
+	| '(' TOK_X80_MEM ')'
+		{
+			operand_set_memory(&current_operand);
+			current_operand.base = $2;
+		}
+	| '(' TOK_X80_IDX ')'
+		{
+			operand_set_memory(&current_operand);
+			current_operand.base = $2;
+		}
+	| '(' TOK_X80_IDX addend ')'
+		{
+			operand_set_memory(&current_operand);
+			current_operand.base = $2;
+			current_operand.parameter = $3;
+		}
+	;
+
+instruction
+	: i8089_instruction
+		{
+			instruction_stream_append(current_instruction_stream, &current_instruction);
+		}
+	;
+
+i8089_mnemonic
+	: TOK_I8089_MNEM
+		{
+			instruction_clear(&current_instruction, current_parser_state);
+			current_instruction.isa = ISA_8089;
+			current_instruction.mnemonic = $1;
+		}
+	;
+
+i8089_mnemonic_operand
+	: i8089_mnemonic i8089_operand
+		{
+			current_instruction.operand_count ++;
+		}
+	| i8089_mnemonic_operand ',' i8089_operand
+		{
+			current_instruction.operand_count ++;
+		}
+	;
+
+i8089_instruction
+	: i8089_mnemonic '\n'
+		{
+			advance_line();
+		}
+	| i8089_mnemonic_operand '\n'
+		{
+			advance_line();
+		}
+	;
+
+i8089_operand
+	: TOK_I8089_VALREG
+		{
+			operand_set_register(&current_operand, OPD_GPRW, $1);
+		}
+	| TOK_I8089_IXREG
+		{
+			operand_set_register(&current_operand, OPD_GPRW, $1);
+		}
+	| TOK_I8089_PTRREG
+		{
+			operand_set_register(&current_operand, OPD_GPRW, $1);
+		}
+	| '[' i8089_base_address ']'
+	| '[' i8089_base_address ']' '.' expression
+		{
+			current_operand.x89_mode = X89_OFFSET;
+			current_operand.parameter = $5;
+		}
+	| '[' i8089_base_address "]." expression
+		{
+			current_operand.x89_mode = X89_OFFSET;
+			current_operand.parameter = $4;
+		}
+	| '[' i8089_base_address '+' expression ']'
+		{
+			current_operand.x89_mode = X89_OFFSET;
+			current_operand.parameter = $4;
+		}
+	| '[' i8089_base_address '+' TOK_I8089_IXREG ']'
+		{
+			current_operand.x89_mode = X89_INDEX;
+		}
+	| '[' i8089_base_address '+' TOK_I8089_IXREG '+' ']'
+		{
+			current_operand.x89_mode = X89_INCREMENT;
+		}
+	| expression
+		{
+			operand_set_immediate(&current_operand, $1);
+		}
+	| expression ':' expression
+		{
+			operand_set_far_address(&current_operand, $1, $3);
+		}
+	;
+
+i8089_base_address
+	: TOK_I8089_PTRREG
+		{
+			operand_set_memory(&current_operand);
+			current_operand.base = $1;
+		}
+	| TOK_I8089_PPREG
+		{
+			operand_set_memory(&current_operand);
+			current_operand.base = $1;
+		}
+	;
+
+expression
+	: KWD_SEG TOK_IDENTIFIER
+		{
+			$$ = expression_segment_of($2);
+		}
+	| TOK_IDENTIFIER KWD_WRT TOK_IDENTIFIER
+		{
+			$$ = expression_relative_to($1, $3);
+		}
+	;
+
+%%
+#line 927 "../x86/parser.y"
+
+bool validate_scale_strict(bitsize_t address_size, integer_value_t scale)
+{
+	if(!uint_fits(INTVAL(scale)))
+		return false;
+	switch(uint_get(INTVAL(scale)))
+	{
+	case 1:
+		return true;
+	case 2:
+	case 4:
+	case 8:
+		return address_size != BITSIZE16;
+	default:
+		return false;
+	}
+}
+
+bool validate_scale_permissive(bitsize_t address_size, integer_value_t scale)
+{
+	if(!uint_fits(INTVAL(scale)))
+		return false;
+	switch(uint_get(INTVAL(scale)))
+	{
+	case 1:
+		return true;
+	case 2:
+	case 3:
+	case 4:
+	case 5:
+	case 8:
+	case 9:
+		return address_size != BITSIZE16;
+	default:
+		return false;
+	}
+}
+
+parser_state_t current_parser_state[1] =
+{
+	{
+		.line_number = 1,
+		.cpu_type = CPU_8086,
+		.x80_cpu_type = CPU_8080,
+		.bit_size = BITSIZE16,
+		.stream =
+		{
+			.first_instruction = NULL,
+			.last_instruction = &current_parser_state->stream.first_instruction,
+		},
+	}
+};
+
+void instruction_clear(instruction_t * ins, parser_state_t * state)
+{
+	memset(ins, 0, sizeof(instruction_t));
+	ins->line_number = state->line_number;
+	ins->cpu = state->cpu_type;
+	ins->bits = state->bit_size;
+	ins->fpu = state->fpu_type;
+	ins->condition = COND_NONE;
+	ins->segment_prefix = REG_NOSEG;
+	ins->source_segment_prefix = REG_NOSEG;
+	ins->target_segment_prefix = REG_NOSEG;
+}
+
+void operand_set(operand_t * opd, operand_type_t type)
+{
+	memset(opd, 0, sizeof(operand_t));
+	opd->type = type;
+}
+
+void operand_set_register(operand_t * opd, operand_type_t type, int number)
+{
+	operand_set(opd, type);
+	opd->base = number;
+	switch(opd->type)
+	{
+	case OPD_GPRB:
+	case OPD_GPRH:
+		opd->size = BITSIZE8;
+		break;
+	case OPD_GPRW:
+#if 0
+	case OPD_SEG:
+#endif
+		opd->size = BITSIZE16;
+		break;
+	case OPD_GPRD:
+#if 0
+	case OPD_TREG:
+#endif
+		opd->size = BITSIZE32;
+		break;
+	case OPD_GPRQ:
+	case OPD_MMREG:
+		opd->size = BITSIZE64;
+		break;
+#if 0
+	case OPD_CREG:
+	case OPD_DREG:
+		opd->size = state->bit_size;
+		break;
+	case OPD_STREG:
+		opd->size = BITSIZE80;
+		break;
+#endif
+	case OPD_XMMREG:
+		opd->size = BITSIZE128;
+		break;
+	case OPD_YMMREG:
+		opd->size = BITSIZE256;
+		break;
+	case OPD_ZMMREG:
+		opd->size = BITSIZE512;
+		break;
+	default:
+		break;
+	}
+}
+
+void operand_set_immediate(operand_t * opd, expression_t * value)
+{
+	memset(opd, 0, sizeof(operand_t));
+	opd->parameter = value;
+}
+
+void operand_set_far_address(operand_t * opd, expression_t * segment, expression_t * offset)
+{
+	operand_set(opd, OPD_FARIMM);
+	opd->parameter = offset;
+	opd->segment_value = segment;
+}
+
+void operand_set_memory(operand_t * opd)
+{
+	operand_set(opd, OPD_MEM);
+	opd->segment = REG_NOSEG;
+	opd->base = REG_NONE;
+	opd->index = REG_NONE;
+	opd->scale = 1;
+}
+
+#line 889 "../x86/../parser.y"
+
+// changes whenever tokens are added, removed or reordered in the grammar of the target
+uint64_t parser_get_token_fingerprint(void)
+{
+	// FNV-1a over the terminal names and the mapping of token numbers to them
+	uint64_t hash = 0xCBF29CE484222325;
+	for(int symbol = 0; symbol < YYNTOKENS; symbol++)
+	{
+		for(const char * name = yytname[symbol]; ; name++)
+		{
+			hash ^= (uint8_t)*name;
+			hash *= 0x100000001B3;
+			if(*name == '\0')
+				break;
+		}
+	}
+	for(size_t token = 0; token < sizeof yytranslate / sizeof yytranslate[0]; token++)
+	{
+		hash ^= yytranslate[token];
+		hash *= 0x100000001B3;
+	}
+	return hash;
+}
+
+void yyerror(const char * s)
+{
+	const char * filename = preprocessor_get_current_filename();
+	if(filename != NULL)
+		fprintf(stderr, "Error in %s, line %ld: %s\n", filename, current_parser_state->line_number, s);
+	else
+		fprintf(stderr, "Error in line %ld: %s\n", current_parser_state->line_number, s);
+}
+
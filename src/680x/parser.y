@@ -42,7 +42,7 @@ directive
 		{
 			current_parser_state->cpu_type = $1;
 
-			setup_lexer(current_parser_state);
+			lexer_switch_mode(current_parser_state);
 			advance_line();
 		}
 	;
@@ -1,14 +1,24 @@
 
 #include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdint.h>
+#include <fcntl.h>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "asm.h"
 #include "symbolic.h"
 #include "coff.h"
 #include "elf.h"
 #include "hex.h"
+#include "rom.h"
 #include "omf.h"
+#include "preprocess.h"
 #include "isa.h"
 
 extern int yyparse(void);
@@ -118,24 +128,16 @@ objfile_t output;
 
 size_t current_section;
 
-static inline bool output_format_is_textual(output_format_t format)
-{
-	switch(format)
-	{
-	case FORMAT_DEBUG:
-	case FORMAT_HEX16:
-	case FORMAT_HEX32:
-		return true;
-	default:
-		return false;
-	}
-}
-
-void convert_section_attribute_list(section_t * section, expression_t * expression)
+// returns false if the COMDAT attributes cannot be represented, since that would produce an invalid object file
+bool convert_section_attribute_list(section_t * section, expression_t * expression)
 {
+	bool valid = true;
 	uint64_t flags = 0;
 	uint64_t noflags = 0;
 	section->align = 0;
+	section->entsize = 0;
+	section->comdat = COMDAT_NONE;
+	section->comdat_key = NULL;
 	for(
 		;
 		expression != NULL && expression->argument_count != 0;
@@ -218,6 +220,18 @@ void convert_section_attribute_list(section_t * section, expression_t * expressi
 				flags |= SHF_USE32;
 				noflags |= SHF_USE16;
 			}
+			else if(strcmp(attribute->value.s, "comdat") == 0)
+			{
+				section->comdat = COMDAT_ANY;
+			}
+			else if(strcmp(attribute->value.s, "merge") == 0)
+			{
+				flags |= SHF_MERGE;
+			}
+			else if(strcmp(attribute->value.s, "strings") == 0)
+			{
+				flags |= SHF_MERGE | SHF_STRINGS;
+			}
 			else
 			{
 				fprintf(stderr, "Unknown attribute %s\n", attribute->value.s);
@@ -242,6 +256,53 @@ void convert_section_attribute_list(section_t * section, expression_t * expressi
 				}
 				section->align = uint_get(attribute->argument[1]->value.i);
 			}
+			else if(strcmp(attribute->argument[0]->value.s, "entsize") == 0)
+			{
+				if(attribute->argument[1]->type != EXP_INTEGER)
+				{
+					fprintf(stderr, "Fatal error: expected integer entry size\n");
+					break;
+				}
+				if(!uint_fits(attribute->argument[1]->value.i))
+				{
+					fprintf(stderr, "Fatal error: entry size too large to fit machine word\n");
+				}
+				section->entsize = uint_get(attribute->argument[1]->value.i);
+			}
+			else if(strcmp(attribute->argument[0]->value.s, "comdat") == 0)
+			{
+				if(attribute->argument[1]->type != EXP_IDENTIFIER)
+				{
+					fprintf(stderr, "Fatal error: expected COMDAT selection\n");
+					valid = false;
+					break;
+				}
+				if(strcmp(attribute->argument[1]->value.s, "any") == 0)
+					section->comdat = COMDAT_ANY;
+				else if(strcmp(attribute->argument[1]->value.s, "same_size") == 0)
+					section->comdat = COMDAT_SAME_SIZE;
+				else if(strcmp(attribute->argument[1]->value.s, "exact_match") == 0)
+					section->comdat = COMDAT_EXACT_MATCH;
+				else if(strcmp(attribute->argument[1]->value.s, "largest") == 0)
+					section->comdat = COMDAT_LARGEST;
+				else
+				{
+					fprintf(stderr, "Error: unknown COMDAT selection %s\n", attribute->argument[1]->value.s);
+					valid = false;
+				}
+			}
+			else if(strcmp(attribute->argument[0]->value.s, "key") == 0)
+			{
+				if(attribute->argument[1]->type != EXP_IDENTIFIER)
+				{
+					fprintf(stderr, "Fatal error: expected symbol name for COMDAT key\n");
+					valid = false;
+					break;
+				}
+				section->comdat_key = attribute->argument[1]->value.s;
+				if(section->comdat == COMDAT_NONE)
+					section->comdat = COMDAT_ANY;
+			}
 			else
 			{
 				fprintf(stderr, "Unknown attribute %s\n", attribute->argument[0]->value.s);
@@ -253,6 +314,7 @@ void convert_section_attribute_list(section_t * section, expression_t * expressi
 		}
 	}
 	section->flags = flags;
+	return valid;
 }
 
 void set_default_attributes(section_t * section)
@@ -292,6 +354,9 @@ void set_default_attributes(section_t * section)
 		if(section->align == 0)
 			section->align = 1;
 	}
+
+	if((section->flags & SHF_STRINGS) != 0 && section->entsize == 0)
+		section->entsize = 1;
 }
 
 block_t * block_create(uint64_t address)
@@ -308,6 +373,9 @@ void section_init(section_t * section, char * name, section_format_t format, sec
 	section->format = format;
 	section->flags = _default.flags;
 	section->align = _default.align;
+	section->entsize = _default.entsize;
+	section->comdat = _default.comdat;
+	section->comdat_key = _default.comdat_key;
 	section->segment_section = -1;
 	switch(section->format)
 	{
@@ -319,6 +387,9 @@ void section_init(section_t * section, char * name, section_format_t format, sec
 		section->data.current_block = NULL;
 		section->data.first_instruction = NULL;
 		section->data.last_instruction = NULL;
+		section->data.repetition_count = 0;
+		section->data.repetition_buffer_size = 0;
+		section->data.repetitions = NULL;
 		break;
 	case SECTION_RELOC:
 		section->reloc.count = 0;
@@ -336,6 +407,91 @@ void section_init(section_t * section, char * name, section_format_t format, sec
 		section->strtab.buffer_size = 0;
 		section->strtab.buffer = NULL;
 		break;
+	case SECTION_GROUP:
+		section->group.section_index = -1;
+		break;
+	}
+}
+
+// the name and alignment of a relocation section depend on the output format
+static void section_name_relocations(section_t * section)
+{
+	section_t * relocations = section->data.relocations;
+	if(section->name != NULL)
+	{
+		const char * prefix;
+		if(elf_backend_uses_rela())
+			prefix = ".rela";
+		else
+			prefix = ".rel";
+		char * reloc_section_name = malloc(strlen(section->name) + strlen(prefix) + 1);
+		strcpy(reloc_section_name, prefix);
+		strcat(reloc_section_name, section->name);
+		free((char *)relocations->name);
+		relocations->name = reloc_section_name;
+	}
+	relocations->align = output.format != FORMAT_ELF64 ? 4 : 8; /* TODO: make alignment more format specific */
+}
+
+void objfile_set_format(objfile_t * file, output_format_t format)
+{
+	file->format = format;
+
+	file->pcrel_addend = PCREL_ADDEND_NONE;
+	file->clear_addend = false;
+	switch(format)
+	{
+	case FORMAT_BINARY:
+	case FORMAT_HEX16:
+	case FORMAT_HEX32:
+	case FORMAT_ROM:
+		file->relocation_mode = RELOCATION_IGNORE;
+		break;
+	case FORMAT_DEBUG:
+		file->relocation_mode = RELOCATION_DISPLAY;
+		break;
+	case FORMAT_JSON:
+		file->relocation_mode = RELOCATION_RECORD;
+		break;
+	case FORMAT_REL:
+		file->relocation_mode = RELOCATION_RECORD;
+		break;
+	case FORMAT_OMF80:
+	case FORMAT_OMF86:
+		file->relocation_mode = RELOCATION_RECORD;
+		file->pcrel_addend = PCREL_ADDEND_FIELD_END;
+		break;
+	case FORMAT_COFF:
+		file->relocation_mode = RELOCATION_RECORD;
+#if TARGET_X80 || TARGET_X65
+		// TODO: instead, consider the address of the next instruction
+		file->pcrel_addend = PCREL_ADDEND_FIELD_END;
+#else
+		file->pcrel_addend = PCREL_ADDEND_FIELD_START;
+#endif
+#if TARGET_X80
+		file->clear_addend = true;
+#endif
+		break;
+	case FORMAT_WIN32:
+	case FORMAT_WIN64:
+		file->relocation_mode = RELOCATION_RECORD;
+		file->pcrel_addend = PCREL_ADDEND_FIELD_END_ABSOLUTE_TWICE; // alternatively, the .absolut symbol can be introduced
+		break;
+	case FORMAT_ELF32:
+	case FORMAT_ELF64:
+		file->relocation_mode = RELOCATION_RECORD;
+		file->pcrel_addend = PCREL_ADDEND_FIELD_START;
+		file->clear_addend = elf_backend_uses_rela();
+		break;
+	}
+
+	// sections created so far got their relocation sections named for the previous format
+	for(size_t section_index = 0; section_index < file->section_count; section_index++)
+	{
+		section_t * section = file->section[section_index];
+		if(section->format == SECTION_DATA || section->format == SECTION_ZERO_DATA)
+			section_name_relocations(section);
 	}
 }
 
@@ -352,29 +508,16 @@ size_t objfile_new_section(objfile_t * file, const char * name, section_format_t
 
 	section_t * relocations = malloc(sizeof(section_t));
 	// TODO: add section name and flags later
-	char * reloc_section_name = NULL;
-	if(name != NULL)
-	{
-		const char * prefix;
-		if(elf_backend_uses_rela())
-			prefix = ".rela";
-		else
-			prefix = ".rel";
-		reloc_section_name = malloc(strlen(name) + strlen(prefix) + 1);
-		strcpy(reloc_section_name, prefix);
-		strcat(reloc_section_name, name);
-	}
-
 	_default.flags = SHF_RELOC;
-	_default.align = output.format != FORMAT_ELF64 ? 4 : 8; /* TODO: make alignment more format specific */
 
 	section_init(
 		relocations,
-		reloc_section_name,
+		NULL,
 		SECTION_RELOC,
 		_default);
 
-	file->section[file->section_count]->data.relocations = relocations;
+	section->data.relocations = relocations;
+	section_name_relocations(section);
 
 	file->section_count ++;
 	return file->section_count - 1;
@@ -492,6 +635,44 @@ void section_add_relocation(section_t * section, uint64_t offset, size_t size, b
 	}
 }
 
+void section_add_repetition(section_t * section, uint64_t offset, size_t period, size_t size)
+{
+	if(section->data.repetition_count >= section->data.repetition_buffer_size)
+	{
+		// an arbitrary increment
+		section->data.repetition_buffer_size += 8;
+		section->data.repetitions = realloc(section->data.repetitions, section->data.repetition_buffer_size * sizeof(repetition_t));
+	}
+	section->data.repetitions[section->data.repetition_count].offset = offset;
+	section->data.repetitions[section->data.repetition_count].period = period;
+	section->data.repetitions[section->data.repetition_count].size = size;
+	section->data.repetition_count++;
+}
+
+// the symbol that identifies a COMDAT section to the linker, either the one given with key= or the first global symbol defined in the section
+definition_t * section_get_comdat_symbol(size_t section_index)
+{
+	for(definition_t * current = globals; current != NULL; current = current->next)
+	{
+		if(current->deftype != DEFTYPE_EQU || current->ref.var.type != VAR_SECTION || current->ref.var.internal.section_index != section_index)
+			continue;
+
+		if(output.section[section_index]->comdat_key != NULL)
+		{
+			if(strcmp(current->name, output.section[section_index]->comdat_key) == 0)
+				return current;
+		}
+		else if(current->global)
+		{
+			return current;
+		}
+	}
+
+	if(output.section[section_index]->comdat_key != NULL)
+		fprintf(stderr, "Error: COMDAT key %s is not defined in section %s\n", output.section[section_index]->comdat_key, output.section[section_index]->name);
+	return NULL;
+}
+
 size_t section_add_symbol(section_t * section, definition_t * definition)
 {
 	if(section->symtab.count >= section->symtab.buffer_size)
@@ -519,6 +700,82 @@ size_t section_add_string(section_t * section, const char * string)
 	return section->strtab.size - length;
 }
 
+void image_init(image_t * image, size_t size)
+{
+	image->size = size;
+	image->offset = 0;
+	// gaps between the parts of the file are zero filled
+	image->buffer = calloc(size != 0 ? size : 1, 1);
+}
+
+void image_commit(image_t * image, FILE * file)
+{
+	if(fwrite(image->buffer, 1, image->size, file) != image->size)
+	{
+		fprintf(stderr, "Error: unable to write output file\n");
+	}
+	free(image->buffer);
+	image->buffer = NULL;
+}
+
+// images smaller than this are not worth starting threads for
+#define IMAGE_PARALLEL_MIN_SIZE 0x100000
+#define IMAGE_MAX_THREADS 8
+
+typedef struct image_parts_t
+{
+	image_t * image;
+	size_t count;
+	atomic_size_t next;
+	void (* write_part)(image_t * image, size_t index, void * context);
+	void * context;
+} image_parts_t;
+
+static void * image_write_parts_run(void * argument)
+{
+	image_parts_t * parts = argument;
+	for(;;)
+	{
+		size_t index = atomic_fetch_add(&parts->next, 1);
+		if(index >= parts->count)
+			break;
+		// each part has its own write position
+		image_t view = *parts->image;
+		parts->write_part(&view, index, parts->context);
+	}
+	return NULL;
+}
+
+// fills in independent parts of the image, such as the contents of separate sections, on several threads
+// the parts must only write to their own ranges of the image, at offsets calculated in advance
+void image_write_parts(image_t * image, size_t count, void (* write_part)(image_t * image, size_t index, void * context), void * context)
+{
+	image_parts_t parts[1] = { { .image = image, .count = count, .write_part = write_part, .context = context } };
+	atomic_init(&parts->next, 0);
+
+	size_t thread_count = 1;
+	if(image->size >= IMAGE_PARALLEL_MIN_SIZE)
+	{
+		long cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+		if(cpu_count > 1)
+			thread_count = cpu_count < IMAGE_MAX_THREADS ? cpu_count : IMAGE_MAX_THREADS;
+		if(thread_count > count)
+			thread_count = count;
+	}
+
+	// the calling thread also takes part
+	pthread_t threads[IMAGE_MAX_THREADS];
+	size_t started = 0;
+	for(; started + 1 < thread_count; started++)
+	{
+		if(pthread_create(&threads[started], NULL, image_write_parts_run, parts) != 0)
+			break;
+	}
+	image_write_parts_run(parts);
+	for(size_t index = 0; index < started; index++)
+		pthread_join(threads[index], NULL);
+}
+
 void output_set_location(uint64_t address)
 {
 	switch(output.format)
@@ -529,6 +786,10 @@ void output_set_location(uint64_t address)
 	case FORMAT_HEX32:
 		intel_hex_set_location(address);
 		break;
+	case FORMAT_ROM:
+		rom_set_location(address);
+		break;
+	case FORMAT_JSON:
 	case FORMAT_REL:
 	case FORMAT_OMF80:
 	case FORMAT_OMF86:
@@ -558,8 +819,6 @@ void output_byte(uint8_t value)
 	{
 	case FORMAT_DEBUG:
 		fprintf(output.file, " %02X", value);
-		if(output.file == stdout)
-			fflush(stdout);
 		break;
 	case FORMAT_BINARY:
 		fputc(value, output.file);
@@ -568,6 +827,10 @@ void output_byte(uint8_t value)
 	case FORMAT_HEX32:
 		intel_hex_output_byte(value);
 		break;
+	case FORMAT_ROM:
+		rom_output_bytes(1, &value);
+		break;
+	case FORMAT_JSON:
 	case FORMAT_REL:
 	case FORMAT_OMF80:
 	case FORMAT_OMF86:
@@ -581,6 +844,45 @@ void output_byte(uint8_t value)
 	}
 }
 
+// appends several bytes at once where the format allows it
+void output_bytes(size_t count, const uint8_t * data)
+{
+	switch(output.format)
+	{
+	case FORMAT_JSON:
+	case FORMAT_REL:
+	case FORMAT_OMF80:
+	case FORMAT_OMF86:
+	case FORMAT_COFF:
+	case FORMAT_WIN32:
+	case FORMAT_WIN64:
+	case FORMAT_ELF32:
+	case FORMAT_ELF64:
+		if(output_limit != (size_t)-1)
+		{
+			if(count > output_limit)
+				count = output_limit;
+			output_limit -= count;
+		}
+		if(count > 0)
+			section_append(output.section[current_section], count, (void *)data);
+		break;
+	case FORMAT_ROM:
+		if(output_limit != (size_t)-1)
+		{
+			if(count > output_limit)
+				count = output_limit;
+			output_limit -= count;
+		}
+		rom_output_bytes(count, data);
+		break;
+	default:
+		for(size_t offset = 0; offset < count; offset++)
+			output_byte(data[offset]);
+		break;
+	}
+}
+
 void output_flush_unit(void)
 {
 	// TODO
@@ -604,8 +906,6 @@ void output_skip(instruction_t * ins, uint64_t count)
 	{
 	case FORMAT_DEBUG:
 		fprintf(output.file, "\nSkip %08lX\n", count);
-		if(output.file == stdout)
-			fflush(stdout);
 		break;
 	case FORMAT_BINARY:
 		for(size_t offset = 0; offset < count; offset++)
@@ -615,6 +915,10 @@ void output_skip(instruction_t * ins, uint64_t count)
 	case FORMAT_HEX32:
 		intel_hex_skip(count);
 		break;
+	case FORMAT_ROM:
+		rom_skip(count);
+		break;
+	case FORMAT_JSON:
 	case FORMAT_REL:
 	case FORMAT_OMF80:
 	case FORMAT_OMF86:
@@ -646,6 +950,52 @@ void output_skip(instruction_t * ins, uint64_t count)
 	}
 }
 
+#if ARCH_BITS_IN_UNIT == 8
+// the largest word is 512 bits
+# define OUTPUT_WORD_MAX_BYTES 64
+
+// extracts the lowest bytes of a value as two's complement, least significant byte first
+static inline void output_get_bytes(integer_t value, uint8_t * bytes, size_t count)
+{
+#if USE_GMP
+	if(mpz_fits_slong_p(value))
+	{
+		long word = mpz_get_si(value);
+		for(size_t index = 0; index < count; index++)
+			bytes[index] = index < sizeof(long) ? (uint8_t)(word >> (8 * index)) : word < 0 ? 0xFF : 0x00;
+		return;
+	}
+
+	// export the absolute value, then negate it in place if needed
+	size_t exported = (mpz_sizeinbase(value, 2) + 7) / 8;
+	if(exported <= count)
+	{
+		mpz_export(bytes, &exported, -1, 1, 0, 0, value);
+		memset(bytes + exported, 0, count - exported);
+	}
+	else
+	{
+		uint8_t * buffer = mpz_export(NULL, &exported, -1, 1, 0, 0, value);
+		memcpy(bytes, buffer, count);
+		free(buffer);
+	}
+
+	if(mpz_sgn(value) < 0)
+	{
+		unsigned carry = 1;
+		for(size_t index = 0; index < count; index++)
+		{
+			carry += (uint8_t)~bytes[index];
+			bytes[index] = carry;
+			carry >>= 8;
+		}
+	}
+#else
+	for(size_t index = 0; index < count; index++)
+		bytes[index] = index < sizeof(integer_t) ? (uint8_t)(value >> (8 * index)) : value < 0 ? 0xFF : 0x00;
+#endif
+}
+#else
 static inline void output_unit_offset(integer_t value, uint64_t offset)
 {
 #if USE_GMP
@@ -658,6 +1008,7 @@ static inline void output_unit_offset(integer_t value, uint64_t offset)
 	output_unit(value >> offset);
 #endif
 }
+#endif
 
 void add_relocation(reference_t * ref, int fmt, bitsize_t size, bool pc_relative, size_t hint)
 {
@@ -678,13 +1029,11 @@ void output_word_type(reference_t * ref, int fmt, bitsize_t size, bool pc_relati
 		pc_relative ? !(ref->var.type == VAR_SECTION && ref->var.internal.section_index == current_section) : ref->var.type != VAR_NONE
 	)
 	{
-		switch(output.format)
+		switch(output.relocation_mode)
 		{
-		case FORMAT_BINARY:
-		case FORMAT_HEX16:
-		case FORMAT_HEX32:
+		case RELOCATION_IGNORE:
 			break;
-		case FORMAT_DEBUG:
+		case RELOCATION_DISPLAY:
 			fprintf(output.file, " (%s%ld",
 				ref->var.segment_of ? "SEG" : pc_relative ? "REL" : "ABS",
 				BITSIN(size));
@@ -701,58 +1050,67 @@ void output_word_type(reference_t * ref, int fmt, bitsize_t size, bool pc_relati
 			else
 				fprintf(output.file, " WRT %s)", output.section[ref->wrt_section]->name);
 			break;
-		case FORMAT_REL:
-			// TODO: maybe store relocation in stream, instead of separately?
-			add_relocation(ref, fmt, size, pc_relative, hint);
-			break;
-		case FORMAT_OMF80:
-		case FORMAT_OMF86:
-			if(pc_relative)
-			{
-				uint_add_ui(ref->value, section_get_current_offset(output.section[current_section]) + size);
-			}
-			add_relocation(ref, fmt, size, pc_relative, hint);
-			break;
-		case FORMAT_COFF:
-			if(pc_relative)
-			{
-#if TARGET_X80 || TARGET_X65
-				// TODO: instead, consider the address of the next instruction
-				uint_add_ui(ref->value, section_get_current_offset(output.section[current_section]) + size);
-#else
-				uint_add_ui(ref->value, section_get_current_offset(output.section[current_section]));
-#endif
-			}
-			add_relocation(ref, fmt, size, pc_relative, hint);
-#if TARGET_X80
-			int_set_ui(ref->value, 0);
-#endif
-			break;
-		case FORMAT_WIN32:
-		case FORMAT_WIN64:
+		case RELOCATION_RECORD:
 			if(pc_relative)
 			{
-				if(ref->var.type == VAR_NONE)
-					uint_add_ui(ref->value, 2 * section_get_current_offset(output.section[current_section]) + size); // alternatively, the .absolut symbol can be introduced
-				else
+				switch(output.pcrel_addend)
+				{
+				case PCREL_ADDEND_NONE:
+					break;
+				case PCREL_ADDEND_FIELD_START:
+					uint_add_ui(ref->value, section_get_current_offset(output.section[current_section]));
+					break;
+				case PCREL_ADDEND_FIELD_END:
 					uint_add_ui(ref->value, section_get_current_offset(output.section[current_section]) + size);
+					break;
+				case PCREL_ADDEND_FIELD_END_ABSOLUTE_TWICE:
+					if(ref->var.type == VAR_NONE)
+						uint_add_ui(ref->value, 2 * section_get_current_offset(output.section[current_section]) + size);
+					else
+						uint_add_ui(ref->value, section_get_current_offset(output.section[current_section]) + size);
+					break;
+				}
 			}
+			// TODO: maybe store relocation in stream, instead of separately?
 			add_relocation(ref, fmt, size, pc_relative, hint);
-			break;
-		case FORMAT_ELF32:
-		case FORMAT_ELF64:
-			if(pc_relative)
-			{
-//uint_print_hex(stdout, ref->value); printf("-%X\n", section_get_current_offset(output.section[current_section]));
-				uint_add_ui(ref->value, section_get_current_offset(output.section[current_section]));
-			}
-			add_relocation(ref, fmt, size, pc_relative, hint);
-			if(elf_backend_uses_rela())
+			if(output.clear_addend)
 				int_set_ui(ref->value, 0);
 			break;
 		}
 	}
 
+#if ARCH_BITS_IN_UNIT == 8
+	// the value is extracted once, then rearranged for the layout
+	size_t count = OCTETSIN(size);
+	uint8_t bytes[OUTPUT_WORD_MAX_BYTES];
+	uint8_t units[OUTPUT_WORD_MAX_BYTES];
+	assert(count <= OUTPUT_WORD_MAX_BYTES);
+
+	switch(fmt)
+	{
+	default:
+		memset(units, 0, count);
+		if(size == BITSIZE8)
+			output_get_bytes(ref->value, units, 1);
+		break;
+	case DATA_LE:
+		output_get_bytes(ref->value, units, count);
+		break;
+	case DATA_BE:
+		output_get_bytes(ref->value, bytes, count);
+		for(size_t index = 0; index < count; index++)
+			units[index] = bytes[count - 1 - index];
+		break;
+	case DATA_PE:
+		// the most significant 16-bit word first, each word stored little endian
+		output_get_bytes(ref->value, bytes, count);
+		for(size_t index = 0; index < count; index++)
+			units[index] = bytes[count - 1 - (index ^ (~count & 1))];
+		break;
+	}
+
+	output_bytes(count, units);
+#else
 	for(size_t offset = 0; offset < size; offset += ARCH_BITS_IN_UNIT)
 	{
 		switch(fmt)
@@ -774,6 +1132,7 @@ void output_word_type(reference_t * ref, int fmt, bitsize_t size, bool pc_relati
 			break;
 		}
 	}
+#endif
 }
 
 bool update_code_offsets(instruction_stream_t * instruction_stream)
@@ -927,47 +1286,146 @@ size_t instruction_get_length(instruction_t * ins, bool forgiving)
 	return length;
 }
 
-compilation_result_t precompile_instruction_stream(instruction_stream_t * instruction_stream)
-{
-	current_section = -1;
+// set when one of the requested formats places code outside of any section into .text
+static bool output_default_section = false;
 
-	for(
-		instruction_t * ins = instruction_stream->first_instruction;
-		ins != NULL;
-		ins = ins->next)
+// binds all forward/backward label references and defines the local labels
+static void precompile_local_labels(instruction_t * ins)
+{
+	for(size_t operand_index = 0; operand_index < ins->operand_count; operand_index++)
 	{
-//printf("%ld - %d,%d\n", ins->line_number, false_if_level, past_true_if_clause);
-
-		// bind all forward/backward label references
-		for(size_t operand_index = 0; operand_index < ins->operand_count; operand_index++)
-		{
-			local_label_bind_all(ins->operand[operand_index].parameter);
+		local_label_bind_all(ins->operand[operand_index].parameter);
 #if TARGET_X86
-			local_label_bind_all(ins->operand[operand_index].segment_value);
+		local_label_bind_all(ins->operand[operand_index].segment_value);
 #endif
-		}
+	}
 
-		// chain instructions by section
-		if(ins->mnemonic != PSEUDO_MNEM_SECTION)
+	if(ins->mnemonic == PSEUDO_MNEM_LOCAL_LABEL)
+		local_label_define(ins);
+}
+
+// local labels are bound on a separate thread that follows the parser through the instruction stream
+// section chaining and sizing have to wait for the parse to finish, since the parser evaluates .equ and .if expressions against the symbol and section tables
+// the parser publishes a batch of complete lines at a time, and only wakes the binder up if it ran out of instructions
+
+// lines published at once
+#define LOCAL_LABEL_BINDER_BATCH 256
+
+typedef struct local_label_binder_t
+{
+	bool started;
+	size_t pending; // lines not yet published
+	instruction_t ** bound; // link to the next instruction to be bound, only accessed by the binder
+	_Atomic(instruction_t **) published; // link following the last complete instruction
+	atomic_bool finished;
+	atomic_bool waiting;
+	pthread_mutex_t mutex;
+	pthread_cond_t condition;
+	pthread_t thread;
+} local_label_binder_t;
+
+static local_label_binder_t local_label_binder;
+
+static void * local_label_binder_run(void * argument)
+{
+	local_label_binder_t * binder = argument;
+	for(;;)
+	{
+		// finished is read first, so that the published link read after it is the final one
+		bool finished = atomic_load(&binder->finished);
+		instruction_t ** published = atomic_load(&binder->published);
+		while(binder->bound != published)
 		{
-			if(output.section_count == 0)
+			instruction_t * ins = *binder->bound;
+			precompile_local_labels(ins);
+			binder->bound = &ins->next;
+		}
+		if(finished)
+			break;
+
+		pthread_mutex_lock(&binder->mutex);
+		atomic_store(&binder->waiting, true);
+		while(atomic_load(&binder->published) == binder->bound && !atomic_load(&binder->finished))
+			pthread_cond_wait(&binder->condition, &binder->mutex);
+		atomic_store(&binder->waiting, false);
+		pthread_mutex_unlock(&binder->mutex);
+	}
+	return NULL;
+}
+
+static void local_label_binder_start(instruction_stream_t * stream)
+{
+	local_label_binder_t * binder = &local_label_binder;
+	if(sysconf(_SC_NPROCESSORS_ONLN) <= 1)
+		return;
+
+	binder->pending = 0;
+	binder->bound = &stream->first_instruction;
+	atomic_init(&binder->published, stream->last_instruction);
+	atomic_init(&binder->finished, false);
+	atomic_init(&binder->waiting, false);
+	pthread_mutex_init(&binder->mutex, NULL);
+	pthread_cond_init(&binder->condition, NULL);
+	binder->started = pthread_create(&binder->thread, NULL, local_label_binder_run, binder) == 0;
+}
+
+static void local_label_binder_wake(local_label_binder_t * binder)
+{
+	pthread_mutex_lock(&binder->mutex);
+	pthread_cond_signal(&binder->condition);
+	pthread_mutex_unlock(&binder->mutex);
+}
+
+void local_label_binder_publish(instruction_stream_t * stream)
+{
+	local_label_binder_t * binder = &local_label_binder;
+	if(!binder->started || ++binder->pending < LOCAL_LABEL_BINDER_BATCH)
+		return;
+
+	binder->pending = 0;
+	atomic_store(&binder->published, stream->last_instruction);
+	// the binder sets waiting before checking published again, so either it sees the new link or it gets woken up
+	if(atomic_load(&binder->waiting))
+		local_label_binder_wake(binder);
+}
+
+// publishes the rest of the stream and waits until the binder is done with it
+static void local_label_binder_finish(instruction_stream_t * stream)
+{
+	local_label_binder_t * binder = &local_label_binder;
+	if(!binder->started)
+		return;
+
+	atomic_store(&binder->published, stream->last_instruction);
+	atomic_store(&binder->finished, true);
+	local_label_binder_wake(binder);
+	pthread_join(binder->thread, NULL);
+	pthread_mutex_destroy(&binder->mutex);
+	pthread_cond_destroy(&binder->condition);
+}
+
+compilation_result_t precompile_instruction_stream(instruction_stream_t * instruction_stream)
+{
+	bool failed = false;
+	current_section = -1;
+
+	for(
+		instruction_t * ins = instruction_stream->first_instruction;
+		ins != NULL;
+		ins = ins->next)
+	{
+//printf("%ld - %d,%d\n", ins->line_number, false_if_level, past_true_if_clause);
+
+		// without a binder thread, the local labels are processed here
+		if(!local_label_binder.started)
+			precompile_local_labels(ins);
+
+		// chain instructions by section
+		if(ins->mnemonic != PSEUDO_MNEM_SECTION)
+		{
+			if(output.section_count == 0 && output_default_section)
 			{
-				switch(output.format)
-				{
-				case FORMAT_DEBUG:
-				case FORMAT_BINARY:
-				case FORMAT_HEX16:
-				case FORMAT_HEX32:
-					{
-						section_t attributes;
-						attributes.flags = SHF_PROGBITS | SHF_EXECINSTR | SHF_ALLOC;
-						attributes.align = 1;
-						current_section = objfile_locate_section(&output, ".text", SECTION_DATA_WITH_RELOC, attributes);
-					}
-					break;
-				default:
-					break;
-				}
+				current_section = objfile_locate_section(&output, ".text", SECTION_DATA_WITH_RELOC, section_attributes(SHF_PROGBITS | SHF_EXECINSTR | SHF_ALLOC, 1));
 			}
 
 			if(current_section != (size_t)-1)
@@ -986,7 +1444,8 @@ compilation_result_t precompile_instruction_stream(instruction_stream_t * instru
 		case PSEUDO_MNEM_SECTION:
 			{
 				section_t attributes;
-				convert_section_attribute_list(&attributes, ins->operand[1].parameter);
+				if(!convert_section_attribute_list(&attributes, ins->operand[1].parameter))
+					failed = true;
 				attributes.name = ins->operand[0].parameter->value.s;
 				set_default_attributes(&attributes);
 				current_section = objfile_locate_section(&output, ins->operand[0].parameter->value.s,
@@ -997,7 +1456,6 @@ compilation_result_t precompile_instruction_stream(instruction_stream_t * instru
 		case PSEUDO_MNEM_LOCAL_LABEL:
 			if(current_section == (size_t)-1)
 				fprintf(stderr, "Line %ld: label appearing outside section\n", ins->line_number);
-			local_label_define(ins);
 			break;
 		case PSEUDO_MNEM_EXTERNAL:
 			label_define_external(ins->operand[0].parameter->value.s);
@@ -1114,6 +1572,9 @@ compilation_result_t precompile_instruction_stream(instruction_stream_t * instru
 		*output.section[current_section]->data.last_instruction = instruction_clone(&current_instruction);
 	}
 
+	if(failed)
+		return RESULT_FAILED;
+
 	return update_code_offsets(instruction_stream) ? RESULT_CHANGED : RESULT_COMPLETE;
 }
 
@@ -1136,6 +1597,88 @@ compilation_result_t compile_instruction_stream(instruction_stream_t * instructi
 # define expression_get_hint(opd, val, fmt, size, pcrel) 0
 #endif
 
+#ifndef instruction_get_pattern
+# define instruction_get_pattern(ins) -1
+#endif
+
+static void dump_string(const char * string)
+{
+	fputc('"', output.file);
+	for(; *string != '\0'; string++)
+	{
+		if(*string == '"' || *string == '\\')
+			fprintf(output.file, "\\%c", *string);
+		else if((unsigned char)*string < 0x20)
+			fprintf(output.file, "\\u%04X", (unsigned char)*string);
+		else
+			fputc(*string, output.file);
+	}
+	fputc('"', output.file);
+}
+
+// prints a JSON record of the bytes and relocations generated for an instruction, starting from the given address and relocation
+static void dump_instruction(instruction_t * ins, uint64_t address, size_t relocation_index)
+{
+	section_t * section = output.section[current_section];
+	uint64_t end = section->data.current_address;
+
+	fprintf(output.file, "{\"line\":%ld,\"section\":", ins->line_number);
+	dump_string(section->name);
+	fprintf(output.file, ",\"offset\":%ld,\"size\":%ld,\"bytes\":\"", address, end - address);
+	block_t * block = section->data.current_block;
+	if(block != NULL && address >= block->address)
+	{
+		for(uint64_t current = address; current < end && current < block->address + block->size; current++)
+			fprintf(output.file, "%02X", block->buffer[current - block->address]);
+	}
+	fprintf(output.file, "\",\"relocations\":[");
+
+	section_t * relocations = section->data.relocations;
+	for(size_t index = relocation_index; index < relocations->reloc.count; index++)
+	{
+		relocation_t * relocation = &relocations->reloc.relocations[index];
+		fprintf(output.file, "%s{\"offset\":%ld,\"size\":%ld,\"type\":\"%s\",\"target\":",
+			index != relocation_index ? "," : "",
+			relocation->offset,
+			BITSIN(relocation->size),
+			relocation->var.segment_of ? "SEG" : relocation->pc_relative ? "REL" : "ABS");
+		switch(relocation->var.type)
+		{
+		case VAR_NONE:
+			fprintf(output.file, "null");
+			break;
+		case VAR_SECTION:
+			dump_string(output.section[relocation->var.internal.section_index]->name);
+			break;
+		case VAR_DEFINE:
+			dump_string(relocation->var.external->name);
+			break;
+		}
+		fprintf(output.file, ",\"addend\":");
+		int_print_dec(output.file, relocation->addend);
+		if(relocation->wrt_section == WRT_NONE)
+		{
+			fprintf(output.file, ",\"wrt\":null");
+		}
+		else if(relocation->wrt_section != WRT_DEFAULT)
+		{
+			fprintf(output.file, ",\"wrt\":");
+			dump_string(output.section[relocation->wrt_section]->name);
+		}
+		fprintf(output.file, "}");
+	}
+	fprintf(output.file, "]");
+
+	// the mnemonic itself is only an internal enumeration value, the line number identifies the instruction
+	if(ins->mnemonic > 0)
+	{
+		long pattern = instruction_get_pattern(ins);
+		if(pattern != -1)
+			fprintf(output.file, ",\"pattern\":%ld", pattern);
+	}
+	fprintf(output.file, "}\n");
+}
+
 compilation_result_t generate_instruction_stream(instruction_stream_t * instruction_stream)
 {
 	for(
@@ -1176,6 +1719,12 @@ compilation_result_t generate_instruction_stream(instruction_stream_t * instruct
 				if(ins->repetition.current >= ins->termination->repetition.count - 1)
 				{
 					ins->repetition.current = 0;
+					// OMF can store repeated data as iterated records
+					if(output.format == FORMAT_OMF86 && ins->termination->repetition.count > 1 && ins->code_offset > ins->termination->code_offset)
+						section_add_repetition(output.section[current_section],
+							ins->termination->code_offset,
+							ins->code_offset - ins->termination->code_offset,
+							(ins->code_offset - ins->termination->code_offset) * ins->termination->repetition.count);
 				}
 				else
 				{
@@ -1191,6 +1740,11 @@ compilation_result_t generate_instruction_stream(instruction_stream_t * instruct
 				if(output_limit == 0)
 				{
 					output_limit = ins->termination->fill.old_limit;
+					if(output.format == FORMAT_OMF86 && ins->code_offset > ins->termination->code_offset)
+						section_add_repetition(output.section[current_section],
+							ins->termination->code_offset,
+							ins->code_offset - ins->termination->code_offset,
+							ins->termination->fill.count);
 				}
 				else
 				{
@@ -1201,6 +1755,9 @@ compilation_result_t generate_instruction_stream(instruction_stream_t * instruct
 				break;
 			}
 
+			uint64_t dump_address = output.section[current_section]->data.current_address;
+			size_t dump_relocation_index = output.section[current_section]->data.relocations->reloc.count;
+
 			if(IS_PSEUDO_MNEM_DATA(ins->mnemonic))
 			{
 				int fmt = DATA_FORMAT(ins->mnemonic);
@@ -1231,14 +1788,18 @@ compilation_result_t generate_instruction_stream(instruction_stream_t * instruct
 					output_word_type(ref, fmt, size, false, hint);
 					int_clear(ref->value);
 				}
-
-				continue;
 			}
-
-			if(ins->mnemonic <= 0)
+			else if(ins->mnemonic > 0)
+			{
+				generate_instruction(ins);
+			}
+			else
+			{
 				continue;
+			}
 
-			generate_instruction(ins);
+			if(output.format == FORMAT_JSON)
+				dump_instruction(ins, dump_address, dump_relocation_index);
 		}
 
 		if(output.section[current_section]->data.first_instruction != NULL && output.format == FORMAT_DEBUG)
@@ -1311,6 +1872,74 @@ void print_version(void)
 	printf("asm-" TARGET_NAME " version " VERSION "\n");
 }
 
+// whether code appearing before the first section directive goes into .text
+static bool format_has_default_section(output_format_t format)
+{
+	switch(format)
+	{
+	case FORMAT_DEBUG:
+	case FORMAT_JSON:
+	case FORMAT_BINARY:
+	case FORMAT_HEX16:
+	case FORMAT_HEX32:
+	case FORMAT_ROM:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// sets up the processor mode that the source starts out in
+static void format_set_parser_defaults(parser_state_t * state, output_format_t format)
+{
+#if TARGET_X86
+	switch(format)
+	{
+	case FORMAT_BINARY:
+	case FORMAT_REL:
+	case FORMAT_HEX16:
+	case FORMAT_OMF86:
+	case FORMAT_ROM:
+		state->cpu_type = CPU_8086;
+		state->bit_size = BITSIZE16;
+		break;
+	case FORMAT_HEX32:
+	case FORMAT_ELF32:
+	case FORMAT_COFF:
+	case FORMAT_WIN32:
+		state->cpu_type = CPU_386;
+		state->bit_size = BITSIZE32;
+		break;
+	case FORMAT_DEBUG:
+	case FORMAT_JSON:
+	case FORMAT_ELF64:
+	case FORMAT_WIN64:
+		state->cpu_type = CPU_X64;
+		state->bit_size = BITSIZE64;
+		break;
+	case FORMAT_OMF80:
+		state->cpu_type = CPU_8080;
+		break;
+	}
+#endif
+}
+
+// the source is parsed only once for all requested outputs that start out parsing it the same way
+static bool formats_parse_alike(output_format_t format1, output_format_t format2)
+{
+	if(format_has_default_section(format1) != format_has_default_section(format2))
+		return false;
+#if TARGET_X86
+	parser_state_t state1 = *current_parser_state;
+	parser_state_t state2 = *current_parser_state;
+	format_set_parser_defaults(&state1, format1);
+	format_set_parser_defaults(&state2, format2);
+	if(state1.cpu_type != state2.cpu_type || state1.bit_size != state2.bit_size)
+		return false;
+#endif
+	return true;
+}
+
 void print_usage(char * argv0)
 {
 	printf("Usage: %s [flags] <input filename>\n"
@@ -1328,122 +1957,774 @@ void print_usage(char * argv0)
 		"\t\twin64\t64-bit Microsoft PE format\n"
 		"\t\telf32\t32-bit ELF\n"
 		"\t\telf64\t64-bit ELF\n"
-		"\t-o<output filename>\tSpecify output file name\n",
+		"\t\trom\tFlat image with gaps between .org regions filled in, optionally split into banks\n"
+		"\t\tjson\tInstruction dump, a JSON record per line (to standard output by default)\n"
+		"\t-o<output filename>\tSpecify output file name\n"
+		"\t\tSeveral -f flags may be given, the n-th -o names the output of the n-th -f\n"
+		"\t\tThe source is parsed once for each set of formats with the same default processor mode and handling of code outside sections\n"
+		"\t-I<directory>\tSearch for .include files in this directory, after the directory of the including file\n"
+		"\t-P<directory>\tKeep the tokens of included files in this directory and reuse them in later runs\n"
+		"\t-r<length>\tMaximum number of data bytes in an Intel HEX record (1 to 255, default 16)\n"
+		"\t-p<bytes>\tHexadecimal byte pattern that fills the gaps of a ROM image (default FF)\n"
+		"\t-b<size>\tSplit the ROM image into files of this size, named after the output with the bank address divided by the size appended\n",
 		argv0);
 }
 
+static bool parse_output_format(const char * name, output_format_t * format)
+{
+	if(strcasecmp(name, "bin") == 0)
+	{
+		*format = FORMAT_BINARY;
+	}
+	else if(strcasecmp(name, "hex") == 0)
+	{
+		*format = FORMAT_HEX16;
+	}
+	else if(strcasecmp(name, "hex16") == 0)
+	{
+		*format = FORMAT_HEX16;
+	}
+	else if(strcasecmp(name, "hex32") == 0)
+	{
+		*format = FORMAT_HEX32;
+	}
+	else if(strcasecmp(name, "elf") == 0)
+	{
+		*format = FORMAT_ELF32;
+	}
+	else if(strcasecmp(name, "elf32") == 0)
+	{
+		*format = FORMAT_ELF32;
+	}
+	else if(strcasecmp(name, "elf64") == 0)
+	{
+		*format = FORMAT_ELF64;
+	}
+	else if(strcasecmp(name, "omf80") == 0)
+	{
+		*format = FORMAT_OMF80;
+	}
+	else if(strcasecmp(name, "omf86") == 0)
+	{
+		*format = FORMAT_OMF86;
+	}
+	else if(strcasecmp(name, "omf") == 0)
+	{
+		*format = FORMAT_OMF86;
+	}
+	else if(strcasecmp(name, "rel") == 0)
+	{
+		*format = FORMAT_REL;
+	}
+	else if(strcasecmp(name, "coff") == 0)
+	{
+		*format = FORMAT_COFF;
+	}
+	else if(strcasecmp(name, "win32") == 0)
+	{
+		*format = FORMAT_WIN32;
+	}
+	else if(strcasecmp(name, "win64") == 0)
+	{
+		*format = FORMAT_WIN64;
+	}
+	else if(strcasecmp(name, "d") == 0)
+	{
+		*format = FORMAT_DEBUG;
+	}
+	else if(strcasecmp(name, "rom") == 0)
+	{
+		*format = FORMAT_ROM;
+	}
+	else if(strcasecmp(name, "json") == 0)
+	{
+		*format = FORMAT_JSON;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
 extern void rel_generate(const char * module_name);
 
 bool is_preprocessing_stage = true;
 
-int main(int argc, char ** argv)
+// a requested output file, the n-th -o flag belongs to the n-th -f flag
+typedef struct output_request_t
 {
-	char * input_filename = NULL;
-	char * output_filename = NULL;
+	output_format_t format;
+	const char * format_name; // as given on the command line
+	char * filename;
+	size_t group; // the first request that parses the source the same way
+} output_request_t;
 
-	output.format = FORMAT_BINARY;
+static output_request_t * output_requests = NULL;
+static size_t output_request_count = 0;
 
-	for(int i = 1; i < argc; i++)
+static void output_request_reserve(size_t count)
+{
+	if(count <= output_request_count)
+		return;
+	output_requests = realloc(output_requests, count * sizeof(output_request_t));
+	for(; output_request_count < count; output_request_count++)
 	{
-		if(argv[i][0] == '-')
+		output_requests[output_request_count].format = FORMAT_BINARY;
+		output_requests[output_request_count].format_name = "bin";
+		output_requests[output_request_count].filename = NULL;
+	}
+}
+
+static char * default_output_filename(const char * input_filename, output_format_t format)
+{
+	char * output_filename;
+	const char * extension;
+	switch(format)
+	{
+	case FORMAT_HEX16:
+	case FORMAT_HEX32:
+		extension = ".hex";
+		break;
+	case FORMAT_REL:
+		extension = ".rel";
+		break;
+	case FORMAT_OMF80:
+	case FORMAT_OMF86:
+	case FORMAT_WIN32:
+	case FORMAT_WIN64:
+		extension = ".obj";
+		break;
+	case FORMAT_COFF:
+	case FORMAT_ELF32:
+	case FORMAT_ELF64:
+		extension = ".o";
+		break;
+	case FORMAT_ROM:
+		extension = ".rom";
+		break;
+	default:
+		extension = "";
+		break;
+	}
+	if(input_filename != NULL)
+	{
+		char * dot = strrchr(input_filename, '.');
+		if(dot != NULL && strchr(dot, '/') != NULL)
+			dot = NULL;
+
+		if(dot == NULL)
 		{
-			char * arg;
-			switch(argv[i][1])
+			output_filename = malloc(strlen(input_filename) + strlen(extension) + 1);
+			strcpy(output_filename, input_filename);
+			strcat(output_filename, extension);
+		}
+		else
+		{
+			output_filename = malloc(dot - input_filename + strlen(extension) + 1);
+			memcpy(output_filename, input_filename, dot - input_filename);
+			strcpy(output_filename + (dot - input_filename), extension);
+		}
+	}
+	else
+	{
+		output_filename = malloc(1 + strlen(extension) + 1);
+		output_filename[0] = 'a';
+		strcpy(output_filename + 1, extension);
+	}
+	return output_filename;
+}
+
+// the output is generated into a pipe and a separate thread writes it out as it arrives
+// as long as the output matches the existing file, it is only compared against it, and the file is left alone if nothing changed
+typedef struct output_writer_t
+{
+	const char * filename;
+	char * path; // the file the output goes to, with symbolic links resolved
+	int pipe;
+	pthread_t thread;
+
+	FILE * existing; // the previous contents, while they match the output
+	uint64_t matched;
+
+	char * temporary_filename;
+	FILE * file; // the replacement, once the output differs
+	bool failed;
+} output_writer_t;
+
+#define OUTPUT_CHUNK_SIZE 0x10000
+
+// starts writing the replacement file, beginning with the part of the existing file that matched
+static void output_writer_replace(output_writer_t * writer)
+{
+	writer->temporary_filename = malloc(strlen(writer->path) + 8);
+	strcpy(writer->temporary_filename, writer->path);
+	strcat(writer->temporary_filename, ".XXXXXX");
+
+	int fd = mkstemp(writer->temporary_filename);
+	if(fd == -1)
+	{
+		free(writer->temporary_filename);
+		writer->temporary_filename = NULL;
+		writer->failed = true;
+		return;
+	}
+
+	// mkstemp creates the file accessible only to the owner, use the permissions fopen would have given it
+	struct stat status;
+	if(stat(writer->path, &status) == 0)
+	{
+		fchmod(fd, status.st_mode & 07777);
+	}
+	else
+	{
+		mode_t mask = umask(0);
+		umask(mask);
+		fchmod(fd, 0666 & ~mask);
+	}
+
+	writer->file = fdopen(fd, "wb");
+	if(writer->file == NULL)
+	{
+		close(fd);
+		writer->failed = true;
+		return;
+	}
+
+	if(writer->existing != NULL)
+	{
+		char buffer[OUTPUT_CHUNK_SIZE];
+		rewind(writer->existing);
+		for(uint64_t offset = 0; offset < writer->matched; )
+		{
+			size_t count = writer->matched - offset < sizeof buffer ? writer->matched - offset : sizeof buffer;
+			if(fread(buffer, 1, count, writer->existing) != count || fwrite(buffer, 1, count, writer->file) != count)
 			{
-			case 'v':
-				print_version();
-				break;
-			case 'h':
-				print_usage(argv[0]);
+				writer->failed = true;
 				break;
-			case 'f':
-				arg = argv[i][2] ? &argv[i][2] : i + 1 < argc ? argv[++i] : NULL;
-				if(arg == NULL)
-				{
-					fprintf(stderr, "No output format provided\n");
-					exit(1);
-				}
-				else if(strcasecmp(arg, "bin") == 0)
-				{
-					output.format = FORMAT_BINARY;
-				}
-				else if(strcasecmp(arg, "hex") == 0)
-				{
-					output.format = FORMAT_HEX16;
-				}
-				else if(strcasecmp(arg, "hex16") == 0)
-				{
-					output.format = FORMAT_HEX16;
-				}
-				else if(strcasecmp(arg, "hex32") == 0)
-				{
-					output.format = FORMAT_HEX32;
-				}
-				else if(strcasecmp(arg, "elf") == 0)
-				{
-					output.format = FORMAT_ELF32;
-				}
-				else if(strcasecmp(arg, "elf32") == 0)
+			}
+			offset += count;
+		}
+	}
+}
+
+static void * output_writer_run(void * argument)
+{
+	output_writer_t * writer = argument;
+	char buffer[OUTPUT_CHUNK_SIZE];
+	char existing_buffer[OUTPUT_CHUNK_SIZE];
+
+	struct stat status;
+	if(stat(writer->path, &status) == 0 && !S_ISREG(status.st_mode))
+	{
+		// devices and pipes cannot be compared or replaced, the output is written to them directly
+		writer->file = fopen(writer->path, "wb");
+		if(writer->file == NULL)
+			writer->failed = true;
+	}
+	else
+	{
+		writer->existing = fopen(writer->path, "rb");
+		if(writer->existing == NULL)
+			output_writer_replace(writer);
+	}
+
+	for(;;)
+	{
+		ssize_t count = read(writer->pipe, buffer, sizeof buffer);
+		if(count == -1 && errno == EINTR)
+			continue;
+		if(count <= 0)
+			break;
+
+		if(writer->existing != NULL)
+		{
+			if(fread(existing_buffer, 1, count, writer->existing) == count && memcmp(existing_buffer, buffer, count) == 0)
+			{
+				writer->matched += count;
+				continue;
+			}
+
+			output_writer_replace(writer);
+			fclose(writer->existing);
+			writer->existing = NULL;
+		}
+
+		// the pipe is drained even after a failure, so that the generator does not block
+		if(!writer->failed && fwrite(buffer, 1, count, writer->file) != count)
+			writer->failed = true;
+	}
+
+	if(writer->existing != NULL)
+	{
+		// all of the output matched, the file only changes if it used to be longer
+		if(fgetc(writer->existing) != EOF)
+			output_writer_replace(writer);
+		fclose(writer->existing);
+		writer->existing = NULL;
+	}
+
+	close(writer->pipe);
+	return NULL;
+}
+
+static FILE * output_writer_start(output_writer_t * writer, const char * filename)
+{
+	memset(writer, 0, sizeof(output_writer_t));
+	writer->filename = filename;
+	// a symbolic link is kept, the file it points to gets replaced
+	writer->path = realpath(filename, NULL);
+	if(writer->path == NULL)
+		writer->path = strdup(filename);
+
+	int fds[2];
+	if(pipe(fds) != 0)
+	{
+		free(writer->path);
+		return NULL;
+	}
+
+	FILE * file = fdopen(fds[1], "wb");
+	if(file == NULL)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		free(writer->path);
+		return NULL;
+	}
+	setvbuf(file, NULL, _IOFBF, OUTPUT_CHUNK_SIZE);
+
+	writer->pipe = fds[0];
+	if(pthread_create(&writer->thread, NULL, output_writer_run, writer) != 0)
+	{
+		fclose(file);
+		close(fds[0]);
+		free(writer->path);
+		return NULL;
+	}
+	return file;
+}
+
+// closes the generated output and waits for the writer, then puts the replacement file in place if there is one
+static int output_writer_finish(output_writer_t * writer, FILE * file, bool discard)
+{
+	bool failed = fclose(file) != 0;
+	pthread_join(writer->thread, NULL);
+
+	if(writer->file != NULL && fclose(writer->file) != 0)
+		failed = true;
+
+	int result = 0;
+	if(discard)
+	{
+		if(writer->temporary_filename != NULL)
+			unlink(writer->temporary_filename);
+		result = 1;
+	}
+	else if(failed || writer->failed || (writer->temporary_filename != NULL && rename(writer->temporary_filename, writer->path) != 0))
+	{
+		fprintf(stderr, "Error: unable to write %s\n", writer->filename);
+		if(writer->temporary_filename != NULL)
+			unlink(writer->temporary_filename);
+		result = 1;
+	}
+
+	free(writer->temporary_filename);
+	free(writer->path);
+	return result;
+}
+
+// runs the generation pass for a single output format on the already compiled instruction stream
+static int generate_output(output_request_t * request, char * input_filename)
+{
+	objfile_set_format(&output, request->format);
+
+	if(output.format == FORMAT_OMF86 && elf32_segments != ELF32_NO_SEGMENTS)
+	{
+		fprintf(stderr, "Segmentation specification ignored for OMF\n");
+	}
+	else if(output.format != FORMAT_ELF32 && elf32_segments != ELF32_NO_SEGMENTS && elf32_segments != ELF32_RETROLINKER)
+	{
+		fprintf(stderr, "Segmentation not supported for this format\n");
+		elf32_segments = ELF32_NO_SEGMENTS;
+	}
+
+	output_writer_t writer[1];
+	if(request->filename == NULL)
+	{
+		output.file = stdout;
+	}
+	else if(output.format == FORMAT_ROM)
+	{
+		// the image is collected in memory and written out as one or more banks at the end
+		output.file = NULL;
+	}
+	else
+	{
+		// the file is written while the output is still being generated
+		output.file = output_writer_start(writer, request->filename);
+		if(output.file == NULL)
+		{
+			fprintf(stderr, "Error: unable to open %s for writing\n", request->filename);
+			return 1;
+		}
+	}
+
+	compilation_result_t cr = generate_instruction_stream(&current_parser_state->stream);
+
+	if(cr != RESULT_FAILED && (output.format == FORMAT_ELF32 || output.format == FORMAT_ELF64) && !elf_check_sections())
+		cr = RESULT_FAILED;
+
+	if(cr != RESULT_FAILED && (output.format == FORMAT_WIN32 || output.format == FORMAT_WIN64) && !coff_check_sections())
+		cr = RESULT_FAILED;
+
+	if(cr == RESULT_FAILED)
+	{
+		if(output.file != stdout && output.file != NULL)
+			output_writer_finish(writer, output.file, true);
+		return 1;
+	}
+
+	switch(output.format)
+	{
+	case FORMAT_DEBUG:
+		{
+			definition_t * current;
+			for(current = globals; current != NULL; current = current->next)
+			{
+				static const char deftype_symbol[] = "IEC";
+				printf("%s %c%c 0x", current->name, current->global ? 'G' : 'L', deftype_symbol[current->deftype]);
+				uint_print_hex(stdout, current->ref.value);
+
+				if(current->ref.var.type != VAR_NONE)
 				{
-					output.format = FORMAT_ELF32;
+					if(current->ref.var.segment_of)
+					{
+						printf(" seg");
+					}
+					if(current->ref.var.type == VAR_SECTION)
+					{
+						printf(" sect %ld", current->ref.var.internal.section_index);
+					}
+					else if(current->ref.var.type == VAR_DEFINE)
+					{
+						printf(" %s", current->ref.var.external->name);
+					}
 				}
-				else if(strcasecmp(arg, "elf64") == 0)
+				if(current->ref.wrt_section != WRT_DEFAULT)
+					printf(" wrt %ld", current->ref.wrt_section); //output.section[current->ref.wrt_section]->name);
+
+				switch(current->imported.mode)
 				{
-					output.format = FORMAT_ELF64;
+				case ENTRY_NONE:
+					break;
+				case ENTRY_BYORDINAL:
+					printf(" import from %s by ordinal 0x%04X (%d)", current->imported.module, current->imported.ordinal, current->imported.ordinal);
+					break;
+				case ENTRY_BYNAME:
+					printf(" import from %s by name", current->imported.module);
+					if(current->imported.name != NULL)
+						printf(" %s", current->imported.name);
+					break;
 				}
-				else if(strcasecmp(arg, "omf80") == 0)
+
+				switch(current->exported.mode)
 				{
-					output.format = FORMAT_OMF80;
+				case ENTRY_NONE:
+					break;
+				case ENTRY_BYORDINAL:
+					printf(" export by ordinal 0x%04X (%d)", current->exported.ordinal, current->exported.ordinal);
+					if(current->exported.name != NULL)
+						printf(" with name %s", current->exported.name);
+					break;
+				case ENTRY_BYNAME:
+					printf(" export by name");
+					if(current->exported.name != NULL)
+						printf(" %s", current->exported.name);
+					break;
 				}
-				else if(strcasecmp(arg, "omf86") == 0)
+
+				printf("\n");
+			}
+		}
+		break;
+
+	case FORMAT_JSON:
+	case FORMAT_BINARY:
+		break;
+
+	case FORMAT_HEX16:
+	case FORMAT_HEX32:
+		if(!intel_hex_close())
+			cr = RESULT_FAILED;
+		break;
+
+	case FORMAT_REL:
+		rel_generate(input_filename);
+		break;
+
+	case FORMAT_OMF80:
+	case FORMAT_OMF86:
+		if(!omf_generate(input_filename))
+			cr = RESULT_FAILED;
+		break;
+
+	case FORMAT_ELF32:
+	case FORMAT_ELF64:
+		elf_generate();
+		break;
+
+	case FORMAT_COFF:
+	case FORMAT_WIN32:
+	case FORMAT_WIN64:
+		coff_generate(input_filename);
+		break;
+
+	case FORMAT_ROM:
+		{
+			if(!rom_check_range())
+				return 1;
+
+			int result = 0;
+			for(size_t bank_index = 0; bank_index < rom_get_bank_count(); bank_index++)
+			{
+				char * bank_filename = rom_get_bank_filename(request->filename, bank_index);
+				FILE * file = output_writer_start(writer, bank_filename);
+				if(file == NULL)
 				{
-					output.format = FORMAT_OMF86;
+					fprintf(stderr, "Error: unable to open %s for writing\n", bank_filename);
+					free(bank_filename);
+					return 1;
 				}
-				else if(strcasecmp(arg, "omf") == 0)
+				rom_write_bank(file, bank_index);
+				if(output_writer_finish(writer, file, false) != 0)
+					result = 1;
+				free(bank_filename);
+			}
+			return result;
+		}
+	}
+
+	if(output.file == stdout)
+		return cr == RESULT_FAILED ? 1 : 0;
+
+	return output_writer_finish(writer, output.file, cr == RESULT_FAILED);
+}
+
+// provided by the flex generated scanner
+struct yy_buffer_state * yy_scan_buffer(char * base, size_t size);
+
+bool input_is_mapped = false;
+
+// the input read into memory when it cannot be mapped, followed by two null bytes
+static char * input_buffer = NULL;
+static size_t input_buffer_size;
+
+static bool input_is_regular_file(const char * filename)
+{
+	struct stat status;
+	return filename != NULL && stat(filename, &status) == 0 && S_ISREG(status.st_mode);
+}
+
+// reads a pipe or other special file completely, so that it can be scanned for each group of outputs
+static bool input_load(const char * filename)
+{
+	FILE * file = filename != NULL ? fopen(filename, "rb") : stdin;
+	if(file == NULL)
+		return false;
+
+	size_t buffer_size = 0x10000;
+	input_buffer = malloc(buffer_size);
+	input_buffer_size = 0;
+	for(;;)
+	{
+		if(buffer_size - input_buffer_size <= 2)
+		{
+			buffer_size *= 2;
+			input_buffer = realloc(input_buffer, buffer_size);
+		}
+		size_t count = fread(input_buffer + input_buffer_size, 1, buffer_size - input_buffer_size - 2, file);
+		input_buffer_size += count;
+		if(count == 0)
+			break;
+	}
+	bool failed = ferror(file);
+	if(file != stdin)
+		fclose(file);
+	if(failed)
+		return false;
+
+	input_buffer[input_buffer_size] = '\0';
+	input_buffer[input_buffer_size + 1] = '\0';
+	return true;
+}
+
+// maps the input file into memory, followed by the two NUL bytes flex expects at the end of a buffer, and scans it in place
+// the mapping is private and writable, since the scanner temporarily terminates tokens inside the buffer
+static bool input_map(const char * filename)
+{
+	int fd = open(filename, O_RDONLY);
+	if(fd == -1)
+		return false;
+
+	struct stat status;
+	if(fstat(fd, &status) != 0 || !S_ISREG(status.st_mode))
+	{
+		close(fd);
+		return false;
+	}
+
+	size_t size = status.st_size;
+	size_t page_size = sysconf(_SC_PAGESIZE);
+	size_t mapping_size = (size + 2 + page_size - 1) / page_size * page_size;
+
+	// zero filled memory is reserved first, so the terminating bytes are there even if the file ends on a page boundary
+	char * buffer = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(buffer == MAP_FAILED)
+	{
+		close(fd);
+		return false;
+	}
+	if(size > 0 && mmap(buffer, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+	{
+		munmap(buffer, mapping_size);
+		close(fd);
+		return false;
+	}
+	close(fd);
+
+	if(yy_scan_buffer(buffer, size + 2) == NULL)
+	{
+		munmap(buffer, mapping_size);
+		return false;
+	}
+	input_is_mapped = true;
+	return true;
+}
+
+int main(int argc, char ** argv)
+{
+	char * input_filename = NULL;
+	size_t output_format_count = 0;
+	size_t output_filename_count = 0;
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(argv[i][0] == '-')
+		{
+			char * arg;
+			switch(argv[i][1])
+			{
+			case 'v':
+				print_version();
+				break;
+			case 'h':
+				print_usage(argv[0]);
+				break;
+			case 'f':
+				arg = argv[i][2] ? &argv[i][2] : i + 1 < argc ? argv[++i] : NULL;
+				if(arg == NULL)
 				{
-					output.format = FORMAT_OMF86;
+					fprintf(stderr, "No output format provided\n");
+					exit(1);
 				}
-				else if(strcasecmp(arg, "rel") == 0)
+				output_request_reserve(output_format_count + 1);
+				if(!parse_output_format(arg, &output_requests[output_format_count].format))
 				{
-					output.format = FORMAT_REL;
+					fprintf(stderr, "Unknown output format: `%s'\n", arg);
+					exit(1);
 				}
-				else if(strcasecmp(arg, "coff") == 0)
+				output_requests[output_format_count].format_name = arg;
+				output_format_count++;
+				break;
+			case 'I':
+				arg = argv[i][2] ? &argv[i][2] : i + 1 < argc ? argv[++i] : NULL;
+				if(arg == NULL)
 				{
-					output.format = FORMAT_COFF;
+					fprintf(stderr, "No include directory provided\n");
+					exit(1);
 				}
-				else if(strcasecmp(arg, "win32") == 0)
+				preprocessor_add_include_directory(arg);
+				break;
+			case 'P':
+				arg = argv[i][2] ? &argv[i][2] : i + 1 < argc ? argv[++i] : NULL;
+				if(arg == NULL)
 				{
-					output.format = FORMAT_WIN32;
+					fprintf(stderr, "No precompiled include directory provided\n");
+					exit(1);
 				}
-				else if(strcasecmp(arg, "win64") == 0)
+				preprocessor_set_precompiled_directory(arg);
+				break;
+			case 'o':
+				arg = argv[i][2] ? &argv[i][2] : i + 1 < argc ? argv[++i] : NULL;
+				if(arg == NULL)
 				{
-					output.format = FORMAT_WIN64;
+					fprintf(stderr, "No output filename provided\n");
+					exit(1);
 				}
-				else if(strcasecmp(arg, "d") == 0)
+				output_request_reserve(output_filename_count + 1);
+				output_requests[output_filename_count++].filename = arg;
+				break;
+			case 'r':
+				arg = argv[i][2] ? &argv[i][2] : i + 1 < argc ? argv[++i] : NULL;
+				if(arg == NULL)
 				{
-					output.format = FORMAT_DEBUG;
+					fprintf(stderr, "No record length provided\n");
+					exit(1);
 				}
 				else
 				{
-					fprintf(stderr, "Unknown output format: `%s'\n", arg);
-					exit(1);
+					char * end;
+					long length = strtol(arg, &end, 0);
+					if(*end != '\0' || length < 1 || length > 255)
+					{
+						fprintf(stderr, "Invalid record length: `%s'\n", arg);
+						exit(1);
+					}
+					intel_hex_record_length = length;
 				}
 				break;
-			case 'o':
+			case 'p':
 				arg = argv[i][2] ? &argv[i][2] : i + 1 < argc ? argv[++i] : NULL;
 				if(arg == NULL)
 				{
-					fprintf(stderr, "No output filename provided\n");
+					fprintf(stderr, "No fill pattern provided\n");
 					exit(1);
 				}
-				else if(output_filename != NULL)
+				else if(!rom_set_pattern(arg))
+				{
+					fprintf(stderr, "Invalid fill pattern: `%s'\n", arg);
+					exit(1);
+				}
+				break;
+			case 'b':
+				arg = argv[i][2] ? &argv[i][2] : i + 1 < argc ? argv[++i] : NULL;
+				if(arg == NULL)
 				{
-					fprintf(stderr, "Duplicate output filename provided\n");
+					fprintf(stderr, "No bank size provided\n");
 					exit(1);
 				}
 				else
 				{
-					output_filename = arg;
+					char * end;
+					long long size = strtoll(arg, &end, 0);
+					// K and M suffixes are accepted, as EPROM sizes are usually given that way
+					if(*end == 'k' || *end == 'K')
+					{
+						size *= 1024;
+						end++;
+					}
+					else if(*end == 'm' || *end == 'M')
+					{
+						size *= 1024 * 1024;
+						end++;
+					}
+					if(*end != '\0' || size < 1)
+					{
+						fprintf(stderr, "Invalid bank size: `%s'\n", arg);
+						exit(1);
+					}
+					rom_bank_size = size;
 				}
 				break;
 			case 's':
@@ -1514,52 +2795,104 @@ int main(int argc, char ** argv)
 		}
 	}
 
-	if(output.format == FORMAT_DEBUG)
-		printf("%d\n", _MNEM_TOTAL);
+	if(output_format_count == 0)
+		output_format_count = 1;
+	if(output_filename_count > output_format_count)
+	{
+		fprintf(stderr, "Duplicate output filename provided\n");
+		exit(1);
+	}
+	output_request_reserve(output_format_count);
 
-	if(output.format == FORMAT_OMF86 && elf32_segments != ELF32_NO_SEGMENTS)
+	size_t group_count = 0;
+	for(size_t request_index = 0; request_index < output_request_count; request_index++)
 	{
-		fprintf(stderr, "Segmentation specification ignored for OMF\n");
+		output_request_t * request = &output_requests[request_index];
+		request->group = request_index;
+		for(size_t other_index = 0; other_index < request_index; other_index++)
+		{
+			if(output_requests[other_index].group == other_index && formats_parse_alike(request->format, output_requests[other_index].format))
+			{
+				request->group = other_index;
+				break;
+			}
+		}
+		if(request->group == request_index)
+			group_count++;
+		if(request->format == FORMAT_DEBUG)
+			printf("%d\n", _MNEM_TOTAL);
+
+		if(request->filename == NULL && request->format != FORMAT_DEBUG && request->format != FORMAT_JSON)
+			request->filename = default_output_filename(input_filename, request->format);
+
+		for(size_t other_index = 0; other_index < request_index; other_index++)
+		{
+			if(request->filename != NULL && output_requests[other_index].filename != NULL && strcmp(request->filename, output_requests[other_index].filename) == 0)
+			{
+				fprintf(stderr, "Output file %s requested multiple times\n", request->filename);
+				exit(1);
+			}
+		}
 	}
-	else if(output.format != FORMAT_ELF32 && elf32_segments != ELF32_NO_SEGMENTS && elf32_segments != ELF32_RETROLINKER)
+
+	// an input that cannot be mapped can only be read once, so it is kept in memory for every parse
+	if(group_count > 1 && !input_is_regular_file(input_filename) && !input_load(input_filename))
 	{
-		fprintf(stderr, "Segmentation not supported for this format\n");
-		elf32_segments = ELF32_NO_SEGMENTS;
+		fprintf(stderr, "Error: unable to read %s\n", input_filename != NULL ? input_filename : "standard input");
+		exit(1);
 	}
 
-#if TARGET_X86
-	switch(output.format)
+	// formats that parse the source differently are assembled in copies of the process, the last group in this one
+	int result = 0;
+	size_t current_group = output_requests[output_request_count - 1].group;
+	size_t last_group = current_group;
+	for(size_t group = 0; group < output_request_count; group++)
 	{
-	case FORMAT_BINARY:
-	case FORMAT_REL:
-	case FORMAT_HEX16:
-	case FORMAT_OMF86:
-		current_parser_state->cpu_type = CPU_8086;
-		current_parser_state->bit_size = BITSIZE16;
-		break;
-	case FORMAT_HEX32:
-	case FORMAT_ELF32:
-	case FORMAT_COFF:
-	case FORMAT_WIN32:
-		current_parser_state->cpu_type = CPU_386;
-		current_parser_state->bit_size = BITSIZE32;
-		break;
-	case FORMAT_DEBUG:
-	case FORMAT_ELF64:
-	case FORMAT_WIN64:
-		current_parser_state->cpu_type = CPU_X64;
-		current_parser_state->bit_size = BITSIZE64;
-		break;
-	case FORMAT_OMF80:
-		current_parser_state->cpu_type = CPU_8080;
-		break;
+		if(output_requests[group].group != group || group == last_group)
+			continue;
+
+		fflush(stdout);
+		fflush(stderr);
+		pid_t pid = fork();
+		if(pid == -1)
+		{
+			fprintf(stderr, "Error: unable to assemble for output format %s\n", output_requests[group].format_name);
+			result = 1;
+			continue;
+		}
+		else if(pid == 0)
+		{
+			current_group = group;
+			result = 0;
+			break;
+		}
+
+		int status;
+		if(waitpid(pid, &status, 0) == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			result = 1;
 	}
-#endif
+
+	// all formats in the group agree on the defaults used while parsing
+	objfile_set_format(&output, output_requests[current_group].format);
+	output_default_section = format_has_default_section(output.format);
+	format_set_parser_defaults(current_parser_state, output.format);
 
 	setup_lexer(current_parser_state);
 
-	if(input_filename != NULL)
+	preprocessor_set_input_filename(input_filename);
+
+	if(input_buffer != NULL)
+	{
+		if(yy_scan_buffer(input_buffer, input_buffer_size + 2) == NULL)
+		{
+			fprintf(stderr, "Error: unable to read %s\n", input_filename != NULL ? input_filename : "standard input");
+			exit(1);
+		}
+		input_is_mapped = true;
+	}
+	else if(input_filename != NULL && !input_map(input_filename))
 	{
+		// pipes and other special files are read through stdio
 		stdin = freopen(input_filename, "r", stdin);
 		if(stdin == NULL)
 		{
@@ -1568,9 +2901,11 @@ int main(int argc, char ** argv)
 		}
 	}
 
-	int result = yyparse();
-	if(result != 0)
-		return result;
+	local_label_binder_start(&current_parser_state->stream);
+	int parse_result = yyparse();
+	local_label_binder_finish(&current_parser_state->stream);
+	if(parse_result != 0)
+		return parse_result;
 
 	is_preprocessing_stage = false;
 
@@ -1593,172 +2928,40 @@ int main(int argc, char ** argv)
 			completed = false;
 	}
 
-	if(output_filename == NULL && output.format == FORMAT_DEBUG)
+	size_t last_index = current_group;
+	for(size_t request_index = current_group + 1; request_index < output_request_count; request_index++)
 	{
-		output.file = stdout;
+		if(output_requests[request_index].group == current_group)
+			last_index = request_index;
 	}
-	else
+
+	// the backends extend the sections and symbols as they go, so all but the last output of the group are generated in a copy of the process
+	for(size_t request_index = current_group; request_index < last_index; request_index++)
 	{
-		if(output_filename == NULL)
-		{
-			const char * extension;
-			switch(output.format)
-			{
-			case FORMAT_HEX16:
-			case FORMAT_HEX32:
-				extension = ".hex";
-				break;
-			case FORMAT_REL:
-				extension = ".rel";
-				break;
-			case FORMAT_OMF80:
-			case FORMAT_OMF86:
-			case FORMAT_WIN32:
-			case FORMAT_WIN64:
-				extension = ".obj";
-				break;
-			case FORMAT_COFF:
-			case FORMAT_ELF32:
-			case FORMAT_ELF64:
-				extension = ".o";
-				break;
-			default:
-				extension = "";
-				break;
-			}
-			if(input_filename != NULL)
-			{
-				char * dot = strrchr(input_filename, '.');
-				if(dot != NULL && strchr(dot, '/') != NULL)
-					dot = NULL;
+		if(output_requests[request_index].group != current_group)
+			continue;
 
-				if(dot == NULL)
-				{
-					output_filename = malloc(strlen(input_filename) + strlen(extension) + 1);
-					strcpy(output_filename, input_filename);
-					strcat(output_filename, extension);
-				}
-				else
-				{
-					output_filename = malloc(dot - input_filename + strlen(extension) + 1);
-					memcpy(output_filename, input_filename, dot - input_filename);
-					strcpy(output_filename + (dot - input_filename), extension);
-				}
-			}
-			else
-			{
-				output_filename = malloc(1 + strlen(extension) + 1);
-				output_filename[0] = 'a';
-				strcpy(output_filename + 1, extension);
-			}
+		fflush(stdout);
+		fflush(stderr);
+		pid_t pid = fork();
+		if(pid == -1)
+		{
+			fprintf(stderr, "Error: unable to generate %s\n", output_requests[request_index].filename ? output_requests[request_index].filename : "output");
+			result = 1;
+			continue;
 		}
-		if(output_format_is_textual(output.format))
-			output.file = fopen(output_filename, "w");
-		else
-			output.file = fopen(output_filename, "wb");
-	}
-
-	cr = generate_instruction_stream(&current_parser_state->stream);
-
-	if(cr == RESULT_FAILED)
-		return 1;
-
-	switch(output.format)
-	{
-	case FORMAT_DEBUG:
+		else if(pid == 0)
 		{
-			definition_t * current;
-			for(current = globals; current != NULL; current = current->next)
-			{
-				static const char deftype_symbol[] = "IEC";
-				printf("%s %c%c 0x", current->name, current->global ? 'G' : 'L', deftype_symbol[current->deftype]);
-				uint_print_hex(stdout, current->ref.value);
-
-				if(current->ref.var.type != VAR_NONE)
-				{
-					if(current->ref.var.segment_of)
-					{
-						printf(" seg");
-					}
-					if(current->ref.var.type == VAR_SECTION)
-					{
-						printf(" sect %ld", current->ref.var.internal.section_index);
-					}
-					else if(current->ref.var.type == VAR_DEFINE)
-					{
-						printf(" %s", current->ref.var.external->name);
-					}
-				}
-				if(current->ref.wrt_section != WRT_DEFAULT)
-					printf(" wrt %ld", current->ref.wrt_section); //output.section[current->ref.wrt_section]->name);
-
-				switch(current->imported.mode)
-				{
-				case ENTRY_NONE:
-					break;
-				case ENTRY_BYORDINAL:
-					printf(" import from %s by ordinal 0x%04X (%d)", current->imported.module, current->imported.ordinal, current->imported.ordinal);
-					break;
-				case ENTRY_BYNAME:
-					printf(" import from %s by name", current->imported.module);
-					if(current->imported.name != NULL)
-						printf(" %s", current->imported.name);
-					break;
-				}
-
-				switch(current->exported.mode)
-				{
-				case ENTRY_NONE:
-					break;
-				case ENTRY_BYORDINAL:
-					printf(" export by ordinal 0x%04X (%d)", current->exported.ordinal, current->exported.ordinal);
-					if(current->exported.name != NULL)
-						printf(" with name %s", current->exported.name);
-					break;
-				case ENTRY_BYNAME:
-					printf(" export by name");
-					if(current->exported.name != NULL)
-						printf(" %s", current->exported.name);
-					break;
-				}
-
-				printf("\n");
-			}
+			exit(generate_output(&output_requests[request_index], input_filename));
 		}
-		break;
-
-	case FORMAT_BINARY:
-		break;
-
-	case FORMAT_HEX16:
-	case FORMAT_HEX32:
-		intel_hex_close();
-		break;
-
-	case FORMAT_REL:
-		rel_generate(input_filename);
-		break;
-
-	case FORMAT_OMF80:
-	case FORMAT_OMF86:
-		omf_generate(input_filename);
-		break;
-
-	case FORMAT_ELF32:
-	case FORMAT_ELF64:
-		elf_generate();
-		break;
 
-	case FORMAT_COFF:
-	case FORMAT_WIN32:
-	case FORMAT_WIN64:
-		coff_generate(input_filename);
-		break;
+		int status;
+		if(waitpid(pid, &status, 0) == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			result = 1;
 	}
 
-	if(output.file != stdout)
-		fclose(output.file);
+	if(generate_output(&output_requests[last_index], input_filename) != 0)
+		result = 1;
 
-	return 0;
+	return result;
 }
-
@@ -186,9 +186,15 @@ static inline size_t uinteger_get_size(uinteger_t source)
 typedef struct operand_t operand_t;
 
 void setup_lexer(parser_state_t * state);
+void lexer_skip_lines(bool skip);
+void lexer_switch_mode(parser_state_t * state); // for directives that change the parser state
+// set when the scanner reads from a memory mapped copy of the input that is kept until the end
+extern bool input_is_mapped;
 
 instruction_t * instruction_clone(instruction_t * ins);
 void instruction_clear(instruction_t * ins, parser_state_t * state);
+// called by the parser after each line, once the instructions appended so far are complete
+void local_label_binder_publish(instruction_stream_t * stream);
 
 typedef enum match_type_t
 {
@@ -210,6 +216,7 @@ enum section_format_t
 	SECTION_STRTAB,
 	SECTION_SYMTAB,
 	SECTION_RELOC,
+	SECTION_GROUP, // ELF section group
 };
 //#define SECTION_DATA_WITH_RELOC (SECTION_RELOC + 1) // not a real type
 //#define SECTION_ZERO_DATA_WITH_RELOC (SECTION_RELOC + 2) // not a real type
@@ -232,6 +239,15 @@ struct relocation_t
 };
 typedef struct relocation_t relocation_t;
 
+// a stretch of section data produced by repeating a block (.times or .fill), used to encode it compactly
+typedef struct repetition_t repetition_t;
+struct repetition_t
+{
+	uint64_t offset;
+	size_t period; // length of a single iteration
+	size_t size; // length of the entire stretch, might end with a partial iteration
+};
+
 typedef struct block_t block_t;
 struct block_t
 {
@@ -244,6 +260,17 @@ struct block_t
 	block_t * next;
 };
 
+// how the linker resolves duplicate copies of a COMDAT section
+enum comdat_selection_t
+{
+	COMDAT_NONE, // not a COMDAT section
+	COMDAT_ANY,
+	COMDAT_SAME_SIZE,
+	COMDAT_EXACT_MATCH,
+	COMDAT_LARGEST,
+};
+typedef enum comdat_selection_t comdat_selection_t;
+
 typedef struct section_t section_t;
 struct section_t
 {
@@ -251,6 +278,9 @@ struct section_t
 	section_format_t format;
 	uint64_t flags;
 	uint64_t align;
+	uint64_t entsize; // size of the entries of a mergeable section
+	comdat_selection_t comdat;
+	const char * comdat_key; // name of the symbol identifying the COMDAT section, or NULL to use the first global symbol
 	union
 	{
 		struct
@@ -262,6 +292,9 @@ struct section_t
 			instruction_t * first_instruction;
 			instruction_t ** last_instruction;
 			section_t * relocations;
+			size_t repetition_count;
+			size_t repetition_buffer_size;
+			repetition_t * repetitions;
 		} data;
 		struct
 		{
@@ -283,6 +316,10 @@ struct section_t
 			char * buffer;
 			// TODO: look up strings faster
 		} strtab;
+		struct
+		{
+			size_t section_index; // the COMDAT section in the group
+		} group;
 	};
 
 	uint64_t file_offset;
@@ -304,9 +341,12 @@ void section_append(section_t * section, size_t count, void * data);
 size_t section_add_string(section_t * section, const char * string);
 size_t section_add_symbol(section_t * section, definition_t * definition);
 void section_add_relocation(section_t * section, uint64_t offset, size_t size, bool pc_relative, variable_t * var, integer_t addend, size_t wrt_section, size_t hint);
+void section_add_repetition(section_t * section, uint64_t offset, size_t period, size_t size);
+definition_t * section_get_comdat_symbol(size_t section_index);
 
 enum output_format_t
 {
+	FORMAT_JSON = -2, // instruction dump, one JSON record per line
 	FORMAT_DEBUG = -1,
 	FORMAT_BINARY,
 	FORMAT_HEX16, // x80, 8089, 8086
@@ -319,13 +359,35 @@ enum output_format_t
 	FORMAT_WIN64, // x86-64, ...
 	FORMAT_ELF32, // 8086, 386, ...
 	FORMAT_ELF64, // x86-64, ...
+	FORMAT_ROM, // flat image placed at the addresses given by .org
 };
 typedef enum output_format_t output_format_t;
 
+// what happens to a reference that cannot be resolved at assembly time
+typedef enum relocation_mode_t
+{
+	RELOCATION_IGNORE, // flat formats, only the offset is emitted
+	RELOCATION_DISPLAY, // debug listing
+	RELOCATION_RECORD, // a relocation is stored with the section
+} relocation_mode_t;
+
+// adjustment made to the addend of a PC relative relocation
+typedef enum pcrel_addend_t
+{
+	PCREL_ADDEND_NONE,
+	PCREL_ADDEND_FIELD_START, // offset of the field within the section
+	PCREL_ADDEND_FIELD_END, // offset and size of the field
+	PCREL_ADDEND_FIELD_END_ABSOLUTE_TWICE, // like above, but absolute targets include the offset twice (Microsoft)
+} pcrel_addend_t;
+
 typedef struct objfile_t objfile_t;
 struct objfile_t
 {
 	output_format_t format;
+	// how references get emitted, set up by objfile_set_format
+	relocation_mode_t relocation_mode;
+	pcrel_addend_t pcrel_addend;
+	bool clear_addend; // the addend is not stored in the section data
 	FILE * file;
 	size_t section_count;
 	section_t ** section; // array of actual sections
@@ -333,6 +395,7 @@ struct objfile_t
 };
 
 void section_init(section_t * section, char * name, section_format_t format, section_t _default);
+void objfile_set_format(objfile_t * file, output_format_t format);
 size_t objfile_new_section(objfile_t * file, const char * name, section_format_t format, section_t _default);
 size_t objfile_locate_section(objfile_t * file, const char * name, section_format_t format, section_t _default);
 
@@ -348,6 +411,7 @@ typedef enum compilation_result_t
 
 void output_set_location(uint64_t address);
 void output_byte(uint8_t value);
+void output_bytes(size_t count, const uint8_t * data);
 void output_skip(instruction_t * ins, uint64_t count);
 void output_word_type(reference_t * ref, int fmt, bitsize_t size, bool pc_relative, size_t hint);
 
@@ -412,6 +476,72 @@ static inline void fwrite64be(FILE * file, uint64_t value)
 	fwrite(&value, 8, 1, file);
 }
 
+// an in-memory copy of the output file, for formats whose layout is known in advance
+typedef struct image_t image_t;
+struct image_t
+{
+	size_t size;
+	size_t offset;
+	uint8_t * buffer;
+};
+
+void image_init(image_t * image, size_t size);
+void image_commit(image_t * image, FILE * file);
+void image_write_parts(image_t * image, size_t count, void (* write_part)(image_t * image, size_t index, void * context), void * context);
+
+static inline void image_seek(image_t * image, size_t offset)
+{
+	image->offset = offset;
+}
+
+static inline void image_write(image_t * image, const void * data, size_t count)
+{
+	assert(image->offset + count <= image->size);
+	memcpy(image->buffer + image->offset, data, count);
+	image->offset += count;
+}
+
+static inline void image_write8(image_t * image, uint8_t value)
+{
+	image_write(image, &value, 1);
+}
+
+static inline void image_write16le(image_t * image, uint16_t value)
+{
+	value = htole16(value);
+	image_write(image, &value, 2);
+}
+
+static inline void image_write16be(image_t * image, uint16_t value)
+{
+	value = htobe16(value);
+	image_write(image, &value, 2);
+}
+
+static inline void image_write32le(image_t * image, uint32_t value)
+{
+	value = htole32(value);
+	image_write(image, &value, 4);
+}
+
+static inline void image_write32be(image_t * image, uint32_t value)
+{
+	value = htobe32(value);
+	image_write(image, &value, 4);
+}
+
+static inline void image_write64le(image_t * image, uint64_t value)
+{
+	value = htole64(value);
+	image_write(image, &value, 8);
+}
+
+static inline void image_write64be(image_t * image, uint64_t value)
+{
+	value = htobe64(value);
+	image_write(image, &value, 8);
+}
+
 extern const char * entry_point_name;
 
 extern bool is_preprocessing_stage;
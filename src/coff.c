@@ -7,58 +7,302 @@
 #define MIN(a, b) ((a) <= (b) ? (a) : (b))
 
 // TODO: common with ELF
-static inline void fwrite16(FILE * file, uint16_t value)
+static inline void image_write16(image_t * image, uint16_t value)
 {
 	switch(output.format == FORMAT_COFF ? elf_default_byte_order() : ELFDATA2LSB)
 	{
 	case ELFDATA2LSB:
-		fwrite16le(file, value);
+		image_write16le(image, value);
 		break;
 	case ELFDATA2MSB:
-		fwrite16be(file, value);
+		image_write16be(image, value);
 		break;
 	default:
 		assert(false);
 	}
 }
 
-static inline void fwrite32(FILE * file, uint32_t value)
+static inline void image_write32(image_t * image, uint32_t value)
 {
 	switch(output.format == FORMAT_COFF ? elf_default_byte_order() : ELFDATA2LSB)
 	{
 	case ELFDATA2LSB:
-		fwrite32le(file, value);
+		image_write32le(image, value);
 		break;
 	case ELFDATA2MSB:
-		fwrite32be(file, value);
+		image_write32be(image, value);
 		break;
 	default:
 		assert(false);
 	}
 }
 
-static inline void fwrite64(FILE * file, uint64_t value)
+static inline void image_write64(image_t * image, uint64_t value)
 {
 	switch(output.format == FORMAT_COFF ? elf_default_byte_order() : ELFDATA2LSB)
 	{
 	case ELFDATA2LSB:
-		fwrite64le(file, value);
+		image_write64le(image, value);
 		break;
 	case ELFDATA2MSB:
-		fwrite64be(file, value);
+		image_write64be(image, value);
 		break;
 	default:
 		assert(false);
 	}
 }
 
-static inline void fwrite_padded(const char * ptr, size_t maxlen, FILE * file)
+static inline void image_write_padded(image_t * image, const char * ptr, size_t maxlen)
 {
-	fwrite(ptr, 1, MIN(strlen(ptr), maxlen), file);
+	image_write(image, ptr, MIN(strlen(ptr), maxlen));
 	for(int i = strlen(ptr); i < maxlen; i++)
-		fwrite8(output.file, 0);
+		image_write8(image, 0);
 }
 
+// checksum of a COMDAT section, CRC-32 without the final inversion, as expected by the Microsoft linker
+static uint32_t coff_section_checksum(section_t * section)
+{
+	uint32_t crc = 0;
+	if(section->format != SECTION_DATA || section->data.full_size == 0)
+		return crc;
+	for(size_t offset = 0; offset < section->data.first_block->size; offset++)
+	{
+		crc ^= section->data.first_block->buffer[offset];
+		for(int bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+	}
+	return crc;
+}
+
+static uint8_t coff_comdat_selection(comdat_selection_t comdat)
+{
+	switch(comdat)
+	{
+	case COMDAT_NONE:
+		return 0;
+	case COMDAT_ANY:
+		return IMAGE_COMDAT_SELECT_ANY;
+	case COMDAT_SAME_SIZE:
+		return IMAGE_COMDAT_SELECT_SAME_SIZE;
+	case COMDAT_EXACT_MATCH:
+		return IMAGE_COMDAT_SELECT_EXACT_MATCH;
+	case COMDAT_LARGEST:
+		return IMAGE_COMDAT_SELECT_LARGEST;
+	}
+	assert(false);
+}
+
+// every COMDAT section must be identified by a symbol, otherwise the object file cannot be linked
+bool coff_check_sections(void)
+{
+	bool valid = true;
+	for(size_t section_index = 0; section_index < output.section_count; section_index ++)
+	{
+		if(output.section[section_index]->comdat == COMDAT_NONE)
+			continue;
+
+		if(section_get_comdat_symbol(section_index) == NULL)
+		{
+			if(output.section[section_index]->comdat_key == NULL)
+				fprintf(stderr, "Error: COMDAT section %s defines no global symbol\n", output.section[section_index]->name);
+			valid = false;
+		}
+	}
+	return valid;
+}
+
+typedef struct coff_parts_t
+{
+	section_t * symtab;
+	size_t symbol_offset;
+	const char * input_filename;
+} coff_parts_t;
+
+static void coff_write_section(image_t * image, size_t section_index)
+{
+	if(output.section[section_index]->format != SECTION_DATA && output.section[section_index]->format != SECTION_ZERO_DATA)
+		return;
+
+	image_seek(image, output.section[section_index]->file_offset);
+
+	if(output.section[section_index]->format == SECTION_DATA && output.section[section_index]->data.full_size > 0)
+	{
+		image_write(image, output.section[section_index]->data.first_block->buffer, output.section[section_index]->data.first_block->size);
+	}
+
+	section_t * relocations = output.section[section_index]->data.relocations;
+	if(relocations->reloc.count > 0)
+	{
+		image_seek(image, relocations->file_offset);
+
+		for(size_t index = 0; index < relocations->reloc.count; index++)
+		{
+			relocation_t rel = relocations->reloc.relocations[index];
+			if(rel.wrt_section != WRT_DEFAULT)
+			{
+				fprintf(stderr, "WRT relocations unsupported for format, ignoring frame\n");
+			}
+
+			uint32_t sym;
+			switch(rel.var.type)
+			{
+			case VAR_NONE:
+				sym = N_ABS;
+				break;
+			case VAR_SECTION:
+				sym = output.section[rel.var.internal.section_index]->elf_symbol_index;
+				break;
+			case VAR_DEFINE:
+				sym = rel.var.external->elf_symbol_index;
+				break;
+			}
+
+			image_write32(image, rel.offset);
+			image_write32(image, sym);
+			if(coff_relocation_size() == 16)
+			{
+				image_write32(image, uint_get(rel.addend));
+			}
+			int reltype = coff_get_relocation_type(rel);
+			if(reltype == -1)
+				fprintf(stderr, "Invalid relocation\n");
+			image_write16(image, reltype == -1 ? 0 : reltype);
+			if(coff_relocation_size() == 16)
+			{
+				image_write16(image, 0);
+			}
+		}
+	}
+}
+
+static void coff_write_symbols(image_t * image, section_t * symtab, const char * input_filename)
+{
+	for(size_t symbol_index = 0; symbol_index < symtab->symtab.count; symbol_index++)
+	{
+		definition_t * definition = symtab->symtab.symbols[symbol_index];
+
+		const char * name;
+		uint32_t value;
+		uint16_t section;
+		uint8_t sclass;
+		uint8_t auxnum;
+		if(definition == NULL)
+		{
+			name = ".file\0\0\0";
+			value = 0;
+			section = N_DEBUG;
+			sclass = C_FILE;
+			auxnum = 1;
+		}
+		else
+		{
+			name = definition->name;
+			switch(definition->deftype)
+			{
+			case DEFTYPE_EXTERNAL:
+				value = 0;
+				section = N_UNDEF;
+				sclass = C_EXT;
+				auxnum = 0;
+				break;
+			case DEFTYPE_COMMON:
+				// TODO: only definition->global is used
+				value = uint_get(definition->ref.value);
+				section = N_UNDEF;
+				sclass = C_EXT;
+				auxnum = 0;
+				break;
+			case DEFTYPE_EQU:
+				switch(definition->ref.var.type)
+				{
+				case VAR_NONE:
+					value = uint_get(definition->ref.value);
+					section = N_ABS;
+					sclass = definition->global ? C_EXT : C_STAT; // TODO: labels
+					auxnum = 0;
+					break;
+				case VAR_DEFINE:
+					// should not appear
+					value = 0;
+					section = N_UNDEF;
+					sclass = C_EXT;
+					auxnum = 0;
+					break;
+				case VAR_SECTION:
+					if(symbol_index == output.section[definition->ref.var.internal.section_index]->elf_symbol_index)
+					{
+						// the section symbol
+						value = 0;
+						auxnum = 1;
+					}
+					else
+					{
+						// a defined symbol
+						value = uint_get(definition->ref.value);
+						auxnum = 0;
+					}
+					section = output.section[definition->ref.var.internal.section_index]->elf_section_index;
+					sclass = definition->global ? C_EXT : C_STAT; // TODO: labels
+					break;
+				}
+			}
+		}
+
+		image_write_padded(image, name, 8); // TODO: long names
+		image_write32(image, value);
+		image_write16(image, section);
+		image_write16(image, 0); // type
+		image_write8(image, sclass);
+		image_write8(image, auxnum);
+
+		if(auxnum != 0)
+		{
+			if(definition == NULL)
+			{
+				image_write_padded(image, input_filename, 14);
+				image_write32(image, 0); // padding
+			}
+			else
+			{
+				image_write32(image, output.section[section - 1]->data.full_size);
+				image_write16(image, output.section[section - 1]->data.relocations->reloc.count);
+				image_write16(image, 0); // line numbers
+
+				if(output.section[section - 1]->comdat != COMDAT_NONE)
+				{
+					image_write32(image, coff_section_checksum(output.section[section - 1]));
+					image_write16(image, 0); // associated section
+					image_write8(image, coff_comdat_selection(output.section[section - 1]->comdat));
+				}
+				else
+				{
+					image_write32(image, 0); // padding
+					image_write16(image, 0); // padding
+					image_write8(image, 0); // padding
+				}
+				image_write8(image, 0); // padding
+				image_write16(image, 0); // padding
+			}
+		}
+
+		symbol_index += auxnum;
+	}
+}
+
+// the sections and the symbol table are written in parallel, the last part is the symbol table
+static void coff_write_part(image_t * image, size_t index, void * context)
+{
+	coff_parts_t * parts = context;
+	if(index < output.section_count)
+	{
+		coff_write_section(image, index);
+	}
+	else
+	{
+		image_seek(image, parts->symbol_offset);
+		coff_write_symbols(image, parts->symtab, parts->input_filename);
+	}
+}
 
 void coff_generate(const char * input_filename)
 {
@@ -72,6 +316,12 @@ void coff_generate(const char * input_filename)
 		}
 
 		output.section[section_index]->elf_section_index = ++section_count;
+
+		if(output.section[section_index]->comdat != COMDAT_NONE && output.format == FORMAT_COFF)
+		{
+			fprintf(stderr, "Warning: COMDAT sections unsupported for format, ignoring for section %s\n", output.section[section_index]->name);
+			output.section[section_index]->comdat = COMDAT_NONE;
+		}
 	}
 
 	size_t section_data_offset;
@@ -130,6 +380,21 @@ void coff_generate(const char * input_filename)
 		}
 	}
 
+	// the symbol identifying a COMDAT section must be the first one after the section symbol to refer to it
+
+	definition_t ** comdat_symbols = malloc(output.section_count * sizeof(definition_t *));
+	for(size_t i = 0; i < output.section_count; i ++)
+	{
+		comdat_symbols[i] = NULL;
+		if(output.section[i]->comdat == COMDAT_NONE)
+			continue;
+
+		comdat_symbols[i] = section_get_comdat_symbol(i);
+		assert(comdat_symbols[i] != NULL); // checked by coff_check_sections
+		comdat_symbols[i]->elf_symbol_index = section_add_symbol(symtab, comdat_symbols[i]);
+		symtab_entry_count ++;
+	}
+
 	// add local symbols
 
 	// TODO: local common symbols do not exist
@@ -137,6 +402,8 @@ void coff_generate(const char * input_filename)
 	{
 		if(!(current->global || current->deftype == DEFTYPE_EXTERNAL))
 		{
+			if(current->deftype == DEFTYPE_EQU && current->ref.var.type == VAR_SECTION && comdat_symbols[current->ref.var.internal.section_index] == current)
+				continue;
 			current->elf_symbol_index = section_add_symbol(symtab, current);
 			symtab_entry_count ++;
 		}
@@ -148,29 +415,38 @@ void coff_generate(const char * input_filename)
 	{
 		if(current->global || current->deftype == DEFTYPE_EXTERNAL)
 		{
+			if(current->deftype == DEFTYPE_EQU && current->ref.var.type == VAR_SECTION && comdat_symbols[current->ref.var.internal.section_index] == current)
+				continue;
 			current->elf_symbol_index = section_add_symbol(symtab, current);
 			symtab_entry_count ++;
 		}
 	}
 
+	free(comdat_symbols);
+
 	// TODO: create string table
 
+	// the file is assembled in memory and written at once, the symbol table and the string table length come last
+
+	image_t image[1];
+	image_init(image, section_data_offset + 18 * symtab_entry_count + 4);
+
 	// file header
 
 	// magic
-	fwrite16(output.file, coff_magic_number());
+	image_write16(image, coff_magic_number());
 	// nscns
-	fwrite16(output.file, section_count);
+	image_write16(image, section_count);
 	// timdat
-	fwrite32(output.file, 0);
+	image_write32(image, 0);
 	// symptr
-	fwrite32(output.file, section_data_offset);
+	image_write32(image, section_data_offset);
 	// nsyms
-	fwrite32(output.file, symtab_entry_count);
+	image_write32(image, symtab_entry_count);
 	// opthdr
-	fwrite16(output.file, 0);
+	image_write16(image, 0);
 	// flags
-	fwrite16(output.file, coff_header_flags());
+	image_write16(image, coff_header_flags());
 
 	// section headers
 
@@ -180,24 +456,24 @@ void coff_generate(const char * input_filename)
 			continue;
 
 		// name
-		fwrite_padded(output.section[index]->name, 8, output.file); // TODO: long names
+		image_write_padded(image, output.section[index]->name, 8); // TODO: long names
 
 		// paddr
-		fwrite32(output.file, 0);
+		image_write32(image, 0);
 		// vaddr
-		fwrite32(output.file, 0);
+		image_write32(image, 0);
 		// size
-		fwrite32(output.file, output.section[index]->data.full_size);
+		image_write32(image, output.section[index]->data.full_size);
 		// scnptr
-		fwrite32(output.file, output.section[index]->file_offset);
+		image_write32(image, output.section[index]->file_offset);
 		// relptr
-		fwrite32(output.file, output.section[index]->data.relocations->file_offset); // TODO
+		image_write32(image, output.section[index]->data.relocations->file_offset); // TODO
 		// lnnoptr
-		fwrite32(output.file, 0);
+		image_write32(image, 0);
 		// nreloc
-		fwrite16(output.file, output.section[index]->data.relocations->reloc.count);
+		image_write16(image, output.section[index]->data.relocations->reloc.count);
 		// nlnno
-		fwrite16(output.file, 0);
+		image_write16(image, 0);
 
 		// flags
 		uint32_t flags = 0;
@@ -217,6 +493,8 @@ void coff_generate(const char * input_filename)
 				flags |= 0x40000000;
 			if((output.section[index]->flags & SHF_WRITE) != 0)
 				flags |= 0x80000000;
+			if(output.section[index]->comdat != COMDAT_NONE)
+				flags |= IMAGE_SCN_LNK_COMDAT;
 
 			switch(output.section[index]->align)
 			{
@@ -266,173 +544,19 @@ void coff_generate(const char * input_filename)
 			}
 		}
 
-		fwrite32(output.file, flags);
-	}
-
-	// section data
-
-	for(size_t section_index = 0; section_index < output.section_count; section_index++)
-	{
-		if(output.section[section_index]->format != SECTION_DATA && output.section[section_index]->format != SECTION_ZERO_DATA)
-			continue;
-
-		fseek(output.file, output.section[section_index]->file_offset, SEEK_SET);
-
-		if(output.section[section_index]->format == SECTION_DATA && output.section[section_index]->data.full_size > 0)
-		{
-			fwrite(output.section[section_index]->data.first_block->buffer, 1, output.section[section_index]->data.first_block->size, output.file);
-		}
-
-		section_t * relocations = output.section[section_index]->data.relocations;
-		if(relocations->reloc.count > 0)
-		{
-			fseek(output.file, relocations->file_offset, SEEK_SET);
-
-			for(size_t index = 0; index < relocations->reloc.count; index++)
-			{
-				relocation_t rel = relocations->reloc.relocations[index];
-				if(rel.wrt_section != WRT_DEFAULT)
-				{
-					fprintf(stderr, "WRT relocations unsupported for format, ignoring frame\n");
-				}
-
-				uint32_t sym;
-				switch(rel.var.type)
-				{
-				case VAR_NONE:
-					sym = N_ABS;
-					break;
-				case VAR_SECTION:
-					sym = output.section[rel.var.internal.section_index]->elf_symbol_index;
-					break;
-				case VAR_DEFINE:
-					sym = rel.var.external->elf_symbol_index;
-					break;
-				}
-
-				fwrite32(output.file, rel.offset);
-				fwrite32(output.file, sym);
-				if(coff_relocation_size() == 16)
-				{
-					fwrite32(output.file, uint_get(rel.addend));
-				}
-				int reltype = coff_get_relocation_type(rel);
-				if(reltype == -1)
-					fprintf(stderr, "Invalid relocation\n");
-				fwrite16(output.file, reltype == -1 ? 0 : reltype);
-				if(coff_relocation_size() == 16)
-				{
-					fwrite16(output.file, 0);
-				}
-			}
-		}
+		image_write32(image, flags);
 	}
 
-	// symbol data
+	// section data and symbol data
 
-	fseek(output.file, section_data_offset, SEEK_SET);
+	coff_parts_t parts[1] = { { .symtab = symtab, .symbol_offset = section_data_offset, .input_filename = input_filename } };
+	image_write_parts(image, output.section_count + 1, coff_write_part, parts);
 
-	for(size_t symbol_index = 0; symbol_index < symtab->symtab.count; symbol_index++)
-	{
-		definition_t * definition = symtab->symtab.symbols[symbol_index];
-
-		const char * name;
-		uint32_t value;
-		uint16_t section;
-		uint8_t sclass;
-		uint8_t auxnum;
-		if(definition == NULL)
-		{
-			name = ".file\0\0\0";
-			value = 0;
-			section = N_DEBUG;
-			sclass = C_FILE;
-			auxnum = 1;
-		}
-		else
-		{
-			name = definition->name;
-			switch(definition->deftype)
-			{
-			case DEFTYPE_EXTERNAL:
-				value = 0;
-				section = N_UNDEF;
-				sclass = C_EXT;
-				auxnum = 0;
-				break;
-			case DEFTYPE_COMMON:
-				// TODO: only definition->global is used
-				value = uint_get(definition->ref.value);
-				section = N_UNDEF;
-				sclass = C_EXT;
-				auxnum = 0;
-				break;
-			case DEFTYPE_EQU:
-				switch(definition->ref.var.type)
-				{
-				case VAR_NONE:
-					value = uint_get(definition->ref.value);
-					section = N_ABS;
-					sclass = definition->global ? C_EXT : C_STAT; // TODO: labels
-					auxnum = 0;
-					break;
-				case VAR_DEFINE:
-					// should not appear
-					value = 0;
-					section = N_UNDEF;
-					sclass = C_EXT;
-					auxnum = 0;
-					break;
-				case VAR_SECTION:
-					if(symbol_index == output.section[definition->ref.var.internal.section_index]->elf_symbol_index)
-					{
-						// the section symbol
-						value = 0;
-						auxnum = 1;
-					}
-					else
-					{
-						// a defined symbol
-						value = uint_get(definition->ref.value);
-						auxnum = 0;
-					}
-					section = output.section[definition->ref.var.internal.section_index]->elf_section_index;
-					sclass = definition->global ? C_EXT : C_STAT; // TODO: labels
-					break;
-				}
-			}
-		}
-
-		fwrite_padded(name, 8, output.file); // TODO: long names
-		fwrite32(output.file, value);
-		fwrite16(output.file, section);
-		fwrite16(output.file, 0); // type
-		fwrite8(output.file, sclass);
-		fwrite8(output.file, auxnum);
-
-		if(auxnum != 0)
-		{
-			if(definition == NULL)
-			{
-				fwrite_padded(input_filename, 14, output.file);
-				fwrite32(output.file, 0); // padding
-			}
-			else
-			{
-				fwrite32(output.file, output.section[section - 1]->data.full_size);
-				fwrite16(output.file, output.section[section - 1]->data.relocations->reloc.count);
-				fwrite16(output.file, 0); // line numbers
-
-				fwrite32(output.file, 0); // padding
-				fwrite32(output.file, 0); // padding
-				fwrite16(output.file, 0); // padding
-			}
-		}
-
-		symbol_index += auxnum;
-	}
+	image_seek(image, section_data_offset + 18 * symtab_entry_count);
 
 	// TODO: string table
-	fwrite32(output.file, 0); // length
+	image_write32(image, 0); // length
+
+	image_commit(image, output.file);
 }
 
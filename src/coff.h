@@ -18,6 +18,14 @@
 #define C_LABEL 6
 #define C_FILE 103 /* 0x67 */
 
+// PE only
+#define IMAGE_SCN_LNK_COMDAT 0x00001000
+
+#define IMAGE_COMDAT_SELECT_ANY 2
+#define IMAGE_COMDAT_SELECT_SAME_SIZE 3
+#define IMAGE_COMDAT_SELECT_EXACT_MATCH 4
+#define IMAGE_COMDAT_SELECT_LARGEST 6
+
 // x86
 #define R_ABS 0
 #define R_DIR16 1 /* 286 only */
@@ -49,6 +57,7 @@
 #define R_W65_PCR16 9
 #define R_W65_ABS24 3
 
+bool coff_check_sections(void);
 void coff_generate(const char * input_filename);
 
 #endif // _COFF_H
@@ -7,45 +7,45 @@
 
 elf32_segments_t elf32_segments = ELF32_NO_SEGMENTS;
 
-static inline void fwrite16(FILE * file, uint16_t value)
+static inline void image_write16(image_t * image, uint16_t value)
 {
 	switch(elf_default_byte_order())
 	{
 	case ELFDATA2LSB:
-		fwrite16le(file, value);
+		image_write16le(image, value);
 		break;
 	case ELFDATA2MSB:
-		fwrite16be(file, value);
+		image_write16be(image, value);
 		break;
 	default:
 		assert(false);
 	}
 }
 
-static inline void fwrite32(FILE * file, uint32_t value)
+static inline void image_write32(image_t * image, uint32_t value)
 {
 	switch(elf_default_byte_order())
 	{
 	case ELFDATA2LSB:
-		fwrite32le(file, value);
+		image_write32le(image, value);
 		break;
 	case ELFDATA2MSB:
-		fwrite32be(file, value);
+		image_write32be(image, value);
 		break;
 	default:
 		assert(false);
 	}
 }
 
-static inline void fwrite64(FILE * file, uint64_t value)
+static inline void image_write64(image_t * image, uint64_t value)
 {
 	switch(elf_default_byte_order())
 	{
 	case ELFDATA2LSB:
-		fwrite64le(file, value);
+		image_write64le(image, value);
 		break;
 	case ELFDATA2MSB:
-		fwrite64be(file, value);
+		image_write64be(image, value);
 		break;
 	default:
 		assert(false);
@@ -65,10 +65,76 @@ uint64_t elf_section_get_size(section_t * section)
 		return section->symtab.count * (output.format != FORMAT_ELF64 ? 16 : 24);
 	case SECTION_STRTAB:
 		return section->strtab.size;
+	case SECTION_GROUP:
+		return (output.section[section->group.section_index]->data.relocations->reloc.count != 0 ? 3 : 2) * 4;
 	}
 	assert(false);
 }
 
+// mergeable sections may only contain entries of the given size without relocations, and strings must be terminated
+static bool elf_section_is_mergeable(section_t * section)
+{
+	if(section->entsize == 0)
+	{
+		fprintf(stderr, "Error: mergeable section %s has no entry size\n", section->name);
+		return false;
+	}
+	if(section->format != SECTION_DATA)
+	{
+		fprintf(stderr, "Error: mergeable section %s is zero filled\n", section->name);
+		return false;
+	}
+	if(section->data.relocations->reloc.count != 0)
+	{
+		fprintf(stderr, "Error: mergeable section %s contains relocations\n", section->name);
+		return false;
+	}
+	if(section->data.full_size % section->entsize != 0)
+	{
+		fprintf(stderr, "Error: size of mergeable section %s is not a multiple of the entry size\n", section->name);
+		return false;
+	}
+	// anything other than data of the entry size could straddle entries
+	for(instruction_t * ins = section->data.first_instruction; ins != NULL; ins = ins->following)
+	{
+		if(ins->code_size == 0)
+			continue;
+		if(!IS_PSEUDO_MNEM_DATA(ins->mnemonic) || OCTETSIN(_GET_DATA_SIZE(DATA_FORMAT(ins->mnemonic))) != section->entsize)
+		{
+			fprintf(stderr, "Error in line %ld: mergeable section %s may only contain data of its entry size (%ld)\n", ins->line_number, section->name, (long)section->entsize);
+			return false;
+		}
+	}
+	if((section->flags & SHF_STRINGS) != 0 && section->data.full_size != 0)
+	{
+		block_t * block = section->data.first_block;
+		for(uint64_t offset = block->size - section->entsize; offset < block->size; offset++)
+		{
+			if(block->buffer[offset] != 0)
+			{
+				fprintf(stderr, "Error: mergeable string section %s does not end in a terminator\n", section->name);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool elf_check_sections(void)
+{
+	bool valid = true;
+	for(size_t section_index = 0; section_index < output.section_count; section_index ++)
+	{
+		section_t * section = output.section[section_index];
+		if((section->format == SECTION_DATA || section->format == SECTION_ZERO_DATA) && (section->flags & SHF_MERGE) != 0 && !elf_section_is_mergeable(section))
+			valid = false;
+		// a group without a key is identified by its section symbol instead
+		if(section->comdat != COMDAT_NONE && section->comdat_key != NULL && section_get_comdat_symbol(section_index) == NULL)
+			valid = false;
+	}
+	return valid;
+}
+
 typedef struct elf_file_t
 {
 	size_t section_count;
@@ -109,6 +175,232 @@ static size_t elf_file_new_section(elf_file_t * file, const char * name, section
 }*/
 
 
+static const uint8_t zeroes[64] = { };
+
+// writes the contents of a single section at its file offset, the sections are written in parallel
+static void elf_write_section(image_t * image, size_t index, void * context)
+{
+	elf_file_t * elffile = context;
+	size_t section_index = index + 1; // skip the null section
+
+	if((elffile->sections[section_index]->flags & SHF_NOBITS) != 0)
+		return;
+
+	image_seek(image, elffile->sections[section_index]->file_offset);
+
+	switch(elffile->sections[section_index]->format)
+	{
+	case SECTION_DATA:
+		if(elffile->sections[section_index]->data.full_size > 0)
+			image_write(image, elffile->sections[section_index]->data.first_block->buffer, elffile->sections[section_index]->data.first_block->size);
+		break;
+	case SECTION_ZERO_DATA:
+		break;
+	case SECTION_STRTAB:
+		image_write(image, elffile->sections[section_index]->strtab.buffer, elffile->sections[section_index]->strtab.size);
+		break;
+	case SECTION_SYMTAB:
+		for(size_t symbol_index = 0; symbol_index < elffile->sections[section_index]->symtab.count; symbol_index++)
+		{
+			definition_t * definition = elffile->sections[section_index]->symtab.symbols[symbol_index];
+
+			if(definition == NULL)
+			{
+				if(output.format != FORMAT_ELF64)
+				{
+					image_write(image, zeroes, 16);
+				}
+				else
+				{
+					image_write(image, zeroes, 24);
+				}
+				continue;
+			}
+
+			// name
+			image_write32(image, definition->elf_string_offset);
+
+			uint64_t value;
+			uint16_t shndx;
+			uint8_t info;
+			uint64_t size = 0;
+
+			size = uint_get(definition->size.value);
+
+			switch(definition->deftype)
+			{
+			case DEFTYPE_EXTERNAL:
+				value = 0;
+				shndx = SHN_UNDEF;
+				info = (STB_GLOBAL << 4) | STT_NOTYPE;
+				break;
+			case DEFTYPE_COMMON:
+				value = uint_get(definition->ref.value);
+				if(definition->global)
+				{
+					info = STB_GLOBAL << 4;
+				}
+				else
+				{
+					info = STB_LOCAL << 4;
+				}
+
+				shndx = SHN_COMMON;
+				info |= STT_NOTYPE;
+				break;
+			case DEFTYPE_EQU:
+				value = uint_get(definition->ref.value);
+				if(definition->global)
+				{
+					info = STB_GLOBAL << 4;
+				}
+				else
+				{
+					info = STB_LOCAL << 4;
+				}
+
+				switch(definition->ref.var.type)
+				{
+				case VAR_NONE:
+					shndx = SHN_ABS;
+					info |= STT_NOTYPE;
+					break;
+				case VAR_DEFINE:
+					// should not appear
+					shndx = SHN_UNDEF;
+					info |= STT_NOTYPE;
+					break;
+				case VAR_SECTION:
+					shndx = output.section[definition->ref.var.internal.section_index]->elf_section_index;
+					if(symbol_index == output.section[definition->ref.var.internal.section_index]->elf_symbol_index)
+					{
+						// this is the symbol corresponding to the section
+						info |= STT_SECTION;
+					}
+					else
+					{
+						info |= STT_NOTYPE;
+					}
+					break;
+				}
+			}
+
+			if(output.format != FORMAT_ELF64)
+			{
+				// value
+				image_write32(image, value);
+				// size
+				image_write32(image, size);
+			}
+			// info
+			image_write8(image, info);
+			// other
+			image_write8(image, 0);
+			// shndx
+			image_write16(image, shndx);
+			if(output.format == FORMAT_ELF64)
+			{
+				// value
+				image_write64(image, value);
+				// size
+				image_write64(image, size);
+			}
+		}
+		break;
+	case SECTION_RELOC:
+		for(size_t index = 0; index < elffile->sections[section_index]->reloc.count; index++)
+		{
+			relocation_t rel = elffile->sections[section_index]->reloc.relocations[index];
+
+			if((elf32_segments == ELF32_NO_SEGMENTS || elf32_segments == ELF32_VMA_SEGMENTS) && rel.wrt_section != WRT_DEFAULT)
+			{
+				fprintf(stderr, "WRT relocations unsupported for format, ignoring frame\n");
+			}
+
+			if(elf32_segments == ELF32_NO_SEGMENTS && rel.var.segment_of)
+			{
+				fprintf(stderr, "SEG relocations unsupported for format\n");
+			}
+
+			uint32_t segsym = -1;
+			if(elf32_segments == ELF32_SEGELF && rel.wrt_section != WRT_DEFAULT)
+			{
+				segsym = output.section[output.section[rel.wrt_section]->segment_section]->elf_symbol_index;
+			}
+
+			uint32_t sym;
+			if(elf32_segments == ELF32_RETROLINKER && rel.retrolinker_symbol_index != 0)
+				sym = rel.retrolinker_symbol_index;
+			else switch(rel.var.type)
+			{
+			case VAR_NONE:
+				sym = 0;
+				break;
+			case VAR_SECTION:
+				if(elf32_segments == ELF32_SEGELF && rel.wrt_section == WRT_DEFAULT)
+					segsym = output.section[output.section[rel.var.internal.section_index]->segment_section]->elf_symbol_index;
+				if(elf32_segments == ELF32_SEGELF && rel.var.segment_of)
+					sym = segsym;
+				else
+					sym = output.section[rel.var.internal.section_index]->elf_symbol_index;
+				break;
+			case VAR_DEFINE:
+				if(elf32_segments == ELF32_SEGELF && rel.wrt_section == WRT_DEFAULT)
+					segsym = rel.var.external->elf_segelf_symbol_index;
+				if(elf32_segments == ELF32_SEGELF && rel.var.segment_of)
+					sym = segsym;
+				else
+					sym = rel.var.external->elf_symbol_index;
+				break;
+			}
+
+			if(output.format != FORMAT_ELF64)
+			{
+				// offset
+				image_write32(image, rel.offset);
+				// info
+				uint32_t info = (sym << 8) | elf_get_relocation_type(rel);
+				image_write32(image, info);
+				// addend
+				if(elf_backend_uses_rela())
+				{
+					image_write32(image, uint_get(rel.addend));
+				}
+
+				if(elf32_segments == ELF32_SEGELF && !rel.var.segment_of && (rel.size == 2 || rel.size == 4))
+				{
+					image_write32(image, rel.offset);
+					uint32_t info = (segsym << 8) | (rel.size != 4 ? R_386_SUB16 : R_386_SUB32);
+					image_write32(image, info);
+				}
+			}
+			else
+			{
+				// offset
+				image_write64(image, rel.offset);
+				// info
+				uint64_t info = ((uint64_t)sym << 32) | elf_get_relocation_type(rel);
+				image_write64(image, info);
+				// addend
+				if(elf_backend_uses_rela())
+				{
+					image_write64(image, uint_get(rel.addend));
+				}
+			}
+		}
+		break;
+	case SECTION_GROUP:
+		{
+			section_t * member = output.section[elffile->sections[section_index]->group.section_index];
+			image_write32(image, GRP_COMDAT);
+			image_write32(image, member->elf_section_index);
+			if(member->data.relocations->reloc.count != 0)
+				image_write32(image, member->data.relocations->elf_section_index);
+		}
+		break;
+	}
+}
+
 void elf_generate(void)
 {
 	elf_file_t elffile[1] = { { } };
@@ -121,6 +413,19 @@ void elf_generate(void)
 		if(output.section[section_index]->format != SECTION_DATA && output.section[section_index]->format != SECTION_ZERO_DATA)
 			continue;
 
+		// COMDAT sections are placed in a section group, which must precede its members
+		if(output.section[section_index]->comdat != COMDAT_NONE)
+		{
+			if(output.section[section_index]->comdat != COMDAT_ANY)
+				fprintf(stderr, "Warning: only COMDAT selection any is supported for format, ignoring for section %s\n", output.section[section_index]->name);
+
+			size_t group = elf_file_new_section(elffile, ".group", SECTION_GROUP, section_attributes(0, 4));
+			elffile->sections[group]->group.section_index = section_index;
+
+			output.section[section_index]->flags |= SHF_GROUP;
+			output.section[section_index]->data.relocations->flags |= SHF_GROUP;
+		}
+
 		elf_file_add_section(elffile, output.section[section_index]);
 		if(output.section[section_index]->data.relocations->reloc.count != 0)
 		{
@@ -138,10 +443,8 @@ void elf_generate(void)
 				char * segment_name = malloc(strlen(output.section[section_index]->name) + 2);
 				strcpy(segment_name, output.section[section_index]->name);
 				strcat(segment_name, "!");
-				section_t attributes;
-				attributes.flags = output.section[section_index]->flags;
-				attributes.align = output.section[section_index]->align;
-				size_t segment_section = objfile_locate_section(&output, segment_name, output.section[section_index]->format, attributes);
+				size_t segment_section = objfile_locate_section(&output, segment_name, output.section[section_index]->format,
+					section_attributes(output.section[section_index]->flags & ~(SHF_MERGE | SHF_STRINGS | SHF_GROUP), output.section[section_index]->align));
 				output.section[section_index]->segment_section = segment_section;
 				elf_file_add_section(elffile, output.section[segment_section]);
 			}
@@ -401,301 +704,99 @@ void elf_generate(void)
 	elffile->sections[shstrtab]->file_offset = section_data_offset;
 	section_data_offset += elf_section_get_size(elffile->sections[shstrtab]);
 
+	// the section header table comes last, the entire file is built in memory and written at once
+
+	image_t image[1];
+	image_init(image, section_data_offset + elffile->section_count * (output.format != FORMAT_ELF64 ? 40 : 64));
+
 	// header
 
-	fwrite("\x7F" "ELF", 4, 1, output.file);
+	image_write(image, "\x7F" "ELF", 4);
 	if(output.format != FORMAT_ELF64)
-		fwrite8(output.file, ELFCLASS32);
+		image_write8(image, ELFCLASS32);
 	else
-		fwrite8(output.file, ELFCLASS64);
-	fwrite8(output.file, elf_default_byte_order());
-	fwrite8(output.file, EV_CURRENT);
-	fseek(output.file, 16L, SEEK_SET);
+		image_write8(image, ELFCLASS64);
+	image_write8(image, elf_default_byte_order());
+	image_write8(image, EV_CURRENT);
+	image_seek(image, 16);
 	// type
-	fwrite16(output.file, ET_REL);
+	image_write16(image, ET_REL);
 	// machine
-	fwrite16(output.file, elf_machine_type());
+	image_write16(image, elf_machine_type());
 	// version
-	fwrite32(output.file, EV_CURRENT);
+	image_write32(image, EV_CURRENT);
 	if(output.format != FORMAT_ELF64)
 	{
 		// entry
-		fwrite32(output.file, output.entry);
+		image_write32(image, output.entry);
 		// phoff
-		fwrite32(output.file, 0);
+		image_write32(image, 0);
 		// shoff
-		fwrite32(output.file, section_data_offset);
+		image_write32(image, section_data_offset);
 	}
 	else
 	{
 		// entry
-		fwrite64(output.file, output.entry);
+		image_write64(image, output.entry);
 		// phoff
-		fwrite64(output.file, 0);
+		image_write64(image, 0);
 		// shoff
-		fwrite64(output.file, section_data_offset);
+		image_write64(image, section_data_offset);
 	}
 	// flags
-	fwrite32(output.file, 0); // TODO
+	image_write32(image, 0); // TODO
 	// ehsize
 	if(output.format != FORMAT_ELF64)
 	{
-		fwrite16(output.file, 52);
+		image_write16(image, 52);
 	}
 	else
 	{
-		fwrite16(output.file, 64);
+		image_write16(image, 64);
 	}
 	// phentsize
-	fwrite16(output.file, 0);
+	image_write16(image, 0);
 	// phnum
-	fwrite16(output.file, 0);
+	image_write16(image, 0);
 	// shentsize
 	if(output.format != FORMAT_ELF64)
 	{
-		fwrite16(output.file, 40);
+		image_write16(image, 40);
 	}
 	else
 	{
-		fwrite16(output.file, 64);
+		image_write16(image, 64);
 	}
 	// shnum
-	fwrite16(output.file, elffile->section_count);
+	image_write16(image, elffile->section_count);
 	// shstrndx
-	fwrite16(output.file, shstrtab);
-
-	static const uint8_t zeroes[64] = { };
-
-	for(size_t section_index = 1; section_index < elffile->section_count; section_index++)
-	{
-		if((elffile->sections[section_index]->flags & SHF_NOBITS) != 0)
-			continue;
-
-		fseek(output.file, elffile->sections[section_index]->file_offset, SEEK_SET);
-
-		switch(elffile->sections[section_index]->format)
-		{
-		case SECTION_DATA:
-			if(elffile->sections[section_index]->data.full_size > 0)
-				fwrite(elffile->sections[section_index]->data.first_block->buffer, 1, elffile->sections[section_index]->data.first_block->size, output.file);
-			break;
-		case SECTION_ZERO_DATA:
-			break;
-		case SECTION_STRTAB:
-			fwrite(elffile->sections[section_index]->strtab.buffer, 1, elffile->sections[section_index]->strtab.size, output.file);
-			break;
-		case SECTION_SYMTAB:
-			for(size_t symbol_index = 0; symbol_index < elffile->sections[section_index]->symtab.count; symbol_index++)
-			{
-				definition_t * definition = elffile->sections[section_index]->symtab.symbols[symbol_index];
-
-				if(definition == NULL)
-				{
-					if(output.format != FORMAT_ELF64)
-					{
-						fwrite(zeroes, 16, 1, output.file);
-					}
-					else
-					{
-						fwrite(zeroes, 24, 1, output.file);
-					}
-					continue;
-				}
-
-				// name
-				fwrite32(output.file, definition->elf_string_offset);
-
-				uint64_t value;
-				uint16_t shndx;
-				uint8_t info;
-				uint64_t size = 0;
+	image_write16(image, shstrtab);
 
-				size = uint_get(definition->size.value);
+	image_write_parts(image, elffile->section_count - 1, elf_write_section, elffile);
 
-				switch(definition->deftype)
-				{
-				case DEFTYPE_EXTERNAL:
-					value = 0;
-					shndx = SHN_UNDEF;
-					info = (STB_GLOBAL << 4) | STT_NOTYPE;
-					break;
-				case DEFTYPE_COMMON:
-					value = uint_get(definition->ref.value);
-					if(definition->global)
-					{
-						info = STB_GLOBAL << 4;
-					}
-					else
-					{
-						info = STB_LOCAL << 4;
-					}
-
-					shndx = SHN_COMMON;
-					info |= STT_NOTYPE;
-					break;
-				case DEFTYPE_EQU:
-					value = uint_get(definition->ref.value);
-					if(definition->global)
-					{
-						info = STB_GLOBAL << 4;
-					}
-					else
-					{
-						info = STB_LOCAL << 4;
-					}
-
-					switch(definition->ref.var.type)
-					{
-					case VAR_NONE:
-						shndx = SHN_ABS;
-						info |= STT_NOTYPE;
-						break;
-					case VAR_DEFINE:
-						// should not appear
-						shndx = SHN_UNDEF;
-						info |= STT_NOTYPE;
-						break;
-					case VAR_SECTION:
-						shndx = output.section[definition->ref.var.internal.section_index]->elf_section_index;
-						if(symbol_index == output.section[definition->ref.var.internal.section_index]->elf_symbol_index)
-						{
-							// this is the symbol corresponding to the section
-							info |= STT_SECTION;
-						}
-						else
-						{
-							info |= STT_NOTYPE;
-						}
-						break;
-					}
-				}
-
-				if(output.format != FORMAT_ELF64)
-				{
-					// value
-					fwrite32(output.file, value);
-					// size
-					fwrite32(output.file, size);
-				}
-				// info
-				fwrite8(output.file, info);
-				// other
-				fwrite8(output.file, 0);
-				// shndx
-				fwrite16(output.file, shndx);
-				if(output.format == FORMAT_ELF64)
-				{
-					// value
-					fwrite64(output.file, value);
-					// size
-					fwrite64(output.file, size);
-				}
-			}
-			break;
-		case SECTION_RELOC:
-			for(size_t index = 0; index < elffile->sections[section_index]->reloc.count; index++)
-			{
-				relocation_t rel = elffile->sections[section_index]->reloc.relocations[index];
-
-				if((elf32_segments == ELF32_NO_SEGMENTS || elf32_segments == ELF32_VMA_SEGMENTS) && rel.wrt_section != WRT_DEFAULT)
-				{
-					fprintf(stderr, "WRT relocations unsupported for format, ignoring frame\n");
-				}
-
-				if(elf32_segments == ELF32_NO_SEGMENTS && rel.var.segment_of)
-				{
-					fprintf(stderr, "SEG relocations unsupported for format\n");
-				}
-
-				uint32_t segsym = -1;
-				if(elf32_segments == ELF32_SEGELF && rel.wrt_section != WRT_DEFAULT)
-				{
-					segsym = output.section[output.section[rel.wrt_section]->segment_section]->elf_symbol_index;
-				}
-
-				uint32_t sym;
-				if(elf32_segments == ELF32_RETROLINKER && rel.retrolinker_symbol_index != 0)
-					sym = rel.retrolinker_symbol_index;
-				else switch(rel.var.type)
-				{
-				case VAR_NONE:
-					sym = 0;
-					break;
-				case VAR_SECTION:
-					if(elf32_segments == ELF32_SEGELF && rel.wrt_section == WRT_DEFAULT)
-						segsym = output.section[output.section[rel.var.internal.section_index]->segment_section]->elf_symbol_index;
-					if(elf32_segments == ELF32_SEGELF && rel.var.segment_of)
-						sym = segsym;
-					else
-						sym = output.section[rel.var.internal.section_index]->elf_symbol_index;
-					break;
-				case VAR_DEFINE:
-					if(elf32_segments == ELF32_SEGELF && rel.wrt_section == WRT_DEFAULT)
-						segsym = rel.var.external->elf_segelf_symbol_index;
-					if(elf32_segments == ELF32_SEGELF && rel.var.segment_of)
-						sym = segsym;
-					else
-						sym = rel.var.external->elf_symbol_index;
-					break;
-				}
-
-				if(output.format != FORMAT_ELF64)
-				{
-					// offset
-					fwrite32(output.file, rel.offset);
-					// info
-					uint32_t info = (sym << 8) | elf_get_relocation_type(rel);
-					fwrite32(output.file, info);
-					// addend
-					if(elf_backend_uses_rela())
-					{
-						fwrite32(output.file, uint_get(rel.addend));
-					}
-
-					if(elf32_segments == ELF32_SEGELF && !rel.var.segment_of && (rel.size == 2 || rel.size == 4))
-					{
-						fwrite32(output.file, rel.offset);
-						uint32_t info = (segsym << 8) | (rel.size != 4 ? R_386_SUB16 : R_386_SUB32);
-						fwrite32(output.file, info);
-					}
-				}
-				else
-				{
-					// offset
-					fwrite64(output.file, rel.offset);
-					// info
-					uint64_t info = ((uint64_t)sym << 32) | elf_get_relocation_type(rel);
-					fwrite64(output.file, info);
-					// addend
-					if(elf_backend_uses_rela())
-					{
-						fwrite64(output.file, uint_get(rel.addend));
-					}
-				}
-			}
-			break;
-		}
-	}
-
-	fseek(output.file, section_data_offset, SEEK_SET);
+	image_seek(image, section_data_offset);
 
 	// null section
 	if(output.format != FORMAT_ELF64)
 	{
-		fwrite(zeroes, 40, 1, output.file);
+		image_write(image, zeroes, 40);
 	}
 	else
 	{
-		fwrite(zeroes, 64, 1, output.file);
+		image_write(image, zeroes, 64);
 	}
 	// remaining sections
 	for(size_t index = 1; index < elffile->section_count; index++)
 	{
 		// name
-		fwrite32(output.file, elffile->sections[index]->elf_string_offset);
+		image_write32(image, elffile->sections[index]->elf_string_offset);
 		// type
 		uint32_t sh_type;
-		if((elffile->sections[index]->flags & SHF_STRTAB) != 0)
+		if(elffile->sections[index]->format == SECTION_GROUP)
+		{
+			sh_type = SHT_GROUP;
+		}
+		else if((elffile->sections[index]->flags & SHF_STRTAB) != 0)
 		{
 			sh_type = SHT_STRTAB;
 		}
@@ -719,34 +820,35 @@ void elf_generate(void)
 		{
 			sh_type = SHT_NOTE; // TODO
 		}
-		fwrite32(output.file, sh_type);
+		image_write32(image, sh_type);
 		if(output.format != FORMAT_ELF64)
 		{
 			// flags
-			fwrite32(output.file, elffile->sections[index]->flags & SHF_ELF_BITS);
+			image_write32(image, elffile->sections[index]->flags & SHF_ELF_BITS);
 			// addr
-			fwrite32(output.file, 0);
+			image_write32(image, 0);
 			// offset
-			fwrite32(output.file, elffile->sections[index]->file_offset);
+			image_write32(image, elffile->sections[index]->file_offset);
 			// size
-			fwrite32(output.file, elf_section_get_size(elffile->sections[index]));
+			image_write32(image, elf_section_get_size(elffile->sections[index]));
 		}
 		else
 		{
 			// flags
-			fwrite64(output.file, elffile->sections[index]->flags & SHF_ELF_BITS);
+			image_write64(image, elffile->sections[index]->flags & SHF_ELF_BITS);
 			// addr
-			fwrite64(output.file, 0);
+			image_write64(image, 0);
 			// offset
-			fwrite64(output.file, elffile->sections[index]->file_offset);
+			image_write64(image, elffile->sections[index]->file_offset);
 			// size
-			fwrite64(output.file, elf_section_get_size(elffile->sections[index]));
+			image_write64(image, elf_section_get_size(elffile->sections[index]));
 		}
 		uint32_t link = 0, info = 0, entsize = 0;
 		switch(elffile->sections[index]->format)
 		{
 		case SECTION_DATA:
 		case SECTION_ZERO_DATA:
+			entsize = elffile->sections[index]->entsize;
 			break;
 		case SECTION_STRTAB:
 			break;
@@ -760,25 +862,37 @@ void elf_generate(void)
 			info = index - 1; // section to which it applies, which precedes the reloc section
 			entsize = (elf_backend_uses_rela() ? 3 : 2) * (output.format != FORMAT_ELF64 ? 4 : 8);
 			break;
+		case SECTION_GROUP:
+			{
+				// the group is identified by the name of its signature symbol
+				size_t section_index = elffile->sections[index]->group.section_index;
+				definition_t * signature = section_get_comdat_symbol(section_index);
+				link = symtab;
+				info = signature != NULL ? signature->elf_symbol_index : output.section[section_index]->elf_symbol_index;
+				entsize = 4;
+			}
+			break;
 		}
 		// link
-		fwrite32(output.file, link);
+		image_write32(image, link);
 		// info
-		fwrite32(output.file, info);
+		image_write32(image, info);
 		if(output.format != FORMAT_ELF64)
 		{
 			// addralign
-			fwrite32(output.file, elffile->sections[index]->align);
+			image_write32(image, elffile->sections[index]->align);
 			// entsize
-			fwrite32(output.file, entsize);
+			image_write32(image, entsize);
 		}
 		else
 		{
 			// addralign
-			fwrite64(output.file, elffile->sections[index]->align);
+			image_write64(image, elffile->sections[index]->align);
 			// entsize
-			fwrite64(output.file, entsize);
+			image_write64(image, entsize);
 		}
 	}
+
+	image_commit(image, output.file);
 }
 
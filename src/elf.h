@@ -4,6 +4,9 @@
 #define SHF_WRITE 0x001
 #define SHF_ALLOC 0x002
 #define SHF_EXECINSTR 0x004
+#define SHF_MERGE 0x010
+#define SHF_STRINGS 0x020
+#define SHF_GROUP 0x200
 #define SHF_ELF_BITS 0xFFFFFFFF
 // not actual ELF bit
 #define SHF_READ 0x100000000L
@@ -26,6 +29,9 @@
 #define SHT_NOTE 7
 #define SHT_NOBITS 8
 #define SHT_REL 9
+#define SHT_GROUP 17
+
+#define GRP_COMDAT 1
 
 #define SHN_UNDEF 0
 #define SHN_ABS 0xFFF1
@@ -130,6 +136,8 @@ typedef enum elf32_segments_t
 
 extern elf32_segments_t elf32_segments;
 
+// checks the constraints on section contents before the output is generated
+bool elf_check_sections(void);
 void elf_generate(void);
 
 #endif // _ELF_H
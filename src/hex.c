@@ -2,63 +2,121 @@
 #include <stdint.h>
 #include <stdio.h>
 #include "asm.h"
+#include "hex.h"
+
+size_t intel_hex_record_length = 16;
 
 struct
 {
-	uint8_t length;
+	size_t length;
 	uint32_t address;
-	uint8_t data[256];
+	uint8_t data[255];
 	uint16_t high_address;
+	bool out_of_range;
+	// formatted records are collected here before getting written out
+	size_t text_length;
+	char text[0x10000];
 } intel_hex =
 {
 	.length = 0,
 	.address = 0,
 	.high_address = 0,
+	.out_of_range = false,
+	.text_length = 0,
 };
 
+static const char hex_digits[16] = "0123456789ABCDEF";
+
+static void intel_hex_flush_text(void)
+{
+	fwrite(intel_hex.text, 1, intel_hex.text_length, output.file);
+	intel_hex.text_length = 0;
+}
+
+static inline void intel_hex_put_text(uint8_t value)
+{
+	intel_hex.text[intel_hex.text_length++] = hex_digits[value >> 4];
+	intel_hex.text[intel_hex.text_length++] = hex_digits[value & 0xF];
+}
+
+static void intel_hex_put_record(uint8_t type, uint16_t address, size_t length, const uint8_t * data)
+{
+	// ':', length, address, type, data, checksum, newline
+	if(intel_hex.text_length + 1 + 2 * (4 + length + 1) + 1 > sizeof intel_hex.text)
+		intel_hex_flush_text();
+
+	uint8_t checksum = length + (address >> 8) + address + type;
+	intel_hex.text[intel_hex.text_length++] = ':';
+	intel_hex_put_text(length);
+	intel_hex_put_text(address >> 8);
+	intel_hex_put_text(address);
+	intel_hex_put_text(type);
+	for(size_t i = 0; i < length; i++)
+	{
+		intel_hex_put_text(data[i]);
+		checksum += data[i];
+	}
+	intel_hex_put_text(-checksum);
+	intel_hex.text[intel_hex.text_length++] = '\n';
+}
+
+static void intel_hex_put_high_address(uint8_t type, uint16_t high_address)
+{
+	uint8_t data[2] = { high_address >> 8, high_address };
+	intel_hex_put_record(type, 0, 2, data);
+}
+
 static void intel_hex_flush(void)
 {
-	if(intel_hex.length > 0)
+	for(size_t start = 0; start < intel_hex.length; )
 	{
-		uint16_t address = 0;
+		uint32_t address = intel_hex.address + start;
+		uint16_t high_address;
+		uint32_t offset;
+		size_t count = intel_hex.length - start;
+
 		switch(output.format)
 		{
 		case FORMAT_HEX16:
-			// TODO: addresses beyond 0x100000?
-			if(intel_hex.high_address != (intel_hex.address >> 4))
+			// segments are placed on 64 KiB boundaries, the top segment reaches 0x10FFEF
+			high_address = address < 0x100000 ? (address >> 4) & 0xF000 : 0xFFFF;
+			offset = address - ((uint32_t)high_address << 4);
+			if(offset > 0xFFFF)
 			{
-				intel_hex.high_address = intel_hex.address >> 4;
-				uint8_t checksum = -(2 + 2 + intel_hex.high_address + (intel_hex.high_address >> 8));
-				fprintf(output.file, ":02000002%04X%02X\n", intel_hex.high_address, checksum);
+				if(!intel_hex.out_of_range)
+					fprintf(stderr, "Error: address 0x%X beyond the range of 16-bit Intel HEX, use hex32\n", address);
+				intel_hex.out_of_range = true;
+				intel_hex.length = 0;
+				return;
+			}
+			if(high_address != intel_hex.high_address)
+			{
+				intel_hex.high_address = high_address;
+				intel_hex_put_high_address(0x02, high_address); // extended segment address
 			}
-			address = intel_hex.address - (intel_hex.high_address << 4);
 			break;
 		case FORMAT_HEX32:
-			if(intel_hex.high_address != (intel_hex.address >> 16))
+			high_address = address >> 16;
+			offset = address & 0xFFFF;
+			if(high_address != intel_hex.high_address)
 			{
-				intel_hex.high_address = intel_hex.address >> 16;
-				uint8_t checksum = -(4 + 2 + intel_hex.high_address + (intel_hex.high_address >> 8));
-				fprintf(output.file, ":04000002%04X%02X\n", intel_hex.high_address, checksum);
+				intel_hex.high_address = high_address;
+				intel_hex_put_high_address(0x04, high_address); // extended linear address
 			}
-			address = intel_hex.address;
 			break;
 		default:
-			break;
+			assert(false);
 		}
 
-		uint8_t checksum = 0;
-		fprintf(output.file, ":%02X%04X00", intel_hex.length, address & 0xFFFF);
-		for(size_t i = 0; i < intel_hex.length; i++)
-		{
-			fprintf(output.file, "%02X", intel_hex.data[i]);
-			checksum += intel_hex.data[i];
-		}
-		checksum += intel_hex.length + address + (address >> 8);
-		checksum = -checksum;
-		fprintf(output.file, "%02X\n", checksum);
+		// a record may not wrap around the end of the 64 KiB window
+		if(count > 0x10000 - offset)
+			count = 0x10000 - offset;
 
-		intel_hex.length = 0;
+		intel_hex_put_record(0x00, offset, count, intel_hex.data + start);
+		start += count;
 	}
+
+	intel_hex.length = 0;
 }
 
 void intel_hex_set_location(uint32_t address)
@@ -73,8 +131,11 @@ void intel_hex_set_location(uint32_t address)
 void intel_hex_output_byte(uint8_t value)
 {
 	intel_hex.data[intel_hex.length++] = value;
-	if(intel_hex.length == 256)
+	if(intel_hex.length >= intel_hex_record_length)
+	{
 		intel_hex_flush();
+		intel_hex.address += intel_hex_record_length;
+	}
 }
 
 void intel_hex_skip(uint32_t count)
@@ -82,9 +143,11 @@ void intel_hex_skip(uint32_t count)
 	output_set_location(intel_hex.address + intel_hex.length + count);
 }
 
-void intel_hex_close(void)
+// returns false if some data could not be represented in the format
+bool intel_hex_close(void)
 {
 	intel_hex_flush();
-	fprintf(output.file, ":00000001FF\n");
+	intel_hex_put_record(0x01, 0, 0, NULL);
+	intel_hex_flush_text();
+	return !intel_hex.out_of_range;
 }
-
@@ -212,6 +212,15 @@ static inline size_t uint_print_hex(FILE * output, uinteger_t v)
 #endif
 }
 
+static inline size_t int_print_dec(FILE * output, integer_t v)
+{
+#if USE_GMP
+	return mpz_out_str(output, 10, v);
+#else
+	return fprintf(output, "%ld", v);
+#endif
+}
+
 static inline void uint_parse(integer_value_t * j, const char * text, int base)
 {
 #if USE_GMP
@@ -3,39 +3,51 @@
 #include "asm.h"
 #include "omf.h"
 #include "elf.h"
+#include "isa.h"
 
 #define entry_point_name (entry_point_name == NULL ? "..start" : entry_point_name)
 
+// records are assembled in memory so that the length and checksum are filled in before the record gets written
+// the 16-bit length field counts the checksum byte as well, which leaves one byte less for the body
+#define OMF_MAX_BODY_SIZE 0xFFFE
+static uint8_t current_record[3 + OMF_MAX_BODY_SIZE + 1];
 uint8_t current_record_type = 0;
-long current_record_start;
 uint16_t current_record_size;
 uint8_t current_record_checksum;
+static bool omf_failed; // a record overflowed, the output is unusable
 
 static void omf_begin_record(uint8_t type)
 {
 	current_record_type = type;
-	current_record_start = ftell(output.file);
-	fwrite8(output.file, type);
+	current_record[0] = type;
 	current_record_size = 0;
-	fwrite16le(output.file, current_record_size);
 	current_record_checksum = 0;
 }
 
 static void omf_putbyte(uint8_t byte)
 {
-	fwrite8(output.file, byte);
+	if(current_record_size == OMF_MAX_BODY_SIZE)
+	{
+		if(!omf_failed)
+			fprintf(stderr, "Error: OMF record too long\n");
+		omf_failed = true;
+		return;
+	}
+	current_record[3 + current_record_size] = byte;
 	current_record_size ++;
 	current_record_checksum -= byte;
 }
 
 static void omf_end_record(void)
 {
+	// the length includes the checksum byte, the checksum covers the entire record
+	uint16_t length = current_record_size + 1;
+	current_record[1] = length;
+	current_record[2] = length >> 8;
+	current_record_checksum -= current_record[0] + current_record[1] + current_record[2];
+	current_record[3 + current_record_size] = current_record_checksum;
+	fwrite(current_record, 1, 3 + current_record_size + 1, output.file);
 	current_record_type = 0;
-	omf_putbyte(current_record_checksum);
-	long end = ftell(output.file);
-	fseek(output.file, current_record_start + 1, SEEK_SET);
-	fwrite16le(output.file, current_record_size);
-	fseek(output.file, end, SEEK_SET);
 }
 
 static void omf_putword(uint16_t word)
@@ -107,6 +119,61 @@ static void omf_putindex(uint16_t value)
 
 #define MAX(a, b) ((a) >= (b) ? (a) : (b))
 
+// maximum number of data bytes in an LEDATA record
+#define OMF_LEDATA_MAX 1024
+
+// FIXUPP threads let a frame or target specification be given once and referred to by its number later on
+typedef struct omf_thread_t
+{
+	uint8_t method; // 0xFF if unused
+	uint16_t index;
+	size_t last_use;
+} omf_thread_t;
+
+static omf_thread_t omf_frame_threads[4];
+static omf_thread_t omf_target_threads[4];
+static size_t omf_thread_clock;
+
+static void omf_reset_threads(void)
+{
+	for(int thread = 0; thread < 4; thread++)
+	{
+		omf_frame_threads[thread] = (omf_thread_t) { .method = 0xFF };
+		omf_target_threads[thread] = (omf_thread_t) { .method = 0xFF };
+	}
+	omf_thread_clock = 0;
+}
+
+// returns the number of the thread holding the method and index, or -1 if it should be given explicitly
+// a new thread is only defined (replacing the least recently used one) if the pair is going to be used again
+static int omf_use_thread(bool frame, uint8_t method, uint16_t index, bool used_again)
+{
+	omf_thread_t * threads = frame ? omf_frame_threads : omf_target_threads;
+	int oldest = 0;
+	for(int thread = 0; thread < 4; thread++)
+	{
+		if(threads[thread].method == method && threads[thread].index == index)
+		{
+			threads[thread].last_use = ++omf_thread_clock;
+			return thread;
+		}
+		if(threads[thread].last_use < threads[oldest].last_use)
+			oldest = thread;
+	}
+
+	if(!used_again)
+		return -1;
+
+	threads[oldest].method = method;
+	threads[oldest].index = index;
+	threads[oldest].last_use = ++omf_thread_clock;
+
+	// THREAD subrecord
+	omf_putbyte((frame ? 0x40 : 0x00) | (method << 2) | oldest);
+	omf_putindex(index);
+	return oldest;
+}
+
 void omf80_generate(const char * module_name)
 {
 	// common symbols have to be allocated their own segments
@@ -370,6 +437,450 @@ void omf80_generate(const char * module_name)
 	omf_end_record();
 }
 
+// number of times each segment and external is referenced by a fixup, to decide which ones are worth a thread
+static size_t * omf_segment_frame_uses;
+static size_t * omf_segment_target_uses;
+static size_t * omf_external_target_uses;
+
+// a relocation free stretch of a block that consists of a repeated pattern, stored as iterated data
+typedef struct omf_run_t
+{
+	uint32_t offset; // within the block
+	uint32_t period;
+	uint32_t count;
+} omf_run_t;
+
+// repetitions of the current block that can be used for iterated data, sorted by offset
+static omf_run_t * omf_runs;
+static size_t omf_run_count;
+static size_t omf_next_run; // runs before this one have been passed already
+
+// iterated data costs an LIDATA record header and splits the surrounding LEDATA record in two
+#define OMF_LIDATA_OVERHEAD 16
+// zero bytes shorter than this are not worth an LIDATA record
+#define OMF_ZERO_RUN_MIN 32
+
+// returns the first relocation in the section that ends after the address
+static size_t omf_find_relocation(section_t * relocations, uint64_t address)
+{
+	size_t low = 0, high = relocations->reloc.count;
+	while(low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+		relocation_t * relocation = &relocations->reloc.relocations[middle];
+		if(relocation->offset + relocation->size / ARCH_BITS_IN_UNIT <= address)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low;
+}
+
+static bool omf_has_relocation(section_t * relocations, uint64_t start, uint64_t end)
+{
+	size_t relocation_index = omf_find_relocation(relocations, start);
+	return relocation_index < relocations->reloc.count && relocations->reloc.relocations[relocation_index].offset < end;
+}
+
+static int omf_compare_runs(const void * a, const void * b)
+{
+	const omf_run_t * run1 = a;
+	const omf_run_t * run2 = b;
+	if(run1->offset != run2->offset)
+		return run1->offset < run2->offset ? -1 : 1;
+	// enclosing runs come first
+	uint32_t size1 = run1->period * run1->count;
+	uint32_t size2 = run2->period * run2->count;
+	return size1 > size2 ? -1 : size1 < size2 ? 1 : 0;
+}
+
+// collects the repetitions recorded during generation that lie within the block and really are repeated, relocation free data
+static void omf86_collect_runs(section_t * section, block_t * block)
+{
+	omf_runs = malloc((section->data.repetition_count + 1) * sizeof(omf_run_t));
+	omf_run_count = 0;
+	omf_next_run = 0;
+
+	for(size_t repetition_index = 0; repetition_index < section->data.repetition_count; repetition_index++)
+	{
+		repetition_t * repetition = &section->data.repetitions[repetition_index];
+		if(repetition->offset < block->address || repetition->offset + repetition->size > block->address + block->size)
+			continue;
+
+		omf_run_t run;
+		run.offset = repetition->offset - block->address;
+		run.period = repetition->period;
+		run.count = repetition->size / repetition->period;
+		if(run.count < 2)
+			continue;
+
+		// the contents might have changed between iterations, for example if they refer to the current address
+		if(memcmp(block->buffer + run.offset + run.period, block->buffer + run.offset, run.period * (run.count - 1)) != 0)
+			continue;
+
+		if(omf_has_relocation(section->data.relocations, repetition->offset, repetition->offset + run.period * run.count))
+			continue;
+
+		omf_runs[omf_run_count++] = run;
+	}
+
+	qsort(omf_runs, omf_run_count, sizeof(omf_run_t), omf_compare_runs);
+}
+
+static size_t omf86_put_iterated_range(block_t * block, uint32_t start, uint32_t end, bool wide, bool emit, size_t * item_count);
+
+// a single iterated data block, the contents may contain further nested blocks
+static size_t omf86_put_iterated_block(block_t * block, const omf_run_t * run, bool wide, bool emit)
+{
+	size_t size = (wide ? 4 : 2) + 2;
+	size_t item_count;
+	size_t content_size = omf86_put_iterated_range(block, run->offset, run->offset + run->period, wide, false, &item_count);
+
+	if(item_count == 1 && content_size == size + 1 + run->period)
+	{
+		// a single literal, no nested blocks needed
+		if(emit)
+		{
+			omf_putoffset(run->count);
+			omf_putword(0);
+			omf_putbyte(run->period);
+			for(uint32_t i = 0; i < run->period; i++)
+				omf_putbyte(block->buffer[run->offset + i]);
+		}
+		return size + 1 + run->period;
+	}
+
+	if(emit)
+	{
+		omf_putoffset(run->count);
+		omf_putword(item_count);
+		omf86_put_iterated_range(block, run->offset, run->offset + run->period, wide, true, &item_count);
+	}
+	return size + content_size;
+}
+
+// the contents of a range as a sequence of iterated data blocks, using the repetitions that fit inside
+static size_t omf86_put_iterated_range(block_t * block, uint32_t start, uint32_t end, bool wide, bool emit, size_t * item_count)
+{
+	size_t size = 0;
+	size_t run_index = 0;
+	*item_count = 0;
+
+	for(uint32_t offset = start; offset < end; )
+	{
+		const omf_run_t * next = NULL;
+		for(; run_index < omf_run_count && omf_runs[run_index].offset < offset; run_index++)
+			;
+		for(size_t index = run_index; index < omf_run_count && omf_runs[index].offset < end; index++)
+		{
+			if(omf_runs[index].offset + omf_runs[index].period * omf_runs[index].count <= end && omf_runs[index].count <= 0xFFFF)
+			{
+				next = &omf_runs[index];
+				break;
+			}
+		}
+
+		uint32_t literal_end = next != NULL ? next->offset : end;
+		if(offset < literal_end)
+		{
+			uint32_t count = literal_end - offset;
+			if(count > 255)
+				count = 255;
+			if(emit)
+			{
+				omf_putoffset(1);
+				omf_putword(0);
+				omf_putbyte(count);
+				for(uint32_t i = 0; i < count; i++)
+					omf_putbyte(block->buffer[offset + i]);
+			}
+			size += (wide ? 4 : 2) + 2 + 1 + count;
+			offset += count;
+		}
+		else
+		{
+			size += omf86_put_iterated_block(block, next, wide, emit);
+			offset = next->offset + next->period * next->count;
+		}
+		(*item_count)++;
+	}
+
+	return size;
+}
+
+// the encoded size of a run if it were to be stored as iterated data, with repeat counts up to 0xFFFF per block
+static size_t omf86_get_run_size(block_t * block, const omf_run_t * run, bool wide)
+{
+	omf_run_t chunk = *run;
+	if(chunk.count > 0xFFFF)
+		chunk.count = 0xFFFF;
+	return omf86_put_iterated_block(block, &chunk, wide, false);
+}
+
+static bool omf86_run_is_worth_it(block_t * block, const omf_run_t * run)
+{
+	bool wide = block->address + run->offset >= 0x10000;
+	size_t block_size = omf86_get_run_size(block, run, wide);
+	if(block_size > OMF_LEDATA_MAX)
+		return false;
+	size_t block_count = (run->count + 0xFFFE) / 0xFFFF;
+	return block_count * block_size + OMF_LIDATA_OVERHEAD < (size_t)run->period * run->count;
+}
+
+// finds the next run of iterated data at or after the offset, either a recorded repetition or a run of zeroes
+static bool omf86_find_run(section_t * section, block_t * block, uint32_t offset, omf_run_t * result)
+{
+	const omf_run_t * next = NULL;
+	for(; omf_next_run < omf_run_count; omf_next_run++)
+	{
+		if(omf_runs[omf_next_run].offset >= offset && omf86_run_is_worth_it(block, &omf_runs[omf_next_run]))
+		{
+			next = &omf_runs[omf_next_run];
+			break;
+		}
+	}
+
+	uint32_t end = next != NULL ? next->offset : block->size;
+	size_t relocation_index = omf_find_relocation(section->data.relocations, block->address + offset);
+	for(uint32_t start = offset; start < end; )
+	{
+		if(block->buffer[start] != 0)
+		{
+			start++;
+			continue;
+		}
+
+		uint32_t stop = start;
+		while(stop < end && block->buffer[stop] == 0)
+			stop++;
+
+		// zero bytes belonging to relocations must be stored in LEDATA records
+		while(relocation_index < section->data.relocations->reloc.count
+		&& section->data.relocations->reloc.relocations[relocation_index].offset + section->data.relocations->reloc.relocations[relocation_index].size / ARCH_BITS_IN_UNIT <= block->address + start)
+			relocation_index++;
+		if(relocation_index < section->data.relocations->reloc.count
+		&& section->data.relocations->reloc.relocations[relocation_index].offset < block->address + stop)
+		{
+			relocation_t * relocation = &section->data.relocations->reloc.relocations[relocation_index];
+			if(relocation->offset > block->address + start)
+			{
+				stop = relocation->offset - block->address;
+			}
+			else
+			{
+				start = relocation->offset + relocation->size / ARCH_BITS_IN_UNIT - block->address;
+				continue;
+			}
+		}
+
+		if(stop - start >= OMF_ZERO_RUN_MIN)
+		{
+			result->offset = start;
+			result->period = 1;
+			result->count = stop - start;
+			return true;
+		}
+
+		start = stop;
+	}
+
+	if(next != NULL)
+	{
+		*result = *next;
+		return true;
+	}
+	return false;
+}
+
+// emits a run as LIDATA records, repeat counts above 0xFFFF are split across several blocks
+static void omf86_put_lidata(section_t * section, block_t * block, const omf_run_t * run)
+{
+	bool started = false;
+	size_t record_size = 0;
+	omf_run_t chunk = *run;
+
+	for(uint32_t remaining = run->count; remaining > 0; remaining -= chunk.count)
+	{
+		chunk.count = remaining > 0xFFFF ? 0xFFFF : remaining;
+		uint64_t address = block->address + run->offset + (uint64_t)(run->count - remaining) * run->period;
+
+		size_t size = started ? omf86_put_iterated_block(block, &chunk, (current_record_type & 1) != 0, false) : 0;
+		if(!started || record_size + size > OMF_LEDATA_MAX)
+		{
+			if(started)
+				omf_end_record();
+			omf_begin_record(address < 0x10000 ? OMF_LIDATA16 : OMF_LIDATA32);
+			omf_putindex(section->elf_symbol_index);
+			omf_putoffset(address);
+			started = true;
+			record_size = 0;
+		}
+
+		record_size += omf86_put_iterated_block(block, &chunk, (current_record_type & 1) != 0, true);
+	}
+
+	omf_end_record();
+}
+
+// emits the data from start to end of a block as LEDATA records, each followed by the fixups within it
+static void omf86_put_ledata(section_t * section, block_t * block, uint32_t start, uint32_t end, size_t * next_relocation)
+{
+	section_t * relocations = section->data.relocations;
+	size_t relocation_index = *next_relocation;
+
+	for(uint32_t offset = start; offset < end; )
+	{
+		uint32_t count = end - offset;
+		if(count > OMF_LEDATA_MAX)
+			count = OMF_LEDATA_MAX;
+
+		// a fixup may not extend into the following record, end the record before it instead
+		for(size_t next_index = relocation_index; next_index < relocations->reloc.count
+			&& relocations->reloc.relocations[next_index].offset < block->address + offset + count;
+			next_index++)
+		{
+			relocation_t * relocation = &relocations->reloc.relocations[next_index];
+			if(relocation->offset + relocation->size / ARCH_BITS_IN_UNIT > block->address + offset + count
+			&& relocation->offset > block->address + offset)
+			{
+				count = relocation->offset - (block->address + offset);
+				break;
+			}
+		}
+
+		if(block->address + offset < 0x10000)
+		{
+			omf_begin_record(OMF_LEDATA16);
+		}
+		else
+		{
+			omf_begin_record(OMF_LEDATA32);
+		}
+		omf_putindex(section->elf_symbol_index);
+		omf_putoffset(block->address + offset);
+		for(uint32_t i = 0; i < count; i++)
+		{
+			omf_putbyte(block->buffer[offset + i]);
+		}
+		omf_end_record();
+
+		bool fixups_started = false;
+
+		for(; relocation_index < relocations->reloc.count
+			&& relocations->reloc.relocations[relocation_index].offset < block->address + block->size
+			&& relocations->reloc.relocations[relocation_index].offset < block->address + offset + count;
+			relocation_index++)
+		{
+			relocation_t relocation = relocations->reloc.relocations[relocation_index];
+
+			if(!fixups_started)
+			{
+				omf_begin_record(OMF_FIXUPP16); // TODO: OMF_FIXUPP32?
+				fixups_started = true;
+			}
+
+			uint16_t word = 0x8000;
+			word |= relocation.offset - (block->address + offset);
+
+			switch(relocation.size)
+			{
+			case BITSIZE8:
+				break;
+			case BITSIZE16:
+				if(relocation.var.segment_of)
+					word |= 0x0800;
+				else
+					word |= 0x0400;
+				break;
+			case BITSIZE32:
+				word |= 0x2400;
+				break;
+			default:
+				break;
+			}
+
+			if(!relocation.pc_relative)
+				word |= 0x4000;
+
+			uint8_t data = 0;
+			uint16_t frame;
+			if(relocation.wrt_section == WRT_DEFAULT)
+			{
+				frame = -1;
+				data |= 0x50;
+			}
+			else if(relocation.wrt_section == WRT_NONE)
+			{
+				// 8089 self-relative
+				frame = -1;
+				data |= 0x60;
+			}
+			else
+			{
+				frame = output.section[relocation.wrt_section]->elf_symbol_index;
+				data |= 0x00;
+				int thread = omf_use_thread(true, 0, frame, --omf_segment_frame_uses[frame] > 0);
+				if(thread != -1)
+				{
+					// F bit, frame thread
+					frame = -1;
+					data |= 0x80 | (thread << 4);
+				}
+			}
+			uint16_t target;
+			if(relocation.var.type == VAR_SECTION)
+			{
+				// SEGDEF
+				target = output.section[relocation.var.internal.section_index]->elf_symbol_index;
+				data |= 0x04;
+				int thread = omf_use_thread(false, 0, target, --omf_segment_target_uses[target] > 0);
+				if(thread != -1)
+				{
+					// T bit, target thread, the P bit (no displacement) is kept
+					target = -1;
+					data = (data & ~0x03) | 0x08 | thread;
+				}
+			}
+			else if(relocation.var.type == VAR_DEFINE)
+			{
+				// EXTDEF
+				target = relocation.var.external->elf_symbol_index;
+				data |= 0x06;
+				int thread = omf_use_thread(false, 2, target, --omf_external_target_uses[target] > 0);
+				if(thread != -1)
+				{
+					target = -1;
+					data = (data & ~0x03) | 0x08 | thread;
+				}
+			}
+			else
+			{
+				fprintf(stderr, "Absolute addresses not supported\n");
+				// TODO: probably not a real relocation
+			}
+
+			// big endian word, any THREAD subrecords needed have been emitted before it
+			omf_putbyte(word >> 8);
+			omf_putbyte(word);
+
+			omf_putbyte(data);
+			if(frame != (uint16_t)-1)
+				omf_putindex(frame);
+			if(target != (uint16_t)-1)
+				omf_putindex(target); // TODO
+		}
+
+		if(fixups_started)
+		{
+			omf_end_record();
+		}
+
+		offset += count;
+	}
+
+	*next_relocation = relocation_index;
+}
+
 void omf86_generate(const char * module_name)
 {
 	omf_begin_record(OMF_THEADR);
@@ -589,12 +1100,36 @@ void omf86_generate(const char * module_name)
 		}
 	}
 
+	// count how many times each segment and external is referenced, to decide which ones are worth a thread
+	omf_segment_frame_uses = calloc(segment_index + 1, sizeof(size_t));
+	omf_segment_target_uses = calloc(segment_index + 1, sizeof(size_t));
+	omf_external_target_uses = calloc(external_index + 1, sizeof(size_t));
+
 	for(size_t section_index = 0; section_index < output.section_count; section_index++)
 	{
 		if(output.section[section_index]->format != SECTION_DATA)
 			continue;
 
 		section_t * relocations = output.section[section_index]->data.relocations;
+		for(size_t relocation_index = 0; relocation_index < relocations->reloc.count; relocation_index++)
+		{
+			relocation_t * relocation = &relocations->reloc.relocations[relocation_index];
+			if(relocation->wrt_section != WRT_DEFAULT && relocation->wrt_section != WRT_NONE)
+				omf_segment_frame_uses[output.section[relocation->wrt_section]->elf_symbol_index] ++;
+			if(relocation->var.type == VAR_SECTION)
+				omf_segment_target_uses[output.section[relocation->var.internal.section_index]->elf_symbol_index] ++;
+			else if(relocation->var.type == VAR_DEFINE)
+				omf_external_target_uses[relocation->var.external->elf_symbol_index] ++;
+		}
+	}
+
+	omf_reset_threads();
+
+	for(size_t section_index = 0; section_index < output.section_count; section_index++)
+	{
+		if(output.section[section_index]->format != SECTION_DATA)
+			continue;
+
 		size_t relocation_index = 0;
 
 		for(
@@ -603,119 +1138,37 @@ void omf86_generate(const char * module_name)
 			current = current->next
 		)
 		{
-			//for(uint32_t offset = 0; offset < output.section[section_index]->data.full_size; offset += 1024)
-			for(uint32_t offset = 0; offset < current->size; offset += 1024)
+			omf86_collect_runs(output.section[section_index], current);
+
+			uint32_t offset = 0;
+			while(offset < current->size)
 			{
-				// TODO: make sure relocations do not get cut up into two LEDATA records
-				if(current->address + offset < 0x10000)
+				omf_run_t run;
+				bool found = omf86_find_run(output.section[section_index], current, offset, &run);
+				uint32_t data_end = found ? run.offset : current->size;
+				if(offset < data_end)
+					omf86_put_ledata(output.section[section_index], current, offset, data_end, &relocation_index);
+				if(found)
 				{
-					omf_begin_record(OMF_LEDATA16);
+					omf86_put_lidata(output.section[section_index], current, &run);
+					offset = run.offset + run.period * run.count;
 				}
 				else
 				{
-					omf_begin_record(OMF_LEDATA32);
-				}
-				omf_putindex(output.section[section_index]->elf_symbol_index);
-				omf_putoffset(current->address + offset);
-				//for(uint16_t i = 0; i < 1024 && offset + i < output.section[section_index]->data.full_size; i++)
-				for(uint16_t i = 0; i < 1024 && offset + i < current->size; i++)
-				{
-					omf_putbyte(current->buffer[offset + i]);
-				}
-				omf_end_record();
-
-				bool fixups_started = false;
-
-				for(; relocation_index < relocations->reloc.count
-					&& relocations->reloc.relocations[relocation_index].offset < current->address + current->size
-					&& relocations->reloc.relocations[relocation_index].offset < current->address + offset + 1024;
-					relocation_index++)
-				{
-					relocation_t relocation = relocations->reloc.relocations[relocation_index];
-
-					if(!fixups_started)
-					{
-						omf_begin_record(OMF_FIXUPP16); // TODO: OMF_FIXUPP32?
-						fixups_started = true;
-					}
-
-					uint16_t word = 0x8000;
-					word |= relocation.offset - (current->address + offset);
-
-					switch(relocation.size)
-					{
-					case 1:
-						break;
-					case 2:
-						if(relocation.var.segment_of)
-							word |= 0x0800;
-						else
-							word |= 0x0400;
-						break;
-					case 4:
-						word |= 0x2400;
-						break;
-					}
-
-					if(!relocation.pc_relative)
-						word |= 0x4000;
-
-					// big endian word
-					omf_putbyte(word >> 8);
-					omf_putbyte(word);
-
-					uint8_t data = 0;
-					uint16_t frame;
-					if(relocation.wrt_section == WRT_DEFAULT)
-					{
-						frame = -1;
-						data |= 0x50;
-					}
-					else if(relocation.wrt_section == WRT_NONE)
-					{
-						// 8089 self-relative
-						frame = -1;
-						data |= 0x60;
-					}
-					else
-					{
-						frame = output.section[relocation.wrt_section]->elf_symbol_index;
-						data |= 0x00;
-					}
-					uint16_t target;
-					if(relocation.var.type == VAR_SECTION)
-					{
-						// SEGDEF
-						target = output.section[relocation.var.internal.section_index]->elf_symbol_index;
-						data |= 0x04;
-					}
-					else if(relocation.var.type == VAR_DEFINE)
-					{
-						// EXTDEF
-						target = relocation.var.external->elf_symbol_index;
-						data |= 0x06;
-					}
-					else
-					{
-						fprintf(stderr, "Absolute addresses not supported\n");
-						// TODO: probably not a real relocation
-					}
-
-					omf_putbyte(data);
-					if(frame != (uint16_t)-1)
-						omf_putindex(frame);
-					if(target != (uint16_t)-1)
-						omf_putindex(target); // TODO
-				}
-
-				if(fixups_started)
-				{
-					omf_end_record();
+					offset = data_end;
 				}
 			}
+
+			free(omf_runs);
+			omf_runs = NULL;
+			omf_run_count = 0;
 		}
 	}
 
+	free(omf_segment_frame_uses);
+	free(omf_segment_target_uses);
+	free(omf_external_target_uses);
+
 	uint8_t mod_type = 0x80; // main not overlay
 	if(start_symbol != NULL)
 		mod_type |= 0x41;
@@ -746,8 +1199,9 @@ void omf86_generate(const char * module_name)
 	omf_end_record();
 }
 
-void omf_generate(const char * module_name)
+bool omf_generate(const char * module_name)
 {
+	omf_failed = false;
 	switch(output.format)
 	{
 	case FORMAT_OMF80:
@@ -759,5 +1213,6 @@ void omf_generate(const char * module_name)
 	default:
 		break;
 	}
+	return !omf_failed;
 }
 
@@ -29,6 +29,8 @@ typedef enum omf_record_t
 	OMF_FIXUPP32 = 0x9D,
 	OMF_LEDATA16 = 0xA0,
 	OMF_LEDATA32 = 0xA1,
+	OMF_LIDATA16 = 0xA2,
+	OMF_LIDATA32 = 0xA3,
 	OMF_COMDEF = 0xB0,
 } omf_record_t;
 
@@ -49,6 +51,7 @@ enum
 #define OMF_EXPDEF_RESIDENT_NAME 0x40
 #define OMF_EXPDEF_NODATA 0x20
 
-void omf_generate(const char * module_name);
+// returns false if the output could not be represented
+bool omf_generate(const char * module_name);
 
 #endif // _OMF_H
@@ -17,6 +17,9 @@ extern int yylex(void);
 void yyerror(const char * s);
 %}
 
+// the token names are used to identify the token numbering in precompiled token files
+%token-table
+
 %union
 {
 	long i;
@@ -49,7 +52,9 @@ void yyerror(const char * s);
 %token KWD_GLOBAL
 %token KWD_IF
 %token KWD_IMPORT
+%token KWD_INCLUDE
 %token KWD_MACRO
+%token KWD_ONCE
 %token KWD_ORG
 %token KWD_REPEAT
 %token KWD_SECTION
@@ -60,6 +65,8 @@ void yyerror(const char * s);
 %token <j> TOK_INTEGER TOK_LABEL_FORWARD TOK_LABEL_BACKWARD
 %token <s> TOK_STRING
 %token <macro> TOK_MACRONAME
+%token TOK_MACRO_PARAM /* only used inside macro bodies */
+%token TOK_REPEAT_COUNTER /* only used inside .repeat bodies */
 
 %token DEL_AND "&&"
 %token DEL_CMP "<=>"
@@ -237,15 +244,18 @@ directive
 			instruction_stream_append(current_instruction_stream, &current_instruction);
 			advance_line();
 		}
-	| KWD_REPEAT expression '\n'
+	| repeat_directive
+		{
+			parse_repeat_definition();
+		}
+		'\n'
 		{
-			/* TODO */
 			advance_line();
 		}
 	| KWD_ENDREPEAT '\n'
 		{
-			/* TODO */
-			advance_line();
+			yyerror("no matching .repeat found for .endrepeat");
+			YYABORT;
 		}
 	| KWD_FILL expression '\n'
 		{
@@ -367,6 +377,19 @@ directive
 		}
 	;
 
+repeat_directive
+	: KWD_REPEAT expression
+		{
+			if(!begin_repeat_definition($2, NULL))
+				YYABORT;
+		}
+	| KWD_REPEAT expression ',' TOK_IDENTIFIER
+		{
+			if(!begin_repeat_definition($2, $4))
+				YYABORT;
+		}
+	;
+
 macro_definition
 	: macro_definition_head
 	| macro_definition_arguments
@@ -864,8 +887,35 @@ expression_noparen
 
 %%
 
+// changes whenever tokens are added, removed or reordered in the grammar of the target
+uint64_t parser_get_token_fingerprint(void)
+{
+	// FNV-1a over the terminal names and the mapping of token numbers to them
+	uint64_t hash = 0xCBF29CE484222325;
+	for(int symbol = 0; symbol < YYNTOKENS; symbol++)
+	{
+		for(const char * name = yytname[symbol]; ; name++)
+		{
+			hash ^= (uint8_t)*name;
+			hash *= 0x100000001B3;
+			if(*name == '\0')
+				break;
+		}
+	}
+	for(size_t token = 0; token < sizeof yytranslate / sizeof yytranslate[0]; token++)
+	{
+		hash ^= yytranslate[token];
+		hash *= 0x100000001B3;
+	}
+	return hash;
+}
+
 void yyerror(const char * s)
 {
-	fprintf(stderr, "Error in line %ld: %s\n", current_parser_state->line_number, s);
+	const char * filename = preprocessor_get_current_filename();
+	if(filename != NULL)
+		fprintf(stderr, "Error in %s, line %ld: %s\n", filename, current_parser_state->line_number, s);
+	else
+		fprintf(stderr, "Error in line %ld: %s\n", current_parser_state->line_number, s);
 }
 
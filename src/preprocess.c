@@ -1,9 +1,20 @@
 
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "isa.h"
 #include "parser.h"
 
 extern int yylex_direct(void);
 
+// provided by the flex generated scanner
+struct yy_buffer_state * yy_create_buffer(FILE * file, int size);
+void yypush_buffer_state(struct yy_buffer_state * buffer);
+void yypop_buffer_state(void);
+
 typedef struct token_data_t
 {
 	int type;
@@ -47,17 +58,88 @@ struct macro_definition_t
 	char ** argument_names;
 	token_sequence_t definition;
 	macro_definition_t * next;
+	macro_definition_t * next_in_bucket;
+	size_t hash;
 };
 
 macro_definition_t * macros;
 
+// every identifier is looked up, so the macros are also kept in a hash table, later definitions come first in their bucket
+static macro_definition_t ** macro_buckets;
+static size_t macro_bucket_count;
+static size_t macro_count;
+
+static size_t macro_hash(const char * name)
+{
+	// FNV-1a
+	size_t hash = 0x811C9DC5;
+	for(; *name != '\0'; name++)
+	{
+		hash ^= (unsigned char)*name;
+		hash *= 0x01000193;
+	}
+	return hash;
+}
+
+static void macro_table_grow(void)
+{
+	size_t bucket_count = macro_bucket_count == 0 ? 64 : 2 * macro_bucket_count;
+	macro_definition_t ** buckets = malloc(bucket_count * sizeof(macro_definition_t *));
+	memset(buckets, 0, bucket_count * sizeof(macro_definition_t *));
+
+	// the list is ordered from latest to earliest, so inserting in reverse keeps the latest definitions in front
+	size_t count = 0;
+	for(macro_definition_t * macro = macros; macro != NULL; macro = macro->next)
+		count++;
+	macro_definition_t ** ordered = malloc((count + 1) * sizeof(macro_definition_t *));
+	count = 0;
+	for(macro_definition_t * macro = macros; macro != NULL; macro = macro->next)
+		ordered[count++] = macro;
+	while(count > 0)
+	{
+		macro_definition_t * macro = ordered[--count];
+		macro->next_in_bucket = buckets[macro->hash & (bucket_count - 1)];
+		buckets[macro->hash & (bucket_count - 1)] = macro;
+	}
+	free(ordered);
+
+	free(macro_buckets);
+	macro_buckets = buckets;
+	macro_bucket_count = bucket_count;
+}
+
+static macro_definition_t * macro_lookup(const char * name)
+{
+	if(macro_count == 0)
+		return NULL;
+	size_t hash = macro_hash(name);
+	for(macro_definition_t * macro = macro_buckets[hash & (macro_bucket_count - 1)]; macro != NULL; macro = macro->next_in_bucket)
+	{
+		if(macro->hash == hash && strcmp(macro->name, name) == 0)
+			return macro;
+	}
+	return NULL;
+}
+
 void begin_macro_definition(char * name)
 {
 	macro_definition_t * macro = malloc(sizeof(macro_definition_t));
 	memset(macro, 0, sizeof(macro_definition_t));
 	macro->name = name;
+	macro->hash = macro_hash(name);
 	macro->next = macros;
 	macros = macro;
+
+	macro_count++;
+	if(macro_count > macro_bucket_count)
+	{
+		macro_table_grow();
+	}
+	else
+	{
+		macro->next_in_bucket = macro_buckets[macro->hash & (macro_bucket_count - 1)];
+		macro_buckets[macro->hash & (macro_bucket_count - 1)] = macro;
+	}
 }
 
 void append_macro_definition_parameter(char * name)
@@ -68,42 +150,125 @@ void append_macro_definition_parameter(char * name)
 }
 
 bool is_replacement;
+// tokens replayed from an included file still count as lines of that file
+static bool is_include_replacement;
+
+static bool is_counting_lines(void)
+{
+	return !is_replacement || is_include_replacement;
+}
 
 void advance_line(void)
 {
-	if(!is_replacement)
+	if(is_counting_lines())
 		current_parser_state->line_number++;
+	local_label_binder_publish(&current_parser_state->stream);
 }
 
+static int fetch_definition_token(bool * is_shared);
+static integer_value_t copy_repeat_counter(void);
+
 void parse_macro_definition(void)
 {
 	int token_type;
-	if(!is_replacement) // one newline gets swallowed due to look ahead
+	bool is_shared;
+	if(is_counting_lines()) // one newline gets swallowed due to look ahead
 		current_parser_state->line_number++;
 	while(true)
 	{
-		token_type = yylex_direct();
+		token_type = fetch_definition_token(&is_shared);
 		if(token_type == 0)
 			break;
 		if(token_type == KWD_ENDMACRO)
 		{
-			yylex_direct();
+			fetch_definition_token(&is_shared);
 			break;
 		}
-		if(token_type == '\n' && !is_replacement)
+		if(token_type == '\n' && is_counting_lines())
 		{
 			current_parser_state->line_number++;
 		}
+		if(token_type == TOK_REPEAT_COUNTER)
+		{
+			// a macro defined inside a .repeat body keeps the value of the counter at its definition, the counter itself does not outlive the body
+			token_type = TOK_INTEGER;
+			yylval.j = copy_repeat_counter();
+		}
+		if(token_type == TOK_IDENTIFIER)
+		{
+			// parameters are resolved here, so expansion does not have to compare names
+			for(size_t argument_index = 0; argument_index < macros->argument_count; argument_index++)
+			{
+				if(strcmp(macros->argument_names[argument_index], yylval.s) == 0)
+				{
+					if(!is_shared)
+						free(yylval.s);
+					token_type = TOK_MACRO_PARAM;
+					yylval.i = argument_index;
+					break;
+				}
+			}
+		}
 		token_sequence_append(&macros->definition, token_type, yylval);
 	}
 }
 
+// an included file, it is only tokenized the first time and its tokens are replayed for every inclusion
+typedef struct include_file_t include_file_t;
+struct include_file_t
+{
+	char * name;
+	dev_t device;
+	ino_t inode;
+	uint64_t mode; // the parser state the tokens were scanned in
+	bool once; // a .once directive was encountered, it should not be included again
+	token_sequence_t tokens;
+	include_file_t * next;
+};
+
+static include_file_t * include_files;
+static const char * input_filename;
+static char ** include_directories;
+static size_t include_directory_count;
+
+#define INCLUDE_DEPTH_MAX 64
+
+void preprocessor_set_input_filename(const char * filename)
+{
+	input_filename = filename;
+}
+
+void preprocessor_add_include_directory(const char * directory)
+{
+	include_directories = realloc(include_directories, (include_directory_count + 1) * sizeof(char *));
+	include_directories[include_directory_count++] = strdup(directory);
+}
+
+// where the token sequences of included files are stored between runs, NULL if they are not
+static const char * precompiled_directory;
+
+void preprocessor_set_precompiled_directory(const char * directory)
+{
+	precompiled_directory = directory;
+}
+
 struct replacement_t
 {
 	// the following fields are only set for macro replacement
 	macro_definition_t * definition;
 	size_t parameter_count;
 	token_sequence_t * parameters;
+	size_t parameter_capacity; // the parameter buffers are kept when the replacement is reused
+
+	// the following fields are only set for file inclusion
+	include_file_t * include;
+	size_t saved_line_number; // line number to continue with in the including file
+
+	// the following fields are only set for .repeat
+	size_t repetition_count;
+	size_t repetition_index;
+	integer_value_t repetition_value; // the value of the counter symbol, if it is used
+	bool has_repetition_value;
 
 	// which context should the tokens be evaluated in?
 	// points to itself unless it is a parameter
@@ -115,6 +280,91 @@ struct replacement_t
 };
 
 replacement_t * current_replacement;
+static bool input_finished = false;
+
+// finished replacements are kept for reuse, so expanding a macro does not allocate once enough of them exist
+static replacement_t * free_replacements;
+
+static replacement_t * replacement_allocate(void)
+{
+	replacement_t * replacement = free_replacements;
+	if(replacement == NULL)
+	{
+		replacement = malloc(sizeof(replacement_t));
+		memset(replacement, 0, sizeof(replacement_t));
+		return replacement;
+	}
+
+	free_replacements = replacement->next;
+	token_sequence_t * parameters = replacement->parameters;
+	size_t parameter_capacity = replacement->parameter_capacity;
+	memset(replacement, 0, sizeof(replacement_t));
+	replacement->parameters = parameters;
+	replacement->parameter_capacity = parameter_capacity;
+	return replacement;
+}
+
+static void replacement_release(replacement_t * replacement)
+{
+	replacement->next = free_replacements;
+	free_replacements = replacement;
+}
+
+// starts a new, empty argument, reusing a buffer from an earlier expansion if possible
+static token_sequence_t * replacement_add_parameter(replacement_t * replacement)
+{
+	if(replacement->parameter_count == replacement->parameter_capacity)
+	{
+		replacement->parameter_capacity = replacement->parameter_capacity == 0 ? 4 : 2 * replacement->parameter_capacity;
+		replacement->parameters = realloc(replacement->parameters, replacement->parameter_capacity * sizeof(token_sequence_t));
+		for(size_t index = replacement->parameter_count; index < replacement->parameter_capacity; index++)
+			token_sequence_init(&replacement->parameters[index]);
+	}
+	token_sequence_t * parameter = &replacement->parameters[replacement->parameter_count++];
+	parameter->count = 0;
+	return parameter;
+}
+
+// the innermost file being included, NULL for the main input
+static include_file_t * current_include_file(void)
+{
+	for(replacement_t * replacement = current_replacement; replacement != NULL; replacement = replacement->next)
+	{
+		if(replacement->include != NULL)
+			return replacement->include;
+	}
+	return NULL;
+}
+
+const char * preprocessor_get_current_filename(void)
+{
+	include_file_t * file = current_include_file();
+	return file != NULL ? file->name : NULL;
+}
+
+// tokens of an included file are shared with every other inclusion, is_shared is set for them
+static int fetch_definition_token(bool * is_shared)
+{
+	*is_shared = current_replacement != NULL && (current_replacement->include != NULL || current_replacement->repetition_count != 0);
+	if(*is_shared)
+	{
+		// a macro defined in an included file or a .repeat body ends with it
+		if(current_replacement->current_token_index >= current_replacement->token_sequence->count)
+			return 0;
+		yylval = current_replacement->token_sequence->buffer[current_replacement->current_token_index].value;
+		return current_replacement->token_sequence->buffer[current_replacement->current_token_index++].type;
+	}
+	return yylex_direct();
+}
+
+// the current value of the counter of the .repeat body being read
+static integer_value_t copy_repeat_counter(void)
+{
+	integer_value_t value;
+	uint_parse(value, "0", 10);
+	int_set(INTVAL(value), INTVAL(current_replacement->repetition_value));
+	return value;
+}
 
 int fetch_next_token(void)
 {
@@ -124,14 +374,25 @@ restart_replacement:
 		if(current_replacement->current_token_index >= current_replacement->token_sequence->count)
 		{
 			replacement_t * current = current_replacement;
+			if(current->repetition_count != 0 && ++current->repetition_index < current->repetition_count)
+			{
+				current->current_token_index = 0;
+				if(current->has_repetition_value)
+					int_set_ui(INTVAL(current->repetition_value), current->repetition_index);
+				continue;
+			}
+
 			current_replacement = current->next;
-			if(current->parameters != NULL)
+			if(current->include != NULL)
+				current_parser_state->line_number = current->saved_line_number;
+			if(current->repetition_count != 0)
 			{
-				for(size_t i = 0; i < current->parameter_count; i++)
-					token_sequence_free(&current->parameters[i]);
-				free(current->parameters);
+				token_sequence_free(current->token_sequence);
+				free(current->token_sequence);
+				if(current->has_repetition_value)
+					int_delete(current->repetition_value);
 			}
-			free(current);
+			replacement_release(current);
 		}
 		else
 		{
@@ -139,30 +400,438 @@ restart_replacement:
 			yylval = current_replacement->token_sequence->buffer[current_replacement->current_token_index].value;
 			current_replacement->current_token_index ++;
 
-			if(token_type == TOK_IDENTIFIER)
+			if(token_type == TOK_MACRO_PARAM)
 			{
-				for(size_t argument_index = 0; argument_index < current_replacement->context->definition->argument_count; argument_index++)
+				// arguments that were not provided are empty
+				if(yylval.i < current_replacement->context->parameter_count)
 				{
-					if(strcmp(current_replacement->context->definition->argument_names[argument_index], yylval.s) == 0)
-					{
-						replacement_t * replacement = malloc(sizeof(replacement_t));
-						memset(replacement, 0, sizeof(replacement_t));
-						replacement->token_sequence = &current_replacement->context->parameters[argument_index];
-						replacement->context = current_replacement->context;
-						replacement->next = current_replacement;
-						current_replacement = replacement;
-						goto restart_replacement;
-					}
+					replacement_t * replacement = replacement_allocate();
+					replacement->token_sequence = &current_replacement->context->parameters[yylval.i];
+					replacement->context = current_replacement->context;
+					replacement->next = current_replacement;
+					current_replacement = replacement;
 				}
+				goto restart_replacement;
+			}
+			else if(token_type == TOK_REPEAT_COUNTER)
+			{
+				token_type = TOK_INTEGER;
+				yylval.j = current_replacement->repetition_value;
 			}
 
 			is_replacement = true;
+			is_include_replacement = current_replacement->include != NULL;
 			return token_type;
 		}
 	}
 
 	is_replacement = false;
-	return yylex_direct();
+	is_include_replacement = false;
+	// the scanner is not called again once it reached the end, for example when the last line is an .include
+	if(input_finished)
+		return 0;
+	int token_type = yylex_direct();
+	if(token_type == 0)
+		input_finished = true;
+	return token_type;
+}
+
+// looks for the file next to the including file, then in the include directories
+static FILE * include_file_open(const char * name, char ** path)
+{
+	const char * including_filename = preprocessor_get_current_filename();
+	if(including_filename == NULL)
+		including_filename = input_filename;
+
+	size_t directory_length = 0;
+	if(name[0] != '/' && including_filename != NULL && strrchr(including_filename, '/') != NULL)
+		directory_length = strrchr(including_filename, '/') + 1 - including_filename;
+
+	*path = malloc(directory_length + strlen(name) + 1);
+	memcpy(*path, including_filename, directory_length);
+	strcpy(*path + directory_length, name);
+	FILE * file = fopen(*path, "r");
+	if(file != NULL || name[0] == '/')
+		return file;
+	free(*path);
+
+	for(size_t directory_index = 0; directory_index < include_directory_count; directory_index++)
+	{
+		*path = malloc(strlen(include_directories[directory_index]) + 1 + strlen(name) + 1);
+		sprintf(*path, "%s/%s", include_directories[directory_index], name);
+		file = fopen(*path, "r");
+		if(file != NULL)
+			return file;
+		free(*path);
+	}
+
+	*path = NULL;
+	return NULL;
+}
+
+// a precompiled file starts with this header, followed by the tokens
+// each token is stored as its 32-bit type, a byte giving the kind of value, then the value
+// strings and integers (as hexadecimal digits) are null terminated, other values are stored as 64-bit words
+typedef struct precompiled_header_t
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t token_count;
+	uint64_t token_fingerprint; // the token types are only meaningful for the grammar they were stored with
+	uint64_t key;
+	uint64_t source_size;
+} precompiled_header_t;
+
+#define PRECOMPILED_MAGIC "ASMTOKEN"
+#define PRECOMPILED_VERSION 2
+
+enum
+{
+	PRECOMPILED_WORD,
+	PRECOMPILED_STRING,
+	PRECOMPILED_INTEGER,
+};
+
+static int precompiled_value_kind(int token_type)
+{
+	switch(token_type)
+	{
+	case TOK_IDENTIFIER:
+	case TOK_STRING:
+		return PRECOMPILED_STRING;
+	case TOK_INTEGER:
+	case TOK_LABEL_FORWARD:
+	case TOK_LABEL_BACKWARD:
+		return PRECOMPILED_INTEGER;
+	default:
+		return PRECOMPILED_WORD;
+	}
+}
+
+static uint64_t precompiled_hash(uint64_t hash, const void * data, size_t size)
+{
+	// FNV-1a
+	for(size_t offset = 0; offset < size; offset++)
+	{
+		hash ^= ((const uint8_t *)data)[offset];
+		hash *= 0x100000001B3;
+	}
+	return hash;
+}
+
+// the scanner mode is selected by the parser state after the line number
+static uint64_t precompiled_hash_mode(uint64_t hash)
+{
+	size_t state_offset = offsetof(parser_state_t, line_number) + sizeof(size_t);
+	return precompiled_hash(hash, (const uint8_t *)current_parser_state + state_offset, sizeof(parser_state_t) - state_offset);
+}
+
+// the tokens depend on the target and its grammar, the scanner mode and the contents of the file
+static uint64_t precompiled_get_key(FILE * input, uint64_t * source_size)
+{
+	uint64_t key = 0xCBF29CE484222325;
+	uint32_t version = PRECOMPILED_VERSION;
+	key = precompiled_hash(key, &version, sizeof version);
+	key = precompiled_hash(key, TARGET_NAME, sizeof TARGET_NAME);
+	uint64_t token_fingerprint = parser_get_token_fingerprint();
+	key = precompiled_hash(key, &token_fingerprint, sizeof token_fingerprint);
+	key = precompiled_hash_mode(key);
+
+	char buffer[0x10000];
+	size_t count;
+	*source_size = 0;
+	while((count = fread(buffer, 1, sizeof buffer, input)) > 0)
+	{
+		key = precompiled_hash(key, buffer, count);
+		*source_size += count;
+	}
+	rewind(input);
+	return key;
+}
+
+static char * precompiled_get_filename(uint64_t key)
+{
+	char * filename = malloc(strlen(precompiled_directory) + 1 + 16 + 4 + 1);
+	sprintf(filename, "%s/%016llX.tok", precompiled_directory, (unsigned long long)key);
+	return filename;
+}
+
+// maps a previously stored file, the strings of the tokens point into the mapping, which is kept until the end
+static bool precompiled_load(include_file_t * file, uint64_t key, uint64_t source_size)
+{
+	char * filename = precompiled_get_filename(key);
+	int fd = open(filename, O_RDONLY);
+	free(filename);
+	if(fd == -1)
+		return false;
+
+	struct stat status;
+	if(fstat(fd, &status) != 0 || status.st_size < sizeof(precompiled_header_t))
+	{
+		close(fd);
+		return false;
+	}
+	size_t size = status.st_size;
+	char * data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(data == MAP_FAILED)
+		return false;
+
+	precompiled_header_t header;
+	memcpy(&header, data, sizeof header);
+	if(memcmp(header.magic, PRECOMPILED_MAGIC, sizeof header.magic) != 0
+	|| header.version != PRECOMPILED_VERSION
+	|| header.token_fingerprint != parser_get_token_fingerprint()
+	|| header.key != key
+	|| header.source_size != source_size)
+	{
+		munmap(data, size);
+		return false;
+	}
+
+	size_t offset = sizeof header;
+	for(uint32_t token_index = 0; token_index < header.token_count; token_index++)
+	{
+		int32_t token_type;
+		YYSTYPE value;
+		memset(&value, 0, sizeof value);
+		if(size - offset < sizeof token_type + 1)
+			goto invalid;
+		memcpy(&token_type, data + offset, sizeof token_type);
+		offset += sizeof token_type;
+		int kind = data[offset++];
+		if(kind != precompiled_value_kind(token_type))
+			goto invalid;
+
+		if(kind == PRECOMPILED_WORD)
+		{
+			int64_t word;
+			if(size - offset < sizeof word)
+				goto invalid;
+			memcpy(&word, data + offset, sizeof word);
+			offset += sizeof word;
+			value.i = word;
+		}
+		else
+		{
+			char * end = memchr(data + offset, '\0', size - offset);
+			if(end == NULL)
+				goto invalid;
+			if(kind == PRECOMPILED_STRING)
+				value.s = data + offset;
+			else
+				uint_parse(value.j, data + offset, 16);
+			offset = end + 1 - data;
+		}
+
+		token_sequence_append(&file->tokens, token_type, value);
+	}
+	return true;
+
+invalid:
+	// the integers parsed so far are lost, but a damaged cache should be rare
+	file->tokens.count = 0;
+	munmap(data, size);
+	return false;
+}
+
+// the file is written under a temporary name first, so that concurrent runs never see it partially written
+static void precompiled_store(include_file_t * file, uint64_t key, uint64_t source_size)
+{
+	char * filename = precompiled_get_filename(key);
+	char * temporary_filename = malloc(strlen(filename) + 8);
+	sprintf(temporary_filename, "%s.XXXXXX", filename);
+
+	int fd = mkstemp(temporary_filename);
+	if(fd != -1)
+	{
+		// the directory may be shared, so use the permissions fopen would have given the file
+		mode_t mask = umask(0);
+		umask(mask);
+		fchmod(fd, 0666 & ~mask);
+	}
+	FILE * output = fd != -1 ? fdopen(fd, "wb") : NULL;
+	if(output == NULL)
+	{
+		if(fd != -1)
+		{
+			close(fd);
+			unlink(temporary_filename);
+		}
+		free(temporary_filename);
+		free(filename);
+		return;
+	}
+
+	precompiled_header_t header;
+	memset(&header, 0, sizeof header);
+	memcpy(header.magic, PRECOMPILED_MAGIC, sizeof header.magic);
+	header.version = PRECOMPILED_VERSION;
+	header.token_count = file->tokens.count;
+	header.token_fingerprint = parser_get_token_fingerprint();
+	header.key = key;
+	header.source_size = source_size;
+	fwrite(&header, sizeof header, 1, output);
+
+	for(size_t token_index = 0; token_index < file->tokens.count; token_index++)
+	{
+		int32_t token_type = file->tokens.buffer[token_index].type;
+		YYSTYPE value = file->tokens.buffer[token_index].value;
+		int kind = precompiled_value_kind(token_type);
+		fwrite(&token_type, sizeof token_type, 1, output);
+		fputc(kind, output);
+		if(kind == PRECOMPILED_WORD)
+		{
+			int64_t word = value.i;
+			fwrite(&word, sizeof word, 1, output);
+		}
+		else if(kind == PRECOMPILED_STRING)
+		{
+			fwrite(value.s, 1, strlen(value.s) + 1, output);
+		}
+		else
+		{
+			uint_print_hex(output, INTVAL(value.j));
+			fputc('\0', output);
+		}
+	}
+
+	if(fclose(output) != 0 || rename(temporary_filename, filename) != 0)
+		unlink(temporary_filename);
+	free(temporary_filename);
+	free(filename);
+}
+
+// returns the cached file if it was included before, otherwise tokenizes it through a new scanner buffer
+static include_file_t * include_file_load(const char * name)
+{
+	char * path;
+	FILE * input = include_file_open(name, &path);
+	if(input == NULL)
+	{
+		fprintf(stderr, "Error in line %ld: unable to open %s for reading\n", current_parser_state->line_number, name);
+		exit(1);
+	}
+
+	struct stat status;
+	if(fstat(fileno(input), &status) != 0)
+	{
+		fprintf(stderr, "Error in line %ld: unable to read %s\n", current_parser_state->line_number, path);
+		exit(1);
+	}
+
+	// a file included in different scanner modes is scanned once for each of them
+	uint64_t mode = precompiled_hash_mode(0xCBF29CE484222325);
+	include_file_t * cached = NULL;
+	for(include_file_t * file = include_files; file != NULL; file = file->next)
+	{
+		// the same file might be reached through different paths
+		if(file->device != status.st_dev || file->inode != status.st_ino)
+			continue;
+		// .once applies to the file, whatever mode it was scanned in
+		if(file->once)
+		{
+			cached = file;
+			break;
+		}
+		if(file->mode == mode)
+			cached = file;
+	}
+	if(cached != NULL)
+	{
+		fclose(input);
+		free(path);
+		return cached;
+	}
+
+	include_file_t * file = malloc(sizeof(include_file_t));
+	memset(file, 0, sizeof(include_file_t));
+	file->name = path;
+	file->device = status.st_dev;
+	file->inode = status.st_ino;
+	file->mode = mode;
+	token_sequence_init(&file->tokens);
+
+	uint64_t key = 0, source_size = 0;
+	if(precompiled_directory != NULL)
+		key = precompiled_get_key(input, &source_size);
+
+	if(precompiled_directory == NULL || !precompiled_load(file, key, source_size))
+	{
+		// strings have to be copied out of the scanner buffer
+		bool was_mapped = input_is_mapped;
+		input_is_mapped = false;
+		yypush_buffer_state(yy_create_buffer(input, 0x4000));
+		int token_type;
+		while((token_type = yylex_direct()) != 0)
+			token_sequence_append(&file->tokens, token_type, yylval);
+		yypop_buffer_state();
+		input_is_mapped = was_mapped;
+
+		if(file->tokens.count > 0 && file->tokens.buffer[file->tokens.count - 1].type != '\n')
+		{
+			YYSTYPE value;
+			memset(&value, 0, sizeof value);
+			token_sequence_append(&file->tokens, '\n', value);
+		}
+
+		if(precompiled_directory != NULL)
+			precompiled_store(file, key, source_size);
+	}
+	fclose(input);
+
+	file->next = include_files;
+	include_files = file;
+	return file;
+}
+
+// reads the rest of the .include line and starts replaying the file
+static void include_directive(void)
+{
+	int token_type = fetch_next_token();
+	if(token_type != TOK_STRING)
+	{
+		fprintf(stderr, "Error in line %ld: file name expected after .include\n", current_parser_state->line_number);
+		exit(1);
+	}
+	char * name = yylval.s;
+
+	token_type = fetch_next_token();
+	if(token_type != '\n' && token_type != 0)
+	{
+		fprintf(stderr, "Error in line %ld: end of line expected after .include\n", current_parser_state->line_number);
+		exit(1);
+	}
+	// the newline is consumed here, so the parser will not count it
+	size_t next_line_number = current_parser_state->line_number + (token_type == '\n' && is_counting_lines() ? 1 : 0);
+
+	include_file_t * file = include_file_load(name);
+	if(file->once)
+	{
+		current_parser_state->line_number = next_line_number;
+		return;
+	}
+
+	size_t depth = 0;
+	for(replacement_t * replacement = current_replacement; replacement != NULL; replacement = replacement->next)
+	{
+		if(replacement->include != NULL)
+			depth++;
+	}
+	if(depth >= INCLUDE_DEPTH_MAX)
+	{
+		fprintf(stderr, "Error in line %ld: .include nested too deeply\n", current_parser_state->line_number);
+		exit(1);
+	}
+
+	replacement_t * replacement = replacement_allocate();
+	replacement->token_sequence = &file->tokens;
+	replacement->context = replacement;
+	replacement->include = file;
+	replacement->saved_line_number = next_line_number;
+	replacement->next = current_replacement;
+	current_replacement = replacement;
+	current_parser_state->line_number = 1;
 }
 
 void invoke_macro(replacement_t * next_replacement)
@@ -172,9 +841,7 @@ void invoke_macro(replacement_t * next_replacement)
 	int token_type = fetch_next_token();
 	if(token_type != '\n' && token_type != 0)
 	{
-		next_replacement->parameter_count ++;
-		next_replacement->parameters = malloc(sizeof(token_sequence_t));
-		token_sequence_init(&next_replacement->parameters[0]);
+		token_sequence_t * parameter = replacement_add_parameter(next_replacement);
 		while(token_type != '\n' && token_type != 0)
 		{
 			if(token_type == '(' || token_type == '[' || token_type == '{')
@@ -189,13 +856,11 @@ void invoke_macro(replacement_t * next_replacement)
 			}
 			else if(paren_depth == 0 && token_type == ',')
 			{
-				next_replacement->parameter_count ++;
-				next_replacement->parameters = realloc(next_replacement->parameters, next_replacement->parameter_count * sizeof(token_sequence_t));
-				token_sequence_init(&next_replacement->parameters[next_replacement->parameter_count - 1]);
+				parameter = replacement_add_parameter(next_replacement);
 			}
 			else
 			{
-				token_sequence_append(&next_replacement->parameters[next_replacement->parameter_count - 1], token_type, yylval);
+				token_sequence_append(parameter, token_type, yylval);
 			}
 
 			token_type = fetch_next_token();
@@ -205,6 +870,90 @@ void invoke_macro(replacement_t * next_replacement)
 	current_replacement = next_replacement;
 }
 
+static size_t repeat_count;
+static char * repeat_counter_name;
+
+bool begin_repeat_definition(expression_t * count, char * counter_name)
+{
+	reference_t ref[1];
+	evaluate_expression(count, ref, 0);
+	if(!is_scalar(ref) || int_sgn(ref->value) < 0 || !uint_fits(ref->value))
+	{
+		fprintf(stderr, "Error in line %ld: .repeat count must be a non-negative constant\n", current_parser_state->line_number);
+		int_clear(ref->value);
+		return false;
+	}
+	repeat_count = uint_get(ref->value);
+	repeat_counter_name = counter_name;
+	int_clear(ref->value);
+	return true;
+}
+
+// the body is collected like a macro definition, but through the current replacements, so it can appear inside macros and included files
+void parse_repeat_definition(void)
+{
+	token_sequence_t * body = malloc(sizeof(token_sequence_t));
+	token_sequence_init(body);
+	bool uses_counter = false;
+	size_t depth = 0;
+
+	if(is_counting_lines()) // one newline gets swallowed due to look ahead
+		current_parser_state->line_number++;
+	while(true)
+	{
+		int token_type = fetch_next_token();
+		if(token_type == 0)
+		{
+			fprintf(stderr, "Error in line %ld: no matching .endrepeat found for .repeat\n", current_parser_state->line_number);
+			exit(1);
+		}
+		else if(token_type == KWD_REPEAT)
+		{
+			depth++;
+		}
+		else if(token_type == KWD_ENDREPEAT)
+		{
+			if(depth == 0)
+			{
+				fetch_next_token();
+				break;
+			}
+			depth--;
+		}
+		else if(token_type == '\n' && is_counting_lines())
+		{
+			current_parser_state->line_number++;
+		}
+		else if(token_type == TOK_IDENTIFIER && repeat_counter_name != NULL && strcmp(yylval.s, repeat_counter_name) == 0)
+		{
+			if(!is_replacement)
+				free(yylval.s);
+			token_type = TOK_REPEAT_COUNTER;
+			uses_counter = true;
+		}
+		token_sequence_append(body, token_type, yylval);
+	}
+
+	if(repeat_count == 0 || body->count == 0)
+	{
+		token_sequence_free(body);
+		free(body);
+		return;
+	}
+
+	replacement_t * replacement = replacement_allocate();
+	replacement->token_sequence = body;
+	replacement->context = replacement;
+	replacement->repetition_count = repeat_count;
+	if(uses_counter)
+	{
+		uint_parse(replacement->repetition_value, "0", 10);
+		replacement->has_repetition_value = true;
+	}
+	replacement->next = current_replacement;
+	current_replacement = replacement;
+}
+
 static bool is_conditional_statement(int token_type)
 {
 	switch(token_type)
@@ -302,6 +1051,9 @@ int yylex(void)
 {
 	for(;;)
 	{
+		// lines of a false block read from the source are dropped by the scanner, replayed tokens are filtered here
+		lexer_skip_lines((false_if_level > 0 || past_true_if_clause) && !parsing_conditional);
+
 		int token_type = fetch_next_token();
 
 		if(!(false_if_level == 0 && !past_true_if_clause))
@@ -323,22 +1075,48 @@ int yylex(void)
 			}
 		}
 
+		if(token_type == KWD_INCLUDE)
+		{
+			include_directive();
+			is_line_start = true;
+			parsing_conditional = false;
+			continue;
+		}
+		else if(token_type == KWD_ONCE)
+		{
+			include_file_t * file = current_include_file();
+			if(file != NULL)
+				file->once = true;
+			token_type = fetch_next_token();
+			if(token_type == '\n')
+			{
+				advance_line();
+				is_line_start = true;
+				parsing_conditional = false;
+				continue;
+			}
+			else if(token_type != 0)
+			{
+				fprintf(stderr, "Error in line %ld: end of line expected after .once\n", current_parser_state->line_number);
+				exit(1);
+			}
+		}
+
 		if(token_type == TOK_IDENTIFIER)
 		{
-			for(macro_definition_t * current_macro = macros; current_macro != NULL; current_macro = current_macro->next)
+			macro_definition_t * current_macro = macro_lookup(yylval.s);
+			if(current_macro != NULL)
 			{
-				if(strcmp(current_macro->name, yylval.s) == 0)
-				{
-					replacement_t * replacement = malloc(sizeof(replacement_t));
-					memset(replacement, 0, sizeof(replacement_t));
-					replacement->token_sequence = &current_macro->definition;
-					replacement->context = replacement;
-					replacement->definition = current_macro;
-					replacement->next = current_replacement;
+				replacement_t * replacement = replacement_allocate();
+				replacement->token_sequence = &current_macro->definition;
+				replacement->context = replacement;
+				replacement->definition = current_macro;
+				replacement->next = current_replacement;
+				// the name might be part of a macro body or included file that gets replayed again
+				if(!is_replacement)
 					free(yylval.s);
-					yylval.macro = replacement;
-					return TOK_MACRONAME;
-				}
+				yylval.macro = replacement;
+				return TOK_MACRONAME;
 			}
 		}
 
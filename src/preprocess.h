@@ -13,6 +13,9 @@ void parse_macro_definition(void); // reads definition from input stream
 
 void invoke_macro(replacement_t * next_replacement);
 
+bool begin_repeat_definition(expression_t * count, char * counter_name);
+void parse_repeat_definition(void); // reads the body from the input stream and starts replaying it
+
 void handle_if_directive(expression_t * condition);
 void handle_else_if_directive(expression_t * condition);
 void handle_else_directive(void);
@@ -20,4 +23,11 @@ void handle_end_if_directive(void);
 
 void preprocessor_define(const char * name, expression_t * exp);
 
+void preprocessor_set_input_filename(const char * filename);
+void preprocessor_add_include_directory(const char * directory);
+void preprocessor_set_precompiled_directory(const char * directory);
+const char * preprocessor_get_current_filename(void); // NULL outside included files
+
+uint64_t parser_get_token_fingerprint(void);
+
 #endif // _PREPROCESS_H
@@ -5,9 +5,14 @@
 
 #define entry_point_name (entry_point_name == NULL ? "..start" : entry_point_name)
 
-static uint8_t rel_bit_buffer = 0;
+// pending bits are kept right aligned, there are always fewer than 8 of them between calls
+static uint64_t rel_bit_buffer = 0;
 static size_t rel_bit_buffer_size = 0;
 
+// completed bytes are collected before getting written out
+static uint8_t rel_output_buffer[0x10000];
+static size_t rel_output_size = 0;
+
 typedef enum relative_t
 {
 	REL_ABS = 0,
@@ -36,30 +41,41 @@ typedef enum special_t
 	SPEC_FILE_END = 0xF,
 } special_t;
 
-void rel_bit_buffer_flush(void)
+static void rel_output_flush(void)
 {
-	fwrite8(output.file, rel_bit_buffer);
-	rel_bit_buffer = 0;
-	rel_bit_buffer_size = 0;
+	fwrite(rel_output_buffer, 1, rel_output_size, output.file);
+	rel_output_size = 0;
 }
 
-// maximum only 8 bits allowed
-void rel_writebits(size_t count, uint8_t value)
+static inline void rel_bit_buffer_drain(void)
 {
-	if(rel_bit_buffer_size + count >= 8)
-	{
-		rel_bit_buffer |= value >> (rel_bit_buffer_size + count - 8);
-		value &= ~(-1 << (rel_bit_buffer_size + count - 8));
-		count -= 8 - rel_bit_buffer_size;
-		rel_bit_buffer_flush();
-	}
-	if(count > 0)
+	if(rel_output_size + 8 > sizeof rel_output_buffer)
+		rel_output_flush();
+	while(rel_bit_buffer_size >= 8)
 	{
-		rel_bit_buffer |= value << (8 - rel_bit_buffer_size - count);
-		rel_bit_buffer_size += count;
+		rel_bit_buffer_size -= 8;
+		rel_output_buffer[rel_output_size++] = rel_bit_buffer >> rel_bit_buffer_size;
 	}
 }
 
+// pads the last byte with zeroes, a zero byte is written even if no bits are pending
+void rel_bit_buffer_flush(void)
+{
+	rel_bit_buffer_drain();
+	rel_bit_buffer <<= 8 - rel_bit_buffer_size;
+	rel_bit_buffer_size = 8;
+	rel_bit_buffer_drain();
+	rel_bit_buffer = 0;
+}
+
+// maximum only 56 bits allowed
+static inline void rel_writebits(size_t count, uint64_t value)
+{
+	rel_bit_buffer = (rel_bit_buffer << count) | (value & ~(~(uint64_t)0 << count));
+	rel_bit_buffer_size += count;
+	rel_bit_buffer_drain();
+}
+
 void rel_writebyte(uint8_t value)
 {
 	rel_writebits(8, value);
@@ -81,6 +97,20 @@ void rel_putbyte(uint8_t value)
 	last_location ++;
 }
 
+// absolute bytes take 9 bits each, up to 6 of them are packed into a single write
+void rel_putbytes(size_t count, const uint8_t * data)
+{
+	for(; count >= 6; count -= 6, data += 6)
+	{
+		rel_writebits(54,
+			((uint64_t)data[0] << 45) | ((uint64_t)data[1] << 36) | ((uint64_t)data[2] << 27)
+			| ((uint64_t)data[3] << 18) | ((uint64_t)data[4] << 9) | (uint64_t)data[5]);
+		last_location += 6;
+	}
+	for(; count > 0; count--, data++)
+		rel_putbyte(*data);
+}
+
 void rel_putword(uint8_t value)
 {
 	rel_putbyte(value);
@@ -345,7 +375,16 @@ void rel_generate(const char * module_name)
 					}
 				}
 				// TODO: multiple blocks
-				rel_putbyte(current->buffer[offset]);
+				// absolute bytes up to the next relocation, or until the location counter wraps around
+				size_t count = current->size - offset;
+				if(count > 0x10000 - last_location)
+					count = 0x10000 - last_location;
+				if(relocation_index < relocations->reloc.count
+				&& relocations->reloc.relocations[relocation_index].offset > last_location
+				&& relocations->reloc.relocations[relocation_index].offset - last_location < count)
+					count = relocations->reloc.relocations[relocation_index].offset - last_location;
+				rel_putbytes(count, &current->buffer[offset]);
+				offset += count - 1;
 			}
 		}
 	}
@@ -412,5 +451,6 @@ no_start_symbol:
 	rel_bit_buffer_flush();
 	rel_putspecial(SPEC_FILE_END);
 	rel_bit_buffer_flush();
+	rel_output_flush();
 }
 
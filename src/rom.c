@@ -0,0 +1,228 @@
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "asm.h"
+#include "rom.h"
+
+// size of the files the image is split into, 0 if it is written as a single file
+size_t rom_bank_size = 0;
+
+#define ROM_PAGE_SIZE 0x10000
+#define ROM_ADDRESS_LIMIT ((uint64_t)1 << 32)
+#define ROM_PATTERN_MAX 16
+
+// the image is only allocated for the 64 KiB pages that get written to, the rest is filled with the pattern when written out
+struct
+{
+	uint8_t ** pages;
+	size_t page_count;
+	uint64_t address;
+	// the bytes between these addresses get written out
+	uint64_t low_address;
+	uint64_t high_address;
+	bool out_of_range;
+	// the pattern repeats at absolute addresses, so the gaps look the same regardless of where the image starts
+	size_t pattern_length;
+	uint8_t pattern[ROM_PATTERN_MAX];
+} rom =
+{
+	.pages = NULL,
+	.page_count = 0,
+	.address = 0,
+	.low_address = (uint64_t)-1,
+	.high_address = 0,
+	.out_of_range = false,
+	.pattern_length = 1,
+	.pattern = { 0xFF },
+};
+
+static int rom_hex_digit(char c)
+{
+	if('0' <= c && c <= '9')
+		return c - '0';
+	else if('A' <= c && c <= 'F')
+		return c - 'A' + 10;
+	else if('a' <= c && c <= 'f')
+		return c - 'a' + 10;
+	else
+		return -1;
+}
+
+// the pattern is given as a sequence of hexadecimal bytes, for example FF or DEADBEEF
+bool rom_set_pattern(const char * text)
+{
+	if(text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+		text += 2;
+
+	size_t length = strlen(text);
+	if(length == 0 || length % 2 != 0 || length / 2 > ROM_PATTERN_MAX)
+		return false;
+
+	for(size_t index = 0; index < length / 2; index++)
+	{
+		int high = rom_hex_digit(text[2 * index]);
+		int low = rom_hex_digit(text[2 * index + 1]);
+		if(high == -1 || low == -1)
+			return false;
+		rom.pattern[index] = (high << 4) | low;
+	}
+	rom.pattern_length = length / 2;
+	return true;
+}
+
+static void rom_fill(uint8_t * buffer, uint64_t address, size_t count)
+{
+	size_t phase = address % rom.pattern_length;
+	for(size_t offset = 0; offset < count; offset++)
+	{
+		buffer[offset] = rom.pattern[phase];
+		if(++phase == rom.pattern_length)
+			phase = 0;
+	}
+}
+
+static uint8_t * rom_get_page(size_t page_index)
+{
+	if(page_index >= rom.page_count)
+	{
+		size_t page_count = rom.page_count == 0 ? 16 : rom.page_count;
+		while(page_count <= page_index)
+			page_count *= 2;
+		rom.pages = realloc(rom.pages, page_count * sizeof(uint8_t *));
+		memset(rom.pages + rom.page_count, 0, (page_count - rom.page_count) * sizeof(uint8_t *));
+		rom.page_count = page_count;
+	}
+
+	if(rom.pages[page_index] == NULL)
+	{
+		rom.pages[page_index] = malloc(ROM_PAGE_SIZE);
+		rom_fill(rom.pages[page_index], (uint64_t)page_index * ROM_PAGE_SIZE, ROM_PAGE_SIZE);
+	}
+	return rom.pages[page_index];
+}
+
+// the range written out includes skipped bytes as well
+static void rom_extend(uint64_t start, uint64_t end)
+{
+	if(start < rom.low_address)
+		rom.low_address = start;
+	if(end > rom.high_address)
+		rom.high_address = end;
+}
+
+void rom_set_location(uint64_t address)
+{
+	rom.address = address;
+}
+
+void rom_output_bytes(size_t count, const uint8_t * data)
+{
+	if(count == 0)
+		return;
+
+	if(rom.address + count > ROM_ADDRESS_LIMIT)
+	{
+		if(!rom.out_of_range)
+			fprintf(stderr, "Error: address 0x%lX beyond the range of the ROM image\n", rom.address + count - 1);
+		rom.out_of_range = true;
+		rom.address += count;
+		return;
+	}
+
+	rom_extend(rom.address, rom.address + count);
+
+	while(count > 0)
+	{
+		size_t offset = rom.address % ROM_PAGE_SIZE;
+		size_t length = ROM_PAGE_SIZE - offset < count ? ROM_PAGE_SIZE - offset : count;
+		memcpy(rom_get_page(rom.address / ROM_PAGE_SIZE) + offset, data, length);
+		rom.address += length;
+		data += length;
+		count -= length;
+	}
+}
+
+void rom_skip(uint64_t count)
+{
+	// the skipped bytes are left as a gap
+	if(count > 0 && rom.address + count <= ROM_ADDRESS_LIMIT)
+		rom_extend(rom.address, rom.address + count);
+	rom.address += count;
+}
+
+// returns false if some data could not be placed in the image
+bool rom_check_range(void)
+{
+	return !rom.out_of_range;
+}
+
+// banks start at absolute multiples of the bank size, the first one written is the one containing the lowest address
+static uint64_t rom_get_first_bank(void)
+{
+	return rom.low_address / rom_bank_size;
+}
+
+size_t rom_get_bank_count(void)
+{
+	if(rom.low_address >= rom.high_address || rom_bank_size == 0)
+		return 1;
+	else
+		return (rom.high_address + rom_bank_size - 1) / rom_bank_size - rom_get_first_bank();
+}
+
+// banks are numbered after their address divided by the bank size, appended to the requested filename, for example image.rom.0, image.rom.1
+char * rom_get_bank_filename(const char * filename, size_t bank_index)
+{
+	if(rom_bank_size == 0)
+		return strdup(filename);
+
+	uint64_t bank_number = rom.low_address >= rom.high_address ? 0 : rom_get_first_bank() + bank_index;
+	char * bank_filename = malloc(strlen(filename) + 1 + 20 + 1);
+	sprintf(bank_filename, "%s.%lu", filename, bank_number);
+	return bank_filename;
+}
+
+// writes a bank of the image in one pass, the first and final banks are padded to the full bank size
+void rom_write_bank(FILE * file, size_t bank_index)
+{
+	uint64_t start, end;
+	if(rom.low_address >= rom.high_address)
+	{
+		return;
+	}
+	else if(rom_bank_size == 0)
+	{
+		start = rom.low_address;
+		end = rom.high_address;
+	}
+	else
+	{
+		start = (rom_get_first_bank() + bank_index) * rom_bank_size;
+		end = start + rom_bank_size;
+	}
+
+	uint8_t * gap = NULL;
+	for(uint64_t address = start; address < end; )
+	{
+		size_t page_index = address / ROM_PAGE_SIZE;
+		size_t offset = address % ROM_PAGE_SIZE;
+		size_t length = ROM_PAGE_SIZE - offset < end - address ? ROM_PAGE_SIZE - offset : end - address;
+
+		if(page_index < rom.page_count && rom.pages[page_index] != NULL)
+		{
+			fwrite(rom.pages[page_index] + offset, 1, length, file);
+		}
+		else
+		{
+			if(gap == NULL)
+				gap = malloc(ROM_PAGE_SIZE);
+			rom_fill(gap, address, length);
+			fwrite(gap, 1, length, file);
+		}
+		address += length;
+	}
+	free(gap);
+}
+
@@ -0,0 +1,15 @@
+#ifndef _ROM_H
+#define _ROM_H
+
+extern size_t rom_bank_size;
+
+bool rom_set_pattern(const char * text);
+void rom_set_location(uint64_t address);
+void rom_output_bytes(size_t count, const uint8_t * data);
+void rom_skip(uint64_t count);
+bool rom_check_range(void);
+size_t rom_get_bank_count(void);
+char * rom_get_bank_filename(const char * filename, size_t bank_index);
+void rom_write_bank(FILE * file, size_t bank_index);
+
+#endif // _ROM_H
@@ -0,0 +1,141 @@
+
+#include <stdint.h>
+#include "scan.h"
+
+// helpers for the scanner to skip over comments, blanks and strings in bulk
+// the text must be terminated by a null character, which always stops the search
+// the vectorized versions only read aligned blocks, which never cross into a page after the terminating null character
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# include <immintrin.h>
+# define SCAN_X86 1
+#endif
+
+static const char * scan_until_scalar(const char * text, char c)
+{
+	while(*text != c && *text != '\0')
+		text++;
+	return text;
+}
+
+static const char * scan_blanks_scalar(const char * text)
+{
+	while(*text == ' ' || *text == '\t')
+		text++;
+	return text;
+}
+
+#if SCAN_X86
+__attribute__((target("sse2")))
+static const char * scan_until_sse2(const char * text, char c)
+{
+	const char * block = (const char *)((uintptr_t)text & ~(uintptr_t)15);
+	__m128i pattern = _mm_set1_epi8(c);
+	__m128i zero = _mm_setzero_si128();
+	__m128i data = _mm_load_si128((const __m128i *)block);
+	// the bytes before the start of the text are shifted out
+	unsigned mask = (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(data, pattern), _mm_cmpeq_epi8(data, zero))) >> (text - block);
+	if(mask != 0)
+		return text + __builtin_ctz(mask);
+
+	for(;;)
+	{
+		block += 16;
+		data = _mm_load_si128((const __m128i *)block);
+		mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(data, pattern), _mm_cmpeq_epi8(data, zero)));
+		if(mask != 0)
+			return block + __builtin_ctz(mask);
+	}
+}
+
+__attribute__((target("avx2")))
+static const char * scan_until_avx2(const char * text, char c)
+{
+	const char * block = (const char *)((uintptr_t)text & ~(uintptr_t)31);
+	__m256i pattern = _mm256_set1_epi8(c);
+	__m256i zero = _mm256_setzero_si256();
+	__m256i data = _mm256_load_si256((const __m256i *)block);
+	unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(data, pattern), _mm256_cmpeq_epi8(data, zero))) >> (text - block);
+	if(mask != 0)
+		return text + __builtin_ctz(mask);
+
+	for(;;)
+	{
+		block += 32;
+		data = _mm256_load_si256((const __m256i *)block);
+		mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(data, pattern), _mm256_cmpeq_epi8(data, zero)));
+		if(mask != 0)
+			return block + __builtin_ctz(mask);
+	}
+}
+
+// blanks usually come in short runs, so wider blocks would not pay off
+__attribute__((target("sse2")))
+static const char * scan_blanks_sse2(const char * text)
+{
+	const char * block = (const char *)((uintptr_t)text & ~(uintptr_t)15);
+	__m128i space = _mm_set1_epi8(' ');
+	__m128i tab = _mm_set1_epi8('\t');
+	__m128i data = _mm_load_si128((const __m128i *)block);
+	unsigned mask = (~(unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(data, space), _mm_cmpeq_epi8(data, tab))) & 0xFFFF) >> (text - block);
+	if(mask != 0)
+		return text + __builtin_ctz(mask);
+
+	for(;;)
+	{
+		block += 16;
+		data = _mm_load_si128((const __m128i *)block);
+		mask = ~(unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(data, space), _mm_cmpeq_epi8(data, tab))) & 0xFFFF;
+		if(mask != 0)
+			return block + __builtin_ctz(mask);
+	}
+}
+#endif
+
+static const char * scan_until_select(const char * text, char c);
+static const char * scan_blanks_select(const char * text);
+
+static const char * (* scan_until_function)(const char * text, char c) = scan_until_select;
+static const char * (* scan_blanks_function)(const char * text) = scan_blanks_select;
+
+// the implementation is chosen on the first call, depending on what the processor supports
+static void scan_select(void)
+{
+	scan_until_function = scan_until_scalar;
+	scan_blanks_function = scan_blanks_scalar;
+#if SCAN_X86
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("sse2"))
+	{
+		scan_until_function = scan_until_sse2;
+		scan_blanks_function = scan_blanks_sse2;
+	}
+	if(__builtin_cpu_supports("avx2"))
+		scan_until_function = scan_until_avx2;
+#endif
+}
+
+static const char * scan_until_select(const char * text, char c)
+{
+	scan_select();
+	return scan_until_function(text, c);
+}
+
+static const char * scan_blanks_select(const char * text)
+{
+	scan_select();
+	return scan_blanks_function(text);
+}
+
+// returns the first occurrence of c or the terminating null character
+const char * scan_until(const char * text, char c)
+{
+	return scan_until_function(text, c);
+}
+
+// returns the first character that is neither a space nor a tab
+const char * scan_blanks(const char * text)
+{
+	return scan_blanks_function(text);
+}
+
@@ -0,0 +1,7 @@
+#ifndef _SCAN_H
+#define _SCAN_H
+
+const char * scan_until(const char * text, char c);
+const char * scan_blanks(const char * text);
+
+#endif // _SCAN_H
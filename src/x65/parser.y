@@ -41,7 +41,7 @@ directive
 				current_parser_state->abits = BITSIZE8;
 				current_parser_state->xbits = BITSIZE8;
 			}
-			setup_lexer(current_parser_state);
+			lexer_switch_mode(current_parser_state);
 			advance_line();
 		}
 	| KWD_WIDTH width_declaration '\n'
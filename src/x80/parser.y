@@ -59,14 +59,14 @@ directive
 				break;
 			}
 
-			setup_lexer(current_parser_state);
+			lexer_switch_mode(current_parser_state);
 			advance_line();
 		}
 	| TOK_SYNTAX '\n'
 		{
 			current_parser_state->syntax = $1;
 
-			setup_lexer(current_parser_state);
+			lexer_switch_mode(current_parser_state);
 			advance_line();
 		}
 	;
@@ -2408,6 +2408,18 @@ void x86_generate_instruction(instruction_t * ins)
 	}
 }
 
+// the index of the encoding chosen for the instruction among the patterns for its mnemonic and operand count, for the instruction dump
+long x86_instruction_get_pattern(instruction_t * ins)
+{
+	if(ins->isa != ISA_X86)
+		return -1;
+
+	const instruction_pattern_t * pattern = find_pattern(ins, false, NULL);
+	if(pattern == NULL)
+		return -1;
+	return pattern - x86_patterns[ins->mnemonic].pattern[ins->operand_count].pattern;
+}
+
 static const instruction_pattern_t pattern_aaa_0[] =
 {
 	{
@@ -914,6 +914,11 @@ extern void x86_generate_instruction(instruction_t * ins);
 # define generate_instruction x86_generate_instruction
 #endif
 
+extern long x86_instruction_get_pattern(instruction_t * ins);
+#ifndef instruction_get_pattern
+# define instruction_get_pattern x86_instruction_get_pattern
+#endif
+
 #ifndef elf_machine_type
 # define elf_machine_type() (output.format != FORMAT_ELF64 ? EM_386 : EM_X86_64)
 #endif
@@ -0,0 +1,117 @@
+#! /usr/bin/python3
+
+# Generates a perfect hash table for the fixed spellings recognized by the scanner
+
+import sys
+
+data_file_name = None
+output_file_name = None
+
+def parse_data_file():
+	# spelling -> list of (start conditions, token, value), in the order they appear
+	keywords = {}
+	with open(data_file_name, 'r') as data:
+		for line_number, line in enumerate(data, 1):
+			if '#' in line:
+				line = line[:line.find('#')]
+			fields = line.split()
+			if len(fields) == 0:
+				continue
+			if len(fields) not in {3, 4}:
+				print(f"{data_file_name}:{line_number}: invalid line", file = sys.stderr)
+				exit(1)
+			states = None if fields[0] == '*' else fields[0].split(',')
+			value = fields[3] if len(fields) == 4 else '0'
+			for spelling in fields[1].split('|'):
+				keywords.setdefault(spelling, []).append((states, fields[2], value))
+	return keywords
+
+# must match keyword_hash in parser.lex
+def keyword_hash(seed, text):
+	value = 0x811C9DC5 ^ seed
+	for c in text.encode():
+		value ^= c
+		value = (value * 0x01000193) & 0xFFFFFFFF
+	return value
+
+def generate_table(spellings):
+	# every spelling gets its own slot, buckets with several spellings store a seed that separates them,
+	# buckets with a single spelling store the slot directly as a negative number
+	count = len(spellings)
+	bucket_count = max(1, count // 2)
+	buckets = [[] for _ in range(bucket_count)]
+	for spelling in spellings:
+		buckets[keyword_hash(0, spelling) % bucket_count].append(spelling)
+
+	bucket_values = [0] * bucket_count
+	slots = [None] * count
+	for bucket_index in sorted(range(bucket_count), key = lambda index: -len(buckets[index])):
+		bucket = buckets[bucket_index]
+		if len(bucket) <= 1:
+			break
+		seed = 1
+		while True:
+			positions = [keyword_hash(seed, spelling) % count for spelling in bucket]
+			if len(set(positions)) == len(positions) and all(slots[position] is None for position in positions):
+				break
+			seed += 1
+		for spelling, position in zip(bucket, positions):
+			slots[position] = spelling
+		bucket_values[bucket_index] = seed
+
+	free_slots = [position for position in range(count) if slots[position] is None]
+	for bucket_index in range(bucket_count):
+		if len(buckets[bucket_index]) == 1:
+			position = free_slots.pop()
+			slots[position] = buckets[bucket_index][0]
+			bucket_values[bucket_index] = -position - 1
+
+	return bucket_values, slots
+
+def states_mask(states):
+	if states is None:
+		return 'KEYWORD_ALL_STATES'
+	return ' | '.join(f"KEYWORD_STATE({state})" for state in states)
+
+def main():
+	global data_file_name, output_file_name
+	args = sys.argv[1:]
+	while len(args) > 0:
+		if args[0] == '-o':
+			output_file_name = args[1]
+			args = args[2:]
+		else:
+			data_file_name = args[0]
+			args = args[1:]
+
+	keywords = parse_data_file()
+	bucket_values, slots = generate_table(sorted(keywords))
+
+	with open(output_file_name, 'w') as file:
+		print("// generated from keywords.dat, do not edit", file = file)
+		print(file = file)
+		print(f"#define KEYWORD_COUNT {len(slots)}", file = file)
+		print(f"#define KEYWORD_BUCKET_COUNT {len(bucket_values)}", file = file)
+		print(file = file)
+		print("static const int keyword_buckets[KEYWORD_BUCKET_COUNT] =\n{", file = file)
+		for index in range(0, len(bucket_values), 16):
+			print("\t" + " ".join(f"{value}," for value in bucket_values[index:index + 16]), file = file)
+		print("};", file = file)
+		print(file = file)
+
+		entries = []
+		print("static const struct keyword_spelling keyword_spellings[KEYWORD_COUNT] =\n{", file = file)
+		for spelling in slots:
+			print(f"\t{{ \"{spelling}\", {len(spelling)}, {len(entries)}, {len(keywords[spelling])} }},", file = file)
+			entries += keywords[spelling]
+		print("};", file = file)
+		print(file = file)
+
+		print("static const struct keyword_entry keyword_entries[] =\n{", file = file)
+		for states, token, value in entries:
+			print(f"\t{{ {states_mask(states)}, {token}, {value} }},", file = file)
+		print("};", file = file)
+
+if __name__ == '__main__':
+	main()
+
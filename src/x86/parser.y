@@ -114,7 +114,7 @@ directive
 			default:
 				assert(false);
 			}
-			setup_lexer(current_parser_state);
+			lexer_switch_mode(current_parser_state);
 			advance_line();
 		}
 	| KWD_BITS TOK_INTEGER '\n'
@@ -171,7 +171,7 @@ directive
 				YYERROR;
 				break;
 			}
-			setup_lexer(current_parser_state);
+			lexer_switch_mode(current_parser_state);
 			advance_line();
 		}
 	| TOK_ARCH '\n'
@@ -210,7 +210,7 @@ directive
 					current_parser_state->x80_cpu_type = CPU_8080;
 			}
 
-			setup_lexer(current_parser_state);
+			lexer_switch_mode(current_parser_state);
 			advance_line();
 		}
 	| TOK_FPU '\n'